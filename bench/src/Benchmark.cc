@@ -0,0 +1,360 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace AlibabaCloud::OSS::Bench;
+
+namespace
+{
+    /* cpu cycle and retired instruction counters of the calling thread, from perf_event on Linux */
+    class PerfCounters
+    {
+    public:
+        PerfCounters() : cyclesFd_(-1), instructionsFd_(-1) {}
+        ~PerfCounters()
+        {
+#ifdef __linux__
+            if (cyclesFd_ >= 0) ::close(cyclesFd_);
+            if (instructionsFd_ >= 0) ::close(instructionsFd_);
+#endif
+        }
+
+        bool open()
+        {
+#ifdef __linux__
+            cyclesFd_ = openCounter(PERF_COUNT_HW_CPU_CYCLES);
+            instructionsFd_ = openCounter(PERF_COUNT_HW_INSTRUCTIONS);
+#endif
+            return isOpen();
+        }
+        bool isOpen() const { return cyclesFd_ >= 0 && instructionsFd_ >= 0; }
+
+        void start()
+        {
+#ifdef __linux__
+            ::ioctl(cyclesFd_, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(instructionsFd_, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(cyclesFd_, PERF_EVENT_IOC_ENABLE, 0);
+            ::ioctl(instructionsFd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+
+        void stop(uint64_t& cycles, uint64_t& instructions)
+        {
+            cycles = 0;
+            instructions = 0;
+#ifdef __linux__
+            ::ioctl(cyclesFd_, PERF_EVENT_IOC_DISABLE, 0);
+            ::ioctl(instructionsFd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (::read(cyclesFd_, &cycles, sizeof(cycles)) != sizeof(cycles)) {
+                cycles = 0;
+            }
+            if (::read(instructionsFd_, &instructions, sizeof(instructions)) != sizeof(instructions)) {
+                instructions = 0;
+            }
+#endif
+        }
+
+    private:
+#ifdef __linux__
+        static int openCounter(uint64_t config)
+        {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+        int cyclesFd_;
+        int instructionsFd_;
+    };
+
+    PerfCounters* g_PerfCounters = nullptr;
+
+    std::vector<Benchmark*>& Registry()
+    {
+        static std::vector<Benchmark*> benchmarks;
+        return benchmarks;
+    }
+
+    struct Options
+    {
+        std::string filter;
+        double minTimeS = 0.5;
+        bool perf = false;
+        bool list = false;
+        std::string jsonFile;
+    };
+
+    struct Report
+    {
+        std::string name;
+        uint64_t iterations;
+        double nsPerIteration;
+        double bytesPerSecond;
+        double itemsPerSecond;
+        double cyclesPerIteration;
+        double instructionsPerIteration;
+        std::string label;
+    };
+
+    void PrintHelp()
+    {
+        std::cout << "\n";
+        std::cout << "Usage: cpp-sdk-bench [-h] [--list] [--filter SUBSTR] [--min-time SEC] [--perf] [--json FILE]\n";
+        std::cout << "Optional arguments:      \n";
+        std::cout << "  -h, --help          show this help message and exit.           \n";
+        std::cout << "  --list              list the benchmarks and exit.              \n";
+        std::cout << "  --filter SUBSTR     run only the benchmarks whose name contains SUBSTR. \n";
+        std::cout << "  --min-time SEC      minimum measured time of each benchmark, default is 0.5. \n";
+        std::cout << "  --perf              read cpu cycle and instruction counters, Linux only. \n";
+        std::cout << "  --json FILE         write the results as json to FILE.         \n";
+    }
+
+    std::string FormatRate(double perSecond, const char* unit)
+    {
+        static const char* prefixes[] = { "", "k", "M", "G" };
+        int i = 0;
+        while (perSecond >= 1000.0 && i < 3) {
+            perSecond /= 1000.0;
+            i++;
+        }
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.2f %s%s/s", perSecond, prefixes[i], unit);
+        return buf;
+    }
+
+    Report RunOne(const Benchmark& benchmark, int64_t arg, bool hasArg, const Options& options)
+    {
+        uint64_t iterations = 1;
+        while (true) {
+            State state(arg, iterations);
+            benchmark.Function()(state);
+            double elapsed = state.ElapsedSeconds();
+            if (elapsed >= options.minTimeS || iterations >= 1000000000ULL) {
+                Report report;
+                report.name = benchmark.Name();
+                if (hasArg) {
+                    report.name.append("/").append(std::to_string(arg));
+                }
+                report.iterations = state.Iterations();
+                report.nsPerIteration = elapsed * 1e9 / static_cast<double>(report.iterations);
+                report.bytesPerSecond = static_cast<double>(state.BytesProcessed()) / elapsed;
+                report.itemsPerSecond = static_cast<double>(state.ItemsProcessed()) / elapsed;
+                report.cyclesPerIteration = state.HasCounters() ?
+                    static_cast<double>(state.Cycles()) / static_cast<double>(report.iterations) : 0.0;
+                report.instructionsPerIteration = state.HasCounters() ?
+                    static_cast<double>(state.Instructions()) / static_cast<double>(report.iterations) : 0.0;
+                report.label = state.Label();
+                return report;
+            }
+            /* grow towards the minimum time, overshooting a little so that most benchmarks need one more run */
+            double multiplier = elapsed > 0.0 ? options.minTimeS * 1.4 / elapsed : 10.0;
+            multiplier = std::min(10.0, std::max(2.0, multiplier));
+            iterations = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+        }
+    }
+
+    void PrintReport(const Report& report, bool perf)
+    {
+        char buf[256];
+        snprintf(buf, sizeof(buf), "%-44s %12llu %14.1f ns", report.name.c_str(),
+            static_cast<unsigned long long>(report.iterations), report.nsPerIteration);
+        std::string line(buf);
+        if (report.bytesPerSecond > 0.0) {
+            snprintf(buf, sizeof(buf), "  %14s", FormatRate(report.bytesPerSecond, "B").c_str());
+            line.append(buf);
+        }
+        else if (report.itemsPerSecond > 0.0) {
+            snprintf(buf, sizeof(buf), "  %14s", FormatRate(report.itemsPerSecond, "items").c_str());
+            line.append(buf);
+        }
+        if (perf && report.cyclesPerIteration > 0.0) {
+            snprintf(buf, sizeof(buf), "  cycles=%.1f instructions=%.1f ipc=%.2f", report.cyclesPerIteration,
+                report.instructionsPerIteration, report.instructionsPerIteration / report.cyclesPerIteration);
+            line.append(buf);
+        }
+        if (!report.label.empty()) {
+            line.append("  ").append(report.label);
+        }
+        std::cout << line << std::endl;
+    }
+
+    void WriteJson(const std::vector<Report>& reports, const std::string& file)
+    {
+        std::stringstream ss;
+        ss << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < reports.size(); i++) {
+            const Report& r = reports[i];
+            ss << "    {\"name\": \"" << r.name << "\""
+               << ", \"iterations\": " << r.iterations
+               << ", \"nsPerIteration\": " << r.nsPerIteration
+               << ", \"bytesPerSecond\": " << r.bytesPerSecond
+               << ", \"itemsPerSecond\": " << r.itemsPerSecond
+               << ", \"cyclesPerIteration\": " << r.cyclesPerIteration
+               << ", \"instructionsPerIteration\": " << r.instructionsPerIteration << "}"
+               << (i + 1 < reports.size() ? "," : "") << "\n";
+        }
+        ss << "  ]\n}\n";
+
+        std::fstream out(file, std::ios::out | std::ios::trunc);
+        if (!out.good()) {
+            std::cout << "Open json file " << file << " fail." << std::endl;
+            return;
+        }
+        out << ss.str();
+    }
+}
+
+State::State(int64_t arg, uint64_t maxIterations) :
+    arg_(arg),
+    maxIterations_(maxIterations),
+    iterations_(0),
+    bytesProcessed_(0),
+    itemsProcessed_(0),
+    elapsedSeconds_(0.0),
+    cycles_(0),
+    instructions_(0),
+    hasCounters_(false),
+    stopped_(false)
+{
+}
+
+void State::start()
+{
+    if (g_PerfCounters != nullptr) {
+        g_PerfCounters->start();
+    }
+    startTime_ = std::chrono::steady_clock::now();
+}
+
+void State::stop()
+{
+    if (stopped_) {
+        return;
+    }
+    auto stopTime = std::chrono::steady_clock::now();
+    if (g_PerfCounters != nullptr) {
+        g_PerfCounters->stop(cycles_, instructions_);
+        hasCounters_ = true;
+    }
+    elapsedSeconds_ = std::chrono::duration<double>(stopTime - startTime_).count();
+    stopped_ = true;
+}
+
+Benchmark::Benchmark(const std::string& name, BenchmarkFunction func) :
+    name_(name),
+    func_(func)
+{
+}
+
+Benchmark* Benchmark::Args(const std::vector<int64_t>& args)
+{
+    args_ = args;
+    return this;
+}
+
+Benchmark* AlibabaCloud::OSS::Bench::RegisterBenchmark(const char* name, BenchmarkFunction func)
+{
+    Registry().push_back(new Benchmark(name, func));
+    return Registry().back();
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp("--help", argv[i]) || !strcmp("-h", argv[i])) {
+            PrintHelp();
+            return 0;
+        }
+        else if (!strcmp("--list", argv[i])) {
+            options.list = true;
+        }
+        else if (!strcmp("--filter", argv[i]) && i + 1 < argc) {
+            options.filter = argv[++i];
+        }
+        else if (!strcmp("--min-time", argv[i]) && i + 1 < argc) {
+            options.minTimeS = std::atof(argv[++i]);
+        }
+        else if (!strcmp("--perf", argv[i])) {
+            options.perf = true;
+        }
+        else if (!strcmp("--json", argv[i]) && i + 1 < argc) {
+            options.jsonFile = argv[++i];
+        }
+    }
+
+    std::unique_ptr<PerfCounters> counters;
+    if (options.perf) {
+        counters.reset(new PerfCounters());
+        if (counters->open()) {
+            g_PerfCounters = counters.get();
+        }
+        else {
+            std::cout << "The perf_event counters are not available, run without them." << std::endl;
+        }
+    }
+
+    AlibabaCloud::OSS::InitializeSdk();
+
+    std::vector<Report> reports;
+    for (const auto benchmark : Registry()) {
+        if (!options.filter.empty() && benchmark->Name().find(options.filter) == std::string::npos) {
+            continue;
+        }
+        if (options.list) {
+            std::cout << benchmark->Name() << std::endl;
+            continue;
+        }
+        if (benchmark->ArgList().empty()) {
+            reports.push_back(RunOne(*benchmark, 0, false, options));
+            PrintReport(reports.back(), g_PerfCounters != nullptr);
+        }
+        for (auto arg : benchmark->ArgList()) {
+            reports.push_back(RunOne(*benchmark, arg, true, options));
+            PrintReport(reports.back(), g_PerfCounters != nullptr);
+        }
+    }
+
+    if (!options.jsonFile.empty()) {
+        WriteJson(reports, options.jsonFile);
+    }
+
+    AlibabaCloud::OSS::ShutdownSdk();
+    return 0;
+}
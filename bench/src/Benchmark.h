@@ -0,0 +1,127 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+namespace Bench
+{
+    /*
+    * The state of one benchmark run. The function under test loops on KeepRunning(),
+    * which counts the iterations and times the loop, and may report the processed bytes
+    * or items so that the runner can print a rate next to the time per iteration.
+    */
+    class State
+    {
+    public:
+        State(int64_t arg, uint64_t maxIterations);
+
+        bool KeepRunning()
+        {
+            if (iterations_ == 0) {
+                start();
+            }
+            if (iterations_ < maxIterations_) {
+                iterations_++;
+                return true;
+            }
+            stop();
+            return false;
+        }
+
+        int64_t Arg() const { return arg_; }
+        uint64_t Iterations() const { return iterations_; }
+        void setBytesProcessed(int64_t bytes) { bytesProcessed_ = bytes; }
+        void setItemsProcessed(int64_t items) { itemsProcessed_ = items; }
+        void setLabel(const std::string& label) { label_ = label; }
+
+        int64_t BytesProcessed() const { return bytesProcessed_; }
+        int64_t ItemsProcessed() const { return itemsProcessed_; }
+        const std::string& Label() const { return label_; }
+        double ElapsedSeconds() const { return elapsedSeconds_; }
+        uint64_t Cycles() const { return cycles_; }
+        uint64_t Instructions() const { return instructions_; }
+        bool HasCounters() const { return hasCounters_; }
+
+    private:
+        void start();
+        void stop();
+        int64_t arg_;
+        uint64_t maxIterations_;
+        uint64_t iterations_;
+        int64_t bytesProcessed_;
+        int64_t itemsProcessed_;
+        std::string label_;
+        std::chrono::steady_clock::time_point startTime_;
+        double elapsedSeconds_;
+        uint64_t cycles_;
+        uint64_t instructions_;
+        bool hasCounters_;
+        bool stopped_;
+    };
+
+    using BenchmarkFunction = void(*)(State&);
+
+    class Benchmark
+    {
+    public:
+        Benchmark(const std::string& name, BenchmarkFunction func);
+        /* runs the benchmark once for every argument */
+        Benchmark* Args(const std::vector<int64_t>& args);
+
+        const std::string& Name() const { return name_; }
+        BenchmarkFunction Function() const { return func_; }
+        const std::vector<int64_t>& ArgList() const { return args_; }
+    private:
+        std::string name_;
+        BenchmarkFunction func_;
+        std::vector<int64_t> args_;
+    };
+
+    Benchmark* RegisterBenchmark(const char* name, BenchmarkFunction func);
+
+    /* keeps the compiler from optimizing away a computed value */
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+}
+}
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define OSS_BENCHMARK_UNUSED __attribute__((unused))
+#else
+#define OSS_BENCHMARK_UNUSED
+#endif
+#define OSS_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define OSS_BENCHMARK_CONCAT(a, b) OSS_BENCHMARK_CONCAT_INNER(a, b)
+#define OSS_BENCHMARK(func) \
+    static AlibabaCloud::OSS::Bench::Benchmark* OSS_BENCHMARK_CONCAT(benchmark_, __LINE__) OSS_BENCHMARK_UNUSED = \
+        AlibabaCloud::OSS::Bench::RegisterBenchmark(#func, func)
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <src/utils/Crc32.h>
+#include <src/utils/Crc64.h>
+#include <string>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+static void BM_CRC64_CalcCRC(State& state)
+{
+    std::string data(static_cast<size_t>(state.Arg()), 'x');
+    uint64_t crc = 0;
+    while (state.KeepRunning()) {
+        crc = CRC64::CalcCRC(crc, const_cast<char*>(data.data()), data.size());
+    }
+    DoNotOptimize(crc);
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_CRC64_CalcCRC)->Args({ 64, 4096, 64 * 1024, 1024 * 1024 });
+
+/* the arg is the length of the second block, as combining is logarithmic in it */
+static void BM_CRC64_CombineCRC(State& state)
+{
+    uint64_t crc1 = 0x1234567890ABCDEFULL;
+    uint64_t crc2 = 0xFEDCBA0987654321ULL;
+    while (state.KeepRunning()) {
+        crc1 = CRC64::CombineCRC(crc1, crc2, static_cast<uintmax_t>(state.Arg()));
+    }
+    DoNotOptimize(crc1);
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+OSS_BENCHMARK(BM_CRC64_CombineCRC)->Args({ 4096, 8 * 1024 * 1024, 5LL * 1024 * 1024 * 1024 });
+
+static void BM_CRC32_CalcCRC(State& state)
+{
+    std::string data(static_cast<size_t>(state.Arg()), 'x');
+    uint32_t crc = 0;
+    while (state.KeepRunning()) {
+        crc = CRC32::CalcCRC(crc, data.data(), data.size());
+    }
+    DoNotOptimize(crc);
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_CRC32_CalcCRC)->Args({ 64, 4096, 64 * 1024, 1024 * 1024 });
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <src/encryption/CryptoStreamBuf.h>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+static const int64_t CRYPTO_CONTENT_SIZE = 1024 * 1024;
+
+static void MakeKeyAndIV(ByteBuffer& key, ByteBuffer& iv)
+{
+    key = ByteBuffer(32);
+    iv = ByteBuffer(16);
+    memcpy((void *)key.data(), (void *)("12345678901234561234567890123456"), 32);
+    memcpy((void *)iv.data(), (void *)("1234567890123456"), 16);
+}
+
+/* reads 1MB through an encrypting stream, the arg is the size of each read */
+static void BM_CryptoStreamBuf_Encrypt(State& state)
+{
+    ByteBuffer key, iv;
+    MakeKeyAndIV(key, iv);
+    auto cipher = SymmetricCipher::CreateAES256_CTRImpl();
+    std::string data(static_cast<size_t>(CRYPTO_CONTENT_SIZE), 'x');
+    std::vector<char> buffer(static_cast<size_t>(state.Arg()));
+
+    while (state.KeepRunning()) {
+        std::stringstream content(data);
+        CryptoStreamBuf cryptoStream(content, cipher, key, iv);
+        while (content.read(buffer.data(), state.Arg()) || content.gcount() > 0) {
+            DoNotOptimize(buffer[0]);
+        }
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * CRYPTO_CONTENT_SIZE);
+}
+OSS_BENCHMARK(BM_CryptoStreamBuf_Encrypt)->Args({ 100, 16 * 1024, 256 * 1024 });
+
+/* writes 1MB through a decrypting stream, the arg is the size of each write */
+static void BM_CryptoStreamBuf_Decrypt(State& state)
+{
+    ByteBuffer key, iv;
+    MakeKeyAndIV(key, iv);
+    auto cipher = SymmetricCipher::CreateAES256_CTRImpl();
+    std::string data(static_cast<size_t>(CRYPTO_CONTENT_SIZE), 'x');
+
+    while (state.KeepRunning()) {
+        std::stringstream content;
+        {
+            CryptoStreamBuf cryptoStream(content, cipher, key, iv);
+            for (int64_t offset = 0; offset < CRYPTO_CONTENT_SIZE; offset += state.Arg()) {
+                content.write(data.data() + offset, std::min(state.Arg(), CRYPTO_CONTENT_SIZE - offset));
+            }
+        }
+        DoNotOptimize(content.tellp());
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * CRYPTO_CONTENT_SIZE);
+}
+OSS_BENCHMARK(BM_CryptoStreamBuf_Decrypt)->Args({ 100, 16 * 1024, 256 * 1024 });
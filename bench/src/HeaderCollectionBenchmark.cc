@@ -0,0 +1,95 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <alibabacloud/oss/Types.h>
+#include <string>
+#include <vector>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+/* the headers of a typical GetObject response */
+static const std::vector<std::pair<std::string, std::string>>& ResponseHeaders()
+{
+    static const std::vector<std::pair<std::string, std::string>> headers = {
+        { "Server", "AliyunOSS" },
+        { "Date", "Mon, 01 Jan 2024 08:00:00 GMT" },
+        { "Content-Type", "image/jpeg" },
+        { "Content-Length", "344606" },
+        { "Connection", "keep-alive" },
+        { "x-oss-request-id", "5C3D9175B6FC201293AD****" },
+        { "Accept-Ranges", "bytes" },
+        { "ETag", "\"5B3C1A2E053D763E1B002CC607C5A0FE1\"" },
+        { "Last-Modified", "Mon, 01 Jan 2024 07:00:00 GMT" },
+        { "x-oss-object-type", "Normal" },
+        { "x-oss-hash-crc64ecma", "316181249502703****" },
+        { "x-oss-storage-class", "Standard" },
+        { "Content-MD5", "1B2M2Y8AsgTpgAmY7PhCfg==" },
+        { "x-oss-server-time", "7" },
+        { "x-oss-meta-author", "user-example" },
+        { "x-oss-meta-category", "photos" },
+    };
+    return headers;
+}
+
+static void BM_HeaderCollection_Insert(State& state)
+{
+    const auto& headers = ResponseHeaders();
+    while (state.KeepRunning()) {
+        HeaderCollection collection;
+        for (const auto& header : headers) {
+            collection[header.first] = header.second;
+        }
+        DoNotOptimize(collection.size());
+    }
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations() * headers.size()));
+}
+OSS_BENCHMARK(BM_HeaderCollection_Insert);
+
+/* case-insensitive lookups with the spellings which the sdk uses when parsing a response */
+static void BM_HeaderCollection_Find(State& state)
+{
+    static const char* names[] = { "content-length", "ETag", "x-oss-request-id", "X-Oss-Hash-Crc64ecma",
+        "Last-Modified", "x-oss-object-type", "content-type", "x-oss-version-id" };
+    HeaderCollection collection;
+    for (const auto& header : ResponseHeaders()) {
+        collection[header.first] = header.second;
+    }
+    size_t found = 0;
+    while (state.KeepRunning()) {
+        for (const auto name : names) {
+            found += collection.find(name) != collection.end() ? 1 : 0;
+        }
+    }
+    DoNotOptimize(found);
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations() * (sizeof(names) / sizeof(names[0]))));
+}
+OSS_BENCHMARK(BM_HeaderCollection_Find);
+
+static void BM_HeaderCollection_Copy(State& state)
+{
+    HeaderCollection collection;
+    for (const auto& header : ResponseHeaders()) {
+        collection[header.first] = header.second;
+    }
+    while (state.KeepRunning()) {
+        HeaderCollection copy(collection);
+        DoNotOptimize(copy.size());
+    }
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations() * collection.size()));
+}
+OSS_BENCHMARK(BM_HeaderCollection_Copy);
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <alibabacloud/oss/model/ListObjectsResult.h>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+/* a ListObjects response body with the arg number of objects */
+static std::string MakeListObjectsXml(int64_t count)
+{
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListBucketResult>\n"
+       << "<Name>bucket</Name><Prefix>photos/</Prefix><Marker></Marker><MaxKeys>1000</MaxKeys>"
+       << "<Delimiter></Delimiter><IsTruncated>true</IsTruncated><NextMarker>photos/next</NextMarker>\n";
+    for (int64_t i = 0; i < count; i++) {
+        ss << "<Contents>"
+           << "<Key>photos/2024/IMG_" << i << ".jpg</Key>"
+           << "<LastModified>2024-01-01T08:00:00.000Z</LastModified>"
+           << "<ETag>\"5B3C1A2E053D763E1B002CC607C5A0FE1\"</ETag>"
+           << "<Type>Normal</Type>"
+           << "<Size>" << 344606 + i << "</Size>"
+           << "<StorageClass>Standard</StorageClass>"
+           << "<Owner><ID>0022012****</ID><DisplayName>user-example</DisplayName></Owner>"
+           << "</Contents>\n";
+    }
+    ss << "</ListBucketResult>\n";
+    return ss.str();
+}
+
+static void BM_ListObjectsResult_ParseString(State& state)
+{
+    std::string xml = MakeListObjectsXml(state.Arg());
+    while (state.KeepRunning()) {
+        ListObjectsResult result(xml);
+        DoNotOptimize(result.ObjectSummarys().size());
+    }
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_ListObjectsResult_ParseString)->Args({ 10, 100, 1000 });
+
+static void BM_ListObjectsResult_ParseStream(State& state)
+{
+    std::string xml = MakeListObjectsXml(state.Arg());
+    while (state.KeepRunning()) {
+        auto content = std::make_shared<std::stringstream>(xml);
+        ListObjectsResult result(std::static_pointer_cast<std::iostream>(content));
+        DoNotOptimize(result.ObjectSummarys().size());
+    }
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_ListObjectsResult_ParseStream)->Args({ 10, 100, 1000 });
@@ -0,0 +1,412 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+/*
+* One benchmark pair per result type parsed in place: _ParseStream is the path of the sdk,
+* the payload stream is parsed without a copy; _ViaString drains the stream into a string
+* first, the way the payloads were read before. The list results take the number of entries
+* as the argument. A body the parser does not accept is labelled, it would time nothing.
+*/
+
+namespace
+{
+const char* XML_HEAD = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+
+std::string Repeat(int64_t count, const std::function<std::string(int64_t)>& item)
+{
+    std::string out;
+    for (int64_t i = 0; i < count; i++) {
+        out.append(item(i));
+    }
+    return out;
+}
+
+std::string CompleteMultipartUploadXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<CompleteMultipartUploadResult>"
+        "<Location>http://oss-example.oss-cn-hangzhou.aliyuncs.com/multipart.data</Location>"
+        "<Bucket>oss-example</Bucket><Key>multipart.data</Key>"
+        "<ETag>\"B864DB6A936D376F9F8D3ED3BBE540****\"</ETag></CompleteMultipartUploadResult>";
+}
+
+std::string CopyObjectXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<CopyObjectResult><LastModified>2012-02-24T09:35:51.000Z</LastModified>"
+        "<ETag>\"5B3C1A2E053D763E1B002CC607C5****\"</ETag></CopyObjectResult>";
+}
+
+std::string UploadPartCopyXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<CopyPartResult><LastModified>2014-07-17T06:27:54.000Z</LastModified>"
+        "<ETag>\"5B3C1A2E053D763E1B002CC607C5****\"</ETag></CopyPartResult>";
+}
+
+std::string DeleteObjectsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<DeleteResult>" + Repeat(count, [](int64_t i) {
+        return "<Deleted><Key>dir/sub/object-" + std::to_string(i) + ".jpg</Key></Deleted>"; }) + "</DeleteResult>";
+}
+
+std::string DeleteObjectVersionsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<DeleteResult>" + Repeat(count, [](int64_t i) {
+        return "<Deleted><Key>dir/sub/object-" + std::to_string(i) + ".jpg</Key>"
+            "<VersionId>CAEQNRiBgIDMh4mD0BYiIDUzNDA4OGNmZjBjYTQ0YmI4Y2I4ZmVlYzJlNGVk****</VersionId>"
+            "<DeleteMarker>true</DeleteMarker>"
+            "<DeleteMarkerVersionId>CAEQMhiBgIDXiaaB0BYiIGQzYmRkZGUxMTM1ZDRjOTZhNjk4YjRjMTAyZjhl****</DeleteMarkerVersionId>"
+            "</Deleted>"; }) + "</DeleteResult>";
+}
+
+std::string AclXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<AccessControlPolicy><Owner><ID>0022012****</ID>"
+        "<DisplayName>user_example</DisplayName></Owner>"
+        "<AccessControlList><Grant>public-read</Grant></AccessControlList></AccessControlPolicy>";
+}
+
+std::string CorsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<CORSConfiguration>" + Repeat(count, [](int64_t i) {
+        return "<CORSRule><AllowedOrigin>http://www.example-" + std::to_string(i) + ".com</AllowedOrigin>"
+            "<AllowedMethod>PUT</AllowedMethod><AllowedMethod>GET</AllowedMethod>"
+            "<AllowedHeader>Authorization</AllowedHeader><ExposeHeader>x-oss-test</ExposeHeader>"
+            "<MaxAgeSeconds>100</MaxAgeSeconds></CORSRule>"; }) + "</CORSConfiguration>";
+}
+
+std::string EncryptionXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<ServerSideEncryptionRule><ApplyServerSideEncryptionByDefault>"
+        "<SSEAlgorithm>KMS</SSEAlgorithm><KMSMasterKeyID>9468da86-3509-4f8d-a61e-6eab1eac****</KMSMasterKeyID>"
+        "</ApplyServerSideEncryptionByDefault></ServerSideEncryptionRule>";
+}
+
+std::string BucketInfoXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<BucketInfo><Bucket>"
+        "<CreationDate>2013-07-31T10:56:21.000Z</CreationDate><ExtranetEndpoint>oss-cn-hangzhou.aliyuncs.com</ExtranetEndpoint>"
+        "<IntranetEndpoint>oss-cn-hangzhou-internal.aliyuncs.com</IntranetEndpoint><Location>oss-cn-hangzhou</Location>"
+        "<Name>oss-example</Name><StorageClass>Standard</StorageClass>"
+        "<Owner><DisplayName>username</DisplayName><ID>27183473914****</ID></Owner>"
+        "<AccessControlList><Grant>private</Grant></AccessControlList><Comment>test</Comment>"
+        "</Bucket></BucketInfo>";
+}
+
+std::string InventoryXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<InventoryConfiguration><Id>report1</Id><IsEnabled>true</IsEnabled>"
+        "<Filter><Prefix>filterPrefix/</Prefix></Filter>"
+        "<Destination><OSSBucketDestination><Format>CSV</Format><AccountId>1000000000000000</AccountId>"
+        "<RoleArn>acs:ram::1000000000000000:role/AliyunOSSRole</RoleArn><Bucket>acs:oss:::destination-bucket</Bucket>"
+        "<Prefix>prefix1</Prefix><Encryption><SSE-KMS><KeyId>keyId</KeyId></SSE-KMS></Encryption>"
+        "</OSSBucketDestination></Destination><Schedule><Frequency>Daily</Frequency></Schedule>"
+        "<IncludedObjectVersions>All</IncludedObjectVersions><OptionalFields><Field>Size</Field>"
+        "<Field>LastModifiedDate</Field><Field>ETag</Field><Field>StorageClass</Field>"
+        "<Field>IsMultipartUploaded</Field><Field>EncryptionStatus</Field></OptionalFields>"
+        "</InventoryConfiguration>";
+}
+
+std::string LifecycleXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<LifecycleConfiguration>" + Repeat(count, [](int64_t i) {
+        return "<Rule><ID>rule-" + std::to_string(i) + "</ID><Prefix>log/" + std::to_string(i) + "/</Prefix>"
+            "<Status>Enabled</Status><Expiration><Days>100</Days></Expiration>"
+            "<Transition><Days>30</Days><StorageClass>IA</StorageClass></Transition>"
+            "<AbortMultipartUpload><Days>10</Days></AbortMultipartUpload>"
+            "<Tag><Key>key</Key><Value>value</Value></Tag></Rule>"; }) + "</LifecycleConfiguration>";
+}
+
+std::string LocationXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<LocationConstraint>oss-cn-hangzhou</LocationConstraint>";
+}
+
+std::string LoggingXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<BucketLoggingStatus><LoggingEnabled><TargetBucket>mybucketlogs</TargetBucket>"
+        "<TargetPrefix>mybucket-access_log/</TargetPrefix></LoggingEnabled></BucketLoggingStatus>";
+}
+
+std::string PaymentXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<RequestPaymentConfiguration><Payer>BucketOwner</Payer></RequestPaymentConfiguration>";
+}
+
+std::string QosXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<QoSConfiguration><TotalUploadBandwidth>10</TotalUploadBandwidth>"
+        "<IntranetUploadBandwidth>-1</IntranetUploadBandwidth><ExtranetUploadBandwidth>-1</ExtranetUploadBandwidth>"
+        "<TotalDownloadBandwidth>10</TotalDownloadBandwidth><IntranetDownloadBandwidth>-1</IntranetDownloadBandwidth>"
+        "<ExtranetDownloadBandwidth>-1</ExtranetDownloadBandwidth><TotalQps>1000</TotalQps>"
+        "<IntranetQps>-1</IntranetQps><ExtranetQps>-1</ExtranetQps></QoSConfiguration>";
+}
+
+std::string UserQosXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<QoSConfiguration><Region>oss-cn-hangzhou</Region>"
+        "<TotalUploadBandwidth>10</TotalUploadBandwidth><IntranetUploadBandwidth>-1</IntranetUploadBandwidth>"
+        "<ExtranetUploadBandwidth>-1</ExtranetUploadBandwidth><TotalDownloadBandwidth>10</TotalDownloadBandwidth>"
+        "<IntranetDownloadBandwidth>-1</IntranetDownloadBandwidth><ExtranetDownloadBandwidth>-1</ExtranetDownloadBandwidth>"
+        "<TotalQps>1000</TotalQps><IntranetQps>-1</IntranetQps><ExtranetQps>-1</ExtranetQps></QoSConfiguration>";
+}
+
+std::string RefererXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<RefererConfiguration><AllowEmptyReferer>false</AllowEmptyReferer><RefererList>" +
+        Repeat(count, [](int64_t i) { return "<Referer>http://www.example-" + std::to_string(i) + ".com</Referer>"; }) +
+        "</RefererList></RefererConfiguration>";
+}
+
+std::string StatXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<BucketStat><Storage>1600</Storage><ObjectCount>230</ObjectCount>"
+        "<MultipartUploadCount>40</MultipartUploadCount><LiveChannelCount>4</LiveChannelCount>"
+        "<LastModifiedTime>1643341269</LastModifiedTime><StandardStorage>430</StandardStorage>"
+        "<StandardObjectCount>66</StandardObjectCount><InfrequentAccessStorage>2359296</InfrequentAccessStorage>"
+        "<InfrequentAccessObjectCount>54</InfrequentAccessObjectCount><ArchiveStorage>2949120</ArchiveStorage>"
+        "<ArchiveObjectCount>74</ArchiveObjectCount><ColdArchiveStorage>2359296</ColdArchiveStorage>"
+        "<ColdArchiveObjectCount>36</ColdArchiveObjectCount></BucketStat>";
+}
+
+std::string StorageCapacityXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<BucketUserQos><StorageCapacity>10240</StorageCapacity></BucketUserQos>";
+}
+
+std::string TaggingXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<Tagging><TagSet>" + Repeat(count, [](int64_t i) {
+        return "<Tag><Key>key" + std::to_string(i) + "</Key><Value>value" + std::to_string(i) + "</Value></Tag>"; }) +
+        "</TagSet></Tagging>";
+}
+
+std::string VersioningXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<VersioningConfiguration><Status>Enabled</Status></VersioningConfiguration>";
+}
+
+std::string WebsiteXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<WebsiteConfiguration><IndexDocument><Suffix>index.html</Suffix></IndexDocument>"
+        "<ErrorDocument><Key>error.html</Key></ErrorDocument></WebsiteConfiguration>";
+}
+
+std::string WormXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<WormConfiguration><WormId>1666E2CFB2B3418****</WormId><State>Locked</State>"
+        "<RetentionPeriodInDays>1</RetentionPeriodInDays><CreationDate>2020-10-15T15:50:32</CreationDate>"
+        "</WormConfiguration>";
+}
+
+std::string LiveChannelHistoryXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<LiveChannelHistory>" + Repeat(count, [](int64_t) {
+        return std::string("<LiveRecord><StartTime>2016-07-30T01:53:21.000Z</StartTime>"
+            "<EndTime>2016-07-30T01:53:31.000Z</EndTime><RemoteAddr>10.101.194.148:56861</RemoteAddr></LiveRecord>"); }) +
+        "</LiveChannelHistory>";
+}
+
+std::string LiveChannelInfoXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<LiveChannelConfiguration><Description></Description><Status>enabled</Status>"
+        "<Target><Type>HLS</Type><FragDuration>2</FragDuration><FragCount>3</FragCount>"
+        "<PlaylistName>playlist.m3u8</PlaylistName></Target></LiveChannelConfiguration>";
+}
+
+std::string LiveChannelStatXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<LiveChannelStat><Status>Live</Status>"
+        "<ConnectedTime>2016-08-25T06:25:15.000Z</ConnectedTime><RemoteAddr>10.1.2.3:47745</RemoteAddr>"
+        "<Video><Width>1280</Width><Height>536</Height><FrameRate>24</FrameRate><Bandwidth>0</Bandwidth>"
+        "<Codec>H264</Codec></Video><Audio><Bandwidth>0</Bandwidth><SampleRate>44100</SampleRate>"
+        "<Codec>ADPCM</Codec></Audio></LiveChannelStat>";
+}
+
+std::string LiveChannelUrls()
+{
+    return "<PublishUrls><Url>rtmp://test-bucket.oss-cn-hangzhou.aliyuncs.com/live/test-channel</Url></PublishUrls>"
+        "<PlayUrls><Url>http://test-bucket.oss-cn-hangzhou.aliyuncs.com/test-channel/playlist.m3u8</Url></PlayUrls>";
+}
+
+std::string ListLiveChannelXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<ListLiveChannelResult><Prefix></Prefix><Marker></Marker><MaxKeys>1000</MaxKeys>"
+        "<IsTruncated>false</IsTruncated><NextMarker></NextMarker>" + Repeat(count, [](int64_t i) {
+        return "<LiveChannel><Name>channel-" + std::to_string(i) + "</Name><Description></Description>"
+            "<Status>disabled</Status><LastModified>2016-07-30T01:54:21.000Z</LastModified>" +
+            LiveChannelUrls() + "</LiveChannel>"; }) + "</ListLiveChannelResult>";
+}
+
+std::string PutLiveChannelXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<CreateLiveChannelResult>" + LiveChannelUrls() + "</CreateLiveChannelResult>";
+}
+
+std::string InitiateMultipartUploadXml(int64_t)
+{
+    return std::string(XML_HEAD) + "<InitiateMultipartUploadResult><Bucket>oss-example</Bucket>"
+        "<Key>multipart.data</Key><UploadId>0004B9894A22E5B1888A1E29F823****</UploadId>"
+        "</InitiateMultipartUploadResult>";
+}
+
+std::string ListBucketsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<ListAllMyBucketsResult><Prefix></Prefix><Marker></Marker><MaxKeys>1000</MaxKeys>"
+        "<IsTruncated>false</IsTruncated><NextMarker></NextMarker>"
+        "<Owner><ID>51264</ID><DisplayName>51264</DisplayName></Owner><Buckets>" + Repeat(count, [](int64_t i) {
+        return "<Bucket><CreationDate>2014-02-17T18:12:43.000Z</CreationDate>"
+            "<ExtranetEndpoint>oss-cn-shanghai.aliyuncs.com</ExtranetEndpoint>"
+            "<IntranetEndpoint>oss-cn-shanghai-internal.aliyuncs.com</IntranetEndpoint>"
+            "<Location>oss-cn-shanghai</Location><Name>app-base-oss-" + std::to_string(i) + "</Name>"
+            "<StorageClass>Standard</StorageClass></Bucket>"; }) + "</Buckets></ListAllMyBucketsResult>";
+}
+
+std::string ListMultipartUploadsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<ListMultipartUploadsResult>"
+        "<Bucket>bucket</Bucket><KeyMarker></KeyMarker><UploadIdMarker></UploadIdMarker><NextKeyMarker>key</NextKeyMarker>"
+        "<NextUploadIdMarker>id</NextUploadIdMarker><Delimiter></Delimiter><Prefix></Prefix><MaxUploads>1000</MaxUploads>"
+        "<IsTruncated>false</IsTruncated>" + Repeat(count, [](int64_t i) {
+        return "<Upload><Key>multipart/object-" + std::to_string(i) + ".data</Key><UploadId>0004B999EF518A1FE585B0C9360D" +
+            std::to_string(i) + "</UploadId><Initiated>2012-02-23T04:18:23.000Z</Initiated></Upload>"; }) +
+        "</ListMultipartUploadsResult>";
+}
+
+std::string ListPartsXml(int64_t count)
+{
+    return std::string(XML_HEAD) + "<ListPartsResult>"
+        "<Bucket>bucket</Bucket><Key>multipart.data</Key><UploadId>0004B999EF5A239BB9138C6227D69F95</UploadId>"
+        "<NextPartNumberMarker>" + std::to_string(count) + "</NextPartNumberMarker><MaxParts>1000</MaxParts>"
+        "<IsTruncated>false</IsTruncated>" + Repeat(count, [](int64_t i) {
+        return "<Part><PartNumber>" + std::to_string(i + 1) + "</PartNumber><LastModified>2012-02-23T07:01:34.000Z</LastModified>"
+            "<ETag>&quot;3349DC700140D7F86A0784842780****&quot;</ETag><HashCrc64ecma>" + std::to_string(1000 + i) +
+            "</HashCrc64ecma><Size>6291456</Size></Part>"; }) + "</ListPartsResult>";
+}
+
+/* the results which also take the response headers */
+template <typename R>
+R ParseStream(const std::shared_ptr<std::iostream>& content)
+{
+    return R(content);
+}
+
+template <>
+CompleteMultipartUploadResult ParseStream<CompleteMultipartUploadResult>(const std::shared_ptr<std::iostream>& content)
+{
+    return CompleteMultipartUploadResult(content, HeaderCollection());
+}
+
+template <>
+UploadPartCopyResult ParseStream<UploadPartCopyResult>(const std::shared_ptr<std::iostream>& content)
+{
+    return UploadPartCopyResult(content, HeaderCollection());
+}
+
+/* ParseDone is only visible to the results themselves */
+template <typename R>
+class ParsedResult : public R
+{
+public:
+    explicit ParsedResult(const R& result) : R(result) {}
+    bool parsed() { return this->ParseDone(); }
+};
+
+template <typename R, std::string (*MakeXml)(int64_t)>
+void ParseStreamBenchmark(State& state)
+{
+    std::string xml = MakeXml(state.Arg());
+    if (!ParsedResult<R>(ParseStream<R>(std::make_shared<std::stringstream>(xml))).parsed()) {
+        state.setLabel("not parsed");
+    }
+    while (state.KeepRunning()) {
+        auto content = std::make_shared<std::stringstream>(xml);
+        R result = ParseStream<R>(content);
+        DoNotOptimize(result);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations() * xml.size()));
+}
+
+template <typename R, std::string (*MakeXml)(int64_t)>
+void ViaStringBenchmark(State& state)
+{
+    std::string xml = MakeXml(state.Arg());
+    while (state.KeepRunning()) {
+        auto content = std::make_shared<std::stringstream>(xml);
+        std::istreambuf_iterator<char> isb(*content), end;
+        std::string data(isb, end);
+        R result(data);
+        DoNotOptimize(result);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations() * xml.size()));
+}
+}
+
+#define RESULT_PARSE_BENCHMARK(Result, MakeXml) \
+    static Benchmark* OSS_BENCHMARK_CONCAT(stream_benchmark_, __LINE__) OSS_BENCHMARK_UNUSED = \
+        RegisterBenchmark("BM_" #Result "_ParseStream", &ParseStreamBenchmark<Result, MakeXml>); \
+    static Benchmark* OSS_BENCHMARK_CONCAT(string_benchmark_, __LINE__) OSS_BENCHMARK_UNUSED = \
+        RegisterBenchmark("BM_" #Result "_ViaString", &ViaStringBenchmark<Result, MakeXml>)
+
+#define RESULT_LIST_PARSE_BENCHMARK(Result, MakeXml) \
+    static Benchmark* OSS_BENCHMARK_CONCAT(stream_benchmark_, __LINE__) OSS_BENCHMARK_UNUSED = \
+        RegisterBenchmark("BM_" #Result "_ParseStream", &ParseStreamBenchmark<Result, MakeXml>)->Args({ 10, 1000 }); \
+    static Benchmark* OSS_BENCHMARK_CONCAT(string_benchmark_, __LINE__) OSS_BENCHMARK_UNUSED = \
+        RegisterBenchmark("BM_" #Result "_ViaString", &ViaStringBenchmark<Result, MakeXml>)->Args({ 10, 1000 })
+
+RESULT_PARSE_BENCHMARK(CompleteMultipartUploadResult, CompleteMultipartUploadXml);
+RESULT_PARSE_BENCHMARK(CopyObjectResult, CopyObjectXml);
+RESULT_LIST_PARSE_BENCHMARK(DeleteObjectVersionsResult, DeleteObjectVersionsXml);
+RESULT_LIST_PARSE_BENCHMARK(DeleteObjectsResult, DeleteObjectsXml);
+RESULT_PARSE_BENCHMARK(GetBucketAclResult, AclXml);
+RESULT_LIST_PARSE_BENCHMARK(GetBucketCorsResult, CorsXml);
+RESULT_PARSE_BENCHMARK(GetBucketEncryptionResult, EncryptionXml);
+RESULT_PARSE_BENCHMARK(GetBucketInfoResult, BucketInfoXml);
+RESULT_PARSE_BENCHMARK(GetBucketInventoryConfigurationResult, InventoryXml);
+RESULT_LIST_PARSE_BENCHMARK(GetBucketLifecycleResult, LifecycleXml);
+RESULT_PARSE_BENCHMARK(GetBucketLocationResult, LocationXml);
+RESULT_PARSE_BENCHMARK(GetBucketLoggingResult, LoggingXml);
+RESULT_PARSE_BENCHMARK(GetBucketPaymentResult, PaymentXml);
+RESULT_PARSE_BENCHMARK(GetBucketQosInfoResult, QosXml);
+RESULT_LIST_PARSE_BENCHMARK(GetBucketRefererResult, RefererXml);
+RESULT_PARSE_BENCHMARK(GetBucketStatResult, StatXml);
+RESULT_PARSE_BENCHMARK(GetBucketStorageCapacityResult, StorageCapacityXml);
+RESULT_LIST_PARSE_BENCHMARK(GetBucketTaggingResult, TaggingXml);
+RESULT_PARSE_BENCHMARK(GetBucketVersioningResult, VersioningXml);
+RESULT_PARSE_BENCHMARK(GetBucketWebsiteResult, WebsiteXml);
+RESULT_PARSE_BENCHMARK(GetBucketWormResult, WormXml);
+RESULT_LIST_PARSE_BENCHMARK(GetLiveChannelHistoryResult, LiveChannelHistoryXml);
+RESULT_PARSE_BENCHMARK(GetLiveChannelInfoResult, LiveChannelInfoXml);
+RESULT_PARSE_BENCHMARK(GetLiveChannelStatResult, LiveChannelStatXml);
+RESULT_PARSE_BENCHMARK(GetObjectAclResult, AclXml);
+RESULT_LIST_PARSE_BENCHMARK(GetObjectTaggingResult, TaggingXml);
+RESULT_PARSE_BENCHMARK(GetUserQosInfoResult, UserQosXml);
+RESULT_PARSE_BENCHMARK(InitiateMultipartUploadResult, InitiateMultipartUploadXml);
+RESULT_LIST_PARSE_BENCHMARK(ListBucketsResult, ListBucketsXml);
+RESULT_LIST_PARSE_BENCHMARK(ListLiveChannelResult, ListLiveChannelXml);
+RESULT_LIST_PARSE_BENCHMARK(ListMultipartUploadsResult, ListMultipartUploadsXml);
+RESULT_LIST_PARSE_BENCHMARK(ListPartsResult, ListPartsXml);
+RESULT_PARSE_BENCHMARK(PutLiveChannelResult, PutLiveChannelXml);
+RESULT_PARSE_BENCHMARK(UploadPartCopyResult, UploadPartCopyXml);
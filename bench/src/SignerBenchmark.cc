@@ -0,0 +1,68 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <alibabacloud/oss/auth/CredentialsProvider.h>
+#include <src/signer/Signer.h>
+#include <memory>
+#include <string>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+/* an UploadPart request, the arg is the number of extra x-oss-meta headers */
+static std::shared_ptr<HttpRequest> MakeRequest(int64_t metaCount)
+{
+    auto httpRequest = std::make_shared<HttpRequest>(Http::Method::Put);
+    httpRequest->addHeader(Http::CONTENT_TYPE, "application/octet-stream");
+    httpRequest->addHeader(Http::CONTENT_LENGTH, "8388608");
+    httpRequest->addHeader(Http::CONTENT_MD5, "1B2M2Y8AsgTpgAmY7PhCfg==");
+    httpRequest->addHeader("x-oss-content-sha256", "UNSIGNED-PAYLOAD");
+    for (int64_t i = 0; i < metaCount; i++) {
+        httpRequest->addHeader("x-oss-meta-key" + std::to_string(i), "value" + std::to_string(i));
+    }
+    return httpRequest;
+}
+
+static void RunSign(State& state, SignatureVersionType version)
+{
+    auto signer = Signer::createSigner(version);
+    auto httpRequest = MakeRequest(state.Arg());
+    ParameterCollection parameters;
+    parameters["partNumber"] = "12";
+    parameters["uploadId"] = "0004B9895DBBB6EC98E36";
+    SignerParam signerParam(std::string("cn-hangzhou"), std::string("oss"),
+        std::string("bucket"), std::string("photos/2024/IMG_0001.jpg"),
+        Credentials("ak", "sk", ""), 1702743657LL);
+
+    while (state.KeepRunning()) {
+        signer->sign(httpRequest, parameters, signerParam);
+    }
+    DoNotOptimize(httpRequest->Header(Http::AUTHORIZATION));
+    state.setItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+
+static void BM_SignerV1_Sign(State& state)
+{
+    RunSign(state, SignatureVersionType::V1);
+}
+OSS_BENCHMARK(BM_SignerV1_Sign)->Args({ 0, 8 });
+
+static void BM_SignerV4_Sign(State& state)
+{
+    RunSign(state, SignatureVersionType::V4);
+}
+OSS_BENCHMARK(BM_SignerV4_Sign)->Args({ 0, 8 });
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include <src/utils/Utils.h>
+#include <string>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::Bench;
+
+static std::string MakeData(int64_t size)
+{
+    std::string data;
+    data.reserve(static_cast<size_t>(size));
+    for (int64_t i = 0; i < size; i++) {
+        data.push_back(static_cast<char>(i * 131 + 7));
+    }
+    return data;
+}
+
+/* an object key with the characters which need escaping: spaces, reserved and multi-byte ones */
+static std::string MakeKey(int64_t size)
+{
+    static const std::string segment = "photos/2024 summer/IMG_0001+copy(1)&v=2/\xE6\xB5\x8B\xE8\xAF\x95.jpg";
+    std::string key;
+    while (key.size() < static_cast<size_t>(size)) {
+        key.append(segment);
+    }
+    key.resize(static_cast<size_t>(size));
+    return key;
+}
+
+static void BM_ComputeContentMD5(State& state)
+{
+    std::string data = MakeData(state.Arg());
+    while (state.KeepRunning()) {
+        auto md5 = ComputeContentMD5(data.data(), data.size());
+        DoNotOptimize(md5);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_ComputeContentMD5)->Args({ 64, 4096, 1024 * 1024 });
+
+static void BM_UrlEncode(State& state)
+{
+    std::string key = MakeKey(state.Arg());
+    while (state.KeepRunning()) {
+        auto encoded = UrlEncode(key);
+        DoNotOptimize(encoded);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_UrlEncode)->Args({ 32, 256, 1024 });
+
+static void BM_UrlDecode(State& state)
+{
+    std::string encoded = UrlEncode(MakeKey(state.Arg()));
+    while (state.KeepRunning()) {
+        auto decoded = UrlDecode(encoded);
+        DoNotOptimize(decoded);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * static_cast<int64_t>(encoded.size()));
+}
+OSS_BENCHMARK(BM_UrlDecode)->Args({ 32, 256, 1024 });
+
+static void BM_Base64Encode(State& state)
+{
+    std::string data = MakeData(state.Arg());
+    while (state.KeepRunning()) {
+        auto encoded = Base64Encode(data);
+        DoNotOptimize(encoded);
+    }
+    state.setBytesProcessed(static_cast<int64_t>(state.Iterations()) * state.Arg());
+}
+OSS_BENCHMARK(BM_Base64Encode)->Args({ 16, 256, 64 * 1024 });
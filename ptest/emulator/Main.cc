@@ -0,0 +1,84 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OssEmulator.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+using namespace AlibabaCloud::OSS::PTest;
+
+static std::atomic<bool> stopRequested(false);
+
+static void OnSignal(int)
+{
+    stopRequested = true;
+}
+
+static void PrintHelp()
+{
+    std::cout << "\n";
+    std::cout << "Usage: cpp-sdk-emulator [-h] [--host HOST] [--port PORT]      \n";
+    std::cout << "Optional arguments:      \n";
+    std::cout << "  -h, --help          show this help message and exit.           \n";
+    std::cout << "  --host HOST         address to listen on, default is 127.0.0.1.   \n";
+    std::cout << "  --port PORT         port to listen on, default is 8086.        \n";
+}
+
+int main(int argc, char **argv)
+{
+    std::string host = "127.0.0.1";
+    int port = 8086;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp("--help", argv[i]) || !strcmp("-h", argv[i])) {
+            PrintHelp();
+            return 0;
+        }
+        else if (!strcmp("--host", argv[i]) && i + 1 < argc) {
+            host = argv[++i];
+        }
+        else if (!strcmp("--port", argv[i]) && i + 1 < argc) {
+            port = std::atoi(argv[++i]);
+        }
+    }
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    AlibabaCloud::OSS::InitializeSdk();
+    OssEmulator emulator(host, port);
+    if (!emulator.start()) {
+        std::cout << "Start the emulator on " << host << ":" << port << " fail." << std::endl;
+        AlibabaCloud::OSS::ShutdownSdk();
+        return 1;
+    }
+    std::cout << "OSS emulator is serving on " << emulator.Endpoint() << ", press Ctrl+C to stop." << std::endl;
+
+    while (!stopRequested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    emulator.stop();
+    std::cout << "OSS emulator stopped, served " << emulator.RequestCount() << " requests." << std::endl;
+    AlibabaCloud::OSS::ShutdownSdk();
+    return 0;
+}
@@ -0,0 +1,1007 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OssEmulator.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::PTest;
+
+std::string OssEmulator::Request::param(const std::string& name) const
+{
+    auto it = params.find(name);
+    return it == params.end() ? std::string() : it->second;
+}
+
+std::string OssEmulator::Request::header(const std::string& name) const
+{
+    auto it = headers.find(name);
+    return it == headers.end() ? std::string() : it->second;
+}
+
+namespace
+{
+    const size_t RECV_BUFFER_SIZE = 64 * 1024;
+
+    std::string ToLower(std::string str)
+    {
+        std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return static_cast<char>(::tolower(c)); });
+        return str;
+    }
+
+    std::string Trim(const std::string& str)
+    {
+        size_t b = str.find_first_not_of(" \t");
+        if (b == std::string::npos) {
+            return std::string();
+        }
+        size_t e = str.find_last_not_of(" \t");
+        return str.substr(b, e - b + 1);
+    }
+
+    std::string XmlEscape(const std::string& str)
+    {
+        std::string out;
+        out.reserve(str.size());
+        for (char c : str) {
+            switch (c) {
+            case '&': out.append("&amp;"); break;
+            case '<': out.append("&lt;"); break;
+            case '>': out.append("&gt;"); break;
+            case '"': out.append("&quot;"); break;
+            case '\'': out.append("&apos;"); break;
+            default: out.push_back(c); break;
+            }
+        }
+        return out;
+    }
+
+    std::string XmlUnescape(const std::string& str)
+    {
+        static const std::pair<const char*, char> entities[] = {
+            { "&amp;", '&' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&quot;", '"' }, { "&apos;", '\'' } };
+        std::string out;
+        out.reserve(str.size());
+        for (size_t i = 0; i < str.size(); i++) {
+            bool replaced = false;
+            if (str[i] == '&') {
+                for (const auto& entity : entities) {
+                    size_t len = std::strlen(entity.first);
+                    if (str.compare(i, len, entity.first) == 0) {
+                        out.push_back(entity.second);
+                        i += len - 1;
+                        replaced = true;
+                        break;
+                    }
+                }
+            }
+            if (!replaced) {
+                out.push_back(str[i]);
+            }
+        }
+        return out;
+    }
+
+    /* returns the text of every <tag> element found after pos, in document order */
+    std::vector<std::string> XmlValues(const std::string& xml, const std::string& tag)
+    {
+        std::vector<std::string> values;
+        std::string open = "<" + tag + ">";
+        std::string close = "</" + tag + ">";
+        size_t pos = 0;
+        while ((pos = xml.find(open, pos)) != std::string::npos) {
+            pos += open.size();
+            size_t end = xml.find(close, pos);
+            if (end == std::string::npos) {
+                break;
+            }
+            values.push_back(XmlUnescape(xml.substr(pos, end - pos)));
+            pos = end + close.size();
+        }
+        return values;
+    }
+
+    std::string StripETag(const std::string& eTag)
+    {
+        std::string value = XmlUnescape(eTag);
+        value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+        return value;
+    }
+
+    std::string GmtTime(std::time_t t)
+    {
+        return ToGmtTime(t);
+    }
+
+    std::string UtcTime(std::time_t t)
+    {
+        return ToUtcTime(t);
+    }
+
+    bool SendAll(int fd, const std::string& header, const char* data, size_t size)
+    {
+        size_t headerSent = 0;
+        size_t dataSent = 0;
+        while (headerSent < header.size() || dataSent < size) {
+            struct iovec iov[2];
+            int cnt = 0;
+            if (headerSent < header.size()) {
+                iov[cnt].iov_base = const_cast<char*>(header.data() + headerSent);
+                iov[cnt].iov_len = header.size() - headerSent;
+                cnt++;
+            }
+            if (dataSent < size) {
+                iov[cnt].iov_base = const_cast<char*>(data + dataSent);
+                iov[cnt].iov_len = size - dataSent;
+                cnt++;
+            }
+            struct msghdr msg;
+            std::memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = iov;
+            msg.msg_iovlen = cnt;
+            ssize_t n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            size_t sent = static_cast<size_t>(n);
+            size_t h = std::min(sent, header.size() - headerSent);
+            headerSent += h;
+            dataSent += sent - h;
+        }
+        return true;
+    }
+
+    const char* StatusText(int status)
+    {
+        switch (status) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 206: return "Partial Content";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 416: return "Requested Range Not Satisfiable";
+        case 501: return "Not Implemented";
+        default: return "Unknown";
+        }
+    }
+}
+
+OssEmulator::OssEmulator(const std::string& host, int port) :
+    host_(host),
+    port_(port),
+    listenFd_(-1),
+    running_(false),
+    requestCount_(0),
+    uploadSeq_(0)
+{
+}
+
+OssEmulator::~OssEmulator()
+{
+    stop();
+}
+
+std::string OssEmulator::Endpoint() const
+{
+    return "http://" + host_ + ":" + std::to_string(port_);
+}
+
+bool OssEmulator::start()
+{
+    if (running_) {
+        return true;
+    }
+
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    struct sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port_));
+    if (::inet_pton(AF_INET, host_.c_str(), &addr.sin_addr) != 1 ||
+        ::bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(fd, 128) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    socklen_t len = sizeof(addr);
+    ::getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+    listenFd_ = fd;
+    running_ = true;
+    acceptThread_ = std::thread(&OssEmulator::acceptLoop, this);
+    return true;
+}
+
+void OssEmulator::stop()
+{
+    if (!running_) {
+        return;
+    }
+    running_ = false;
+    ::shutdown(listenFd_, SHUT_RDWR);
+    ::close(listenFd_);
+    listenFd_ = -1;
+    if (acceptThread_.joinable()) {
+        acceptThread_.join();
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(connMtx_);
+        for (const auto& conn : connections_) {
+            ::shutdown(conn.first, SHUT_RDWR);
+        }
+    }
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lck(connMtx_);
+            if (connections_.empty()) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (auto& t : finished_) {
+        t.join();
+    }
+    finished_.clear();
+}
+
+void OssEmulator::putObject(const std::string& bucket, const std::string& key, std::string&& data)
+{
+    Object object;
+    object.crc64 = ComputeCRC64(0, const_cast<char*>(data.data()), data.size());
+    object.eTag = ComputeContentETag(data.data(), data.size());
+    object.lastModified = std::time(nullptr);
+    object.contentType = "application/octet-stream";
+    object.data = std::make_shared<const std::string>(std::move(data));
+
+    std::unique_lock<std::mutex> lck(dataMtx_);
+    buckets_[bucket][key] = std::move(object);
+}
+
+void OssEmulator::acceptLoop()
+{
+    while (running_) {
+        int fd = ::accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) {
+            if (!running_) {
+                break;
+            }
+            continue;
+        }
+        int on = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        std::unique_lock<std::mutex> lck(connMtx_);
+        for (auto& t : finished_) {
+            t.join();
+        }
+        finished_.clear();
+        connections_[fd] = std::thread(&OssEmulator::serveConnection, this, fd);
+    }
+}
+
+void OssEmulator::serveConnection(int fd)
+{
+    std::string buffer;
+    std::vector<char> chunk(RECV_BUFFER_SIZE);
+    bool keepAlive = true;
+
+    auto fill = [&]() -> bool {
+        ssize_t n = ::recv(fd, chunk.data(), chunk.size(), 0);
+        if (n <= 0) {
+            return false;
+        }
+        buffer.append(chunk.data(), static_cast<size_t>(n));
+        return true;
+    };
+
+    while (keepAlive && running_) {
+        size_t headerEnd;
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            if (!fill()) {
+                keepAlive = false;
+                break;
+            }
+        }
+        if (!keepAlive) {
+            break;
+        }
+
+        Request req;
+        std::istringstream head(buffer.substr(0, headerEnd));
+        buffer.erase(0, headerEnd + 4);
+
+        std::string line;
+        std::getline(head, line);
+        std::istringstream requestLine(line);
+        std::string target;
+        requestLine >> req.method >> target;
+        while (std::getline(head, line)) {
+            size_t colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+            std::string value = Trim(line.substr(colon + 1));
+            if (!value.empty() && value.back() == '\r') {
+                value.pop_back();
+            }
+            req.headers[ToLower(line.substr(0, colon))] = value;
+        }
+
+        if (ToLower(req.header("expect")) == "100-continue") {
+            SendAll(fd, "HTTP/1.1 100 Continue\r\n\r\n", nullptr, 0);
+        }
+
+        if (ToLower(req.header("transfer-encoding")) == "chunked") {
+            while (keepAlive) {
+                size_t eol;
+                while ((eol = buffer.find("\r\n")) == std::string::npos) {
+                    if (!fill()) { keepAlive = false; break; }
+                }
+                if (!keepAlive) {
+                    break;
+                }
+                size_t size = std::strtoul(buffer.c_str(), nullptr, 16);
+                buffer.erase(0, eol + 2);
+                while (buffer.size() < size + 2) {
+                    if (!fill()) { keepAlive = false; break; }
+                }
+                if (!keepAlive) {
+                    break;
+                }
+                req.body.append(buffer, 0, size);
+                buffer.erase(0, size + 2);
+                if (size == 0) {
+                    break;
+                }
+            }
+        }
+        else {
+            size_t length = std::strtoull(req.header("content-length").c_str(), nullptr, 10);
+            req.body.reserve(length);
+            size_t take = std::min(length, buffer.size());
+            req.body.append(buffer, 0, take);
+            buffer.erase(0, take);
+            while (req.body.size() < length) {
+                ssize_t n = ::recv(fd, chunk.data(), std::min(chunk.size(), length - req.body.size()), 0);
+                if (n <= 0) {
+                    keepAlive = false;
+                    break;
+                }
+                req.body.append(chunk.data(), static_cast<size_t>(n));
+            }
+        }
+        if (!keepAlive) {
+            break;
+        }
+
+        Response resp;
+        serve(target, req, resp);
+        keepAlive = ToLower(req.header("connection")) != "close";
+
+        size_t bodySize = resp.Size();
+        std::stringstream ss;
+        ss << "HTTP/1.1 " << resp.status << " " << StatusText(resp.status) << "\r\n";
+        ss << "Server: OssEmulator\r\n";
+        for (const auto& h : resp.headers) {
+            ss << h.first << ": " << h.second << "\r\n";
+        }
+        ss << "Content-Length: " << bodySize << "\r\n";
+        ss << "Connection: " << (keepAlive ? "keep-alive" : "close") << "\r\n\r\n";
+
+        const char* data = nullptr;
+        size_t size = 0;
+        if (!resp.headOnly) {
+            data = resp.Data();
+            size = bodySize;
+        }
+        if (!SendAll(fd, ss.str(), data, size)) {
+            break;
+        }
+    }
+
+    /* the entry goes first, accept may hand out the same fd as soon as it is closed */
+    {
+        std::unique_lock<std::mutex> lck(connMtx_);
+        auto it = connections_.find(fd);
+        if (it != connections_.end()) {
+            finished_.push_back(std::move(it->second));
+            connections_.erase(it);
+        }
+    }
+    ::close(fd);
+}
+
+void OssEmulator::serve(const std::string& target, Request& req, Response& resp)
+{
+    size_t qpos = target.find('?');
+    std::string path = target.substr(0, qpos);
+    if (qpos != std::string::npos) {
+        std::istringstream query(target.substr(qpos + 1));
+        std::string item;
+        while (std::getline(query, item, '&')) {
+            size_t eq = item.find('=');
+            if (eq == std::string::npos) {
+                req.params[UrlDecode(item)] = "";
+            }
+            else {
+                req.params[UrlDecode(item.substr(0, eq))] = UrlDecode(item.substr(eq + 1));
+            }
+        }
+    }
+    if (path.size() > 1) {
+        size_t slash = path.find('/', 1);
+        req.bucket = UrlDecode(path.substr(1, slash == std::string::npos ? std::string::npos : slash - 1));
+        if (slash != std::string::npos) {
+            req.key = UrlDecode(path.substr(slash + 1));
+        }
+    }
+
+    dispatch(req, resp);
+    std::time_t now = std::time(nullptr);
+    std::stringstream id;
+    id << std::hex << requestCount_++;
+    resp.addHeader("Date", GmtTime(now));
+    resp.addHeader("x-oss-request-id", id.str());
+}
+
+void OssEmulator::dispatch(const Request& req, Response& resp)
+{
+    if (req.bucket.empty()) {
+        setError(resp, 501, "NotImplemented", "Service level operations are not supported.");
+        return;
+    }
+
+    if (req.key.empty()) {
+        if (req.method == "GET" && !req.hasParam("uploads")) {
+            listObjects(req, resp);
+        }
+        else if (req.method == "POST" && req.hasParam("delete")) {
+            deleteObjects(req, resp);
+        }
+        else if (req.method == "PUT" && req.params.empty()) {
+            std::unique_lock<std::mutex> lck(dataMtx_);
+            buckets_[req.bucket];
+        }
+        else {
+            setError(resp, 501, "NotImplemented", "The bucket operation is not supported.");
+        }
+        return;
+    }
+
+    if (req.method == "PUT") {
+        if (req.hasParam("uploadId") && req.hasParam("partNumber")) {
+            uploadPart(req, resp);
+        }
+        else if (req.params.empty() && req.header("x-oss-copy-source").empty()) {
+            putObject(req, resp);
+        }
+        else {
+            setError(resp, 501, "NotImplemented", "The object operation is not supported.");
+        }
+    }
+    else if (req.method == "GET") {
+        if (req.hasParam("uploadId")) {
+            listParts(req, resp);
+        }
+        else {
+            getObject(req, resp, false);
+        }
+    }
+    else if (req.method == "HEAD") {
+        getObject(req, resp, true);
+    }
+    else if (req.method == "POST") {
+        if (req.hasParam("uploads")) {
+            initiateMultipartUpload(req, resp);
+        }
+        else if (req.hasParam("uploadId")) {
+            completeMultipartUpload(req, resp);
+        }
+        else {
+            setError(resp, 501, "NotImplemented", "The object operation is not supported.");
+        }
+    }
+    else if (req.method == "DELETE") {
+        if (req.hasParam("uploadId")) {
+            abortMultipartUpload(req, resp);
+        }
+        else {
+            deleteObject(req, resp);
+        }
+    }
+    else {
+        setError(resp, 501, "NotImplemented", "The method is not supported.");
+    }
+}
+
+void OssEmulator::setError(Response& resp, int status, const std::string& code, const std::string& message)
+{
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<Error>\n"
+       << "  <Code>" << code << "</Code>\n"
+       << "  <Message>" << XmlEscape(message) << "</Message>\n"
+       << "  <RequestId>" << std::hex << requestCount_.load() << std::dec << "</RequestId>\n"
+       << "  <HostId>" << host_ << "</HostId>\n"
+       << "</Error>\n";
+    resp.status = status;
+    resp.headers.clear();
+    resp.payload = nullptr;
+    resp.addHeader("Content-Type", "application/xml");
+    resp.body = ss.str();
+}
+
+void OssEmulator::putObject(const Request& req, Response& resp)
+{
+    Object object;
+    object.crc64 = ComputeCRC64(0, const_cast<char*>(req.body.data()), req.body.size());
+    object.eTag = ComputeContentETag(req.body.data(), req.body.size());
+    object.lastModified = std::time(nullptr);
+    object.contentType = req.header("content-type");
+    for (const auto& h : req.headers) {
+        if (h.first.compare(0, 11, "x-oss-meta-") == 0) {
+            object.userMeta[h.first] = h.second;
+        }
+    }
+    object.data = std::make_shared<const std::string>(req.body);
+
+    resp.addHeader("ETag", "\"" + object.eTag + "\"");
+    resp.addHeader("x-oss-hash-crc64ecma", std::to_string(object.crc64));
+
+    std::unique_lock<std::mutex> lck(dataMtx_);
+    buckets_[req.bucket][req.key] = std::move(object);
+}
+
+void OssEmulator::getObject(const Request& req, Response& resp, bool headOnly)
+{
+    Object object;
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        auto bucket = buckets_.find(req.bucket);
+        if (bucket == buckets_.end()) {
+            setError(resp, 404, "NoSuchBucket", "The specified bucket does not exist.");
+            resp.headOnly = headOnly;
+            return;
+        }
+        auto it = bucket->second.find(req.key);
+        if (it == bucket->second.end()) {
+            setError(resp, 404, "NoSuchKey", "The specified key does not exist.");
+            resp.headOnly = headOnly;
+            return;
+        }
+        object = it->second;
+    }
+
+    size_t size = object.data->size();
+    size_t start = 0;
+    size_t end = size;
+    std::string range = req.header("range");
+    if (range.compare(0, 6, "bytes=") == 0 && range.find(',') == std::string::npos) {
+        std::string spec = range.substr(6);
+        size_t dash = spec.find('-');
+        if (dash != std::string::npos) {
+            std::string first = spec.substr(0, dash);
+            std::string last = spec.substr(dash + 1);
+            bool valid = true;
+            size_t rangeStart = 0;
+            size_t rangeEnd = size;
+            if (first.empty()) {
+                size_t suffix = std::strtoull(last.c_str(), nullptr, 10);
+                valid = !last.empty() && suffix > 0;
+                rangeStart = size - std::min(suffix, size);
+            }
+            else {
+                rangeStart = std::strtoull(first.c_str(), nullptr, 10);
+                if (!last.empty()) {
+                    rangeEnd = std::strtoull(last.c_str(), nullptr, 10) + 1;
+                    valid = rangeEnd > rangeStart;
+                }
+            }
+            /* a suffix range of an empty object starts past its end as well */
+            if (valid && rangeStart >= size) {
+                setError(resp, 416, "InvalidRange", "The requested range cannot be satisfied.");
+                resp.headOnly = headOnly;
+                return;
+            }
+            /* like OSS, an invalid range returns the whole object */
+            if (valid) {
+                start = rangeStart;
+                end = std::min(rangeEnd, size);
+                resp.status = 206;
+                resp.addHeader("Content-Range", "bytes " + std::to_string(start) + "-" +
+                    std::to_string(end - 1) + "/" + std::to_string(size));
+            }
+        }
+    }
+
+    resp.addHeader("ETag", "\"" + object.eTag + "\"");
+    resp.addHeader("Last-Modified", GmtTime(object.lastModified));
+    resp.addHeader("Content-Type", object.contentType.empty() ? "application/octet-stream" : object.contentType);
+    resp.addHeader("Accept-Ranges", "bytes");
+    resp.addHeader("x-oss-object-type", object.eTag.find('-') == std::string::npos ? "Normal" : "Multipart");
+    resp.addHeader("x-oss-storage-class", "Standard");
+    resp.addHeader("x-oss-hash-crc64ecma", std::to_string(object.crc64));
+    for (const auto& meta : object.userMeta) {
+        resp.addHeader(meta.first, meta.second);
+    }
+    resp.payload = object.data;
+    resp.offset = start;
+    resp.length = end - start;
+    resp.headOnly = headOnly;
+}
+
+void OssEmulator::deleteObject(const Request& req, Response& resp)
+{
+    std::unique_lock<std::mutex> lck(dataMtx_);
+    auto bucket = buckets_.find(req.bucket);
+    if (bucket != buckets_.end()) {
+        bucket->second.erase(req.key);
+    }
+    resp.status = 204;
+}
+
+void OssEmulator::deleteObjects(const Request& req, Response& resp)
+{
+    auto keys = XmlValues(req.body, "Key");
+    auto quiet = XmlValues(req.body, "Quiet");
+    bool isQuiet = !quiet.empty() && quiet[0] == "true";
+    bool urlEncoding = req.param("encoding-type") == "url";
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<DeleteResult>\n";
+    if (urlEncoding) {
+        ss << "  <EncodingType>url</EncodingType>\n";
+    }
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        auto bucket = buckets_.find(req.bucket);
+        for (const auto& key : keys) {
+            if (bucket != buckets_.end()) {
+                bucket->second.erase(key);
+            }
+            if (!isQuiet) {
+                ss << "  <Deleted><Key>" << XmlEscape(urlEncoding ? UrlEncode(key) : key) << "</Key></Deleted>\n";
+            }
+        }
+    }
+    ss << "</DeleteResult>\n";
+    resp.addHeader("Content-Type", "application/xml");
+    resp.body = ss.str();
+}
+
+void OssEmulator::listObjects(const Request& req, Response& resp)
+{
+    bool v2 = req.param("list-type") == "2";
+    bool urlEncoding = req.param("encoding-type") == "url";
+    std::string prefix = req.param("prefix");
+    std::string delimiter = req.param("delimiter");
+    std::string marker = v2 ? std::max(req.param("start-after"), req.param("continuation-token")) : req.param("marker");
+    int maxKeys = req.hasParam("max-keys") ? std::atoi(req.param("max-keys").c_str()) : 100;
+    maxKeys = std::max(1, std::min(maxKeys, 1000));
+
+    auto encode = [urlEncoding](const std::string& value) {
+        return XmlEscape(urlEncoding ? UrlEncode(value) : value);
+    };
+
+    std::stringstream contents;
+    std::string lastEntry;
+    std::string lastPrefix;
+    int count = 0;
+    bool truncated = false;
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        auto bucket = buckets_.find(req.bucket);
+        if (bucket == buckets_.end()) {
+            setError(resp, 404, "NoSuchBucket", "The specified bucket does not exist.");
+            return;
+        }
+        const auto& objects = bucket->second;
+        auto first = marker < prefix ? objects.lower_bound(prefix) : objects.upper_bound(marker);
+        for (auto it = first; it != objects.end(); ++it) {
+            const std::string& key = it->first;
+            if (key.compare(0, prefix.size(), prefix) != 0) {
+                if (key > prefix) {
+                    break;
+                }
+                continue;
+            }
+            std::string commonPrefix;
+            if (!delimiter.empty()) {
+                size_t pos = key.find(delimiter, prefix.size());
+                if (pos != std::string::npos) {
+                    commonPrefix = key.substr(0, pos + delimiter.size());
+                }
+            }
+            if (!commonPrefix.empty() && (commonPrefix == lastPrefix || commonPrefix <= marker)) {
+                continue;
+            }
+            if (count == maxKeys) {
+                truncated = true;
+                break;
+            }
+            count++;
+            if (!commonPrefix.empty()) {
+                lastPrefix = commonPrefix;
+                lastEntry = commonPrefix;
+                contents << "  <CommonPrefixes><Prefix>" << encode(commonPrefix) << "</Prefix></CommonPrefixes>\n";
+                /* skip the remaining keys of the common prefix */
+                std::string next = commonPrefix;
+                next.back() = static_cast<char>(next.back() + 1);
+                it = objects.lower_bound(next);
+                if (it == objects.end()) {
+                    break;
+                }
+                --it;
+                continue;
+            }
+            lastEntry = key;
+            const Object& object = it->second;
+            contents << "  <Contents>\n"
+                     << "    <Key>" << encode(key) << "</Key>\n"
+                     << "    <LastModified>" << UtcTime(object.lastModified) << "</LastModified>\n"
+                     << "    <ETag>&quot;" << object.eTag << "&quot;</ETag>\n"
+                     << "    <Type>" << (object.eTag.find('-') == std::string::npos ? "Normal" : "Multipart") << "</Type>\n"
+                     << "    <Size>" << object.data->size() << "</Size>\n"
+                     << "    <StorageClass>Standard</StorageClass>\n"
+                     << "  </Contents>\n";
+        }
+    }
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListBucketResult>\n"
+       << "  <Name>" << XmlEscape(req.bucket) << "</Name>\n"
+       << "  <Prefix>" << encode(prefix) << "</Prefix>\n"
+       << "  <MaxKeys>" << maxKeys << "</MaxKeys>\n"
+       << "  <Delimiter>" << encode(delimiter) << "</Delimiter>\n";
+    if (urlEncoding) {
+        ss << "  <EncodingType>url</EncodingType>\n";
+    }
+    ss << "  <IsTruncated>" << (truncated ? "true" : "false") << "</IsTruncated>\n";
+    if (v2) {
+        ss << "  <KeyCount>" << count << "</KeyCount>\n";
+        if (truncated) {
+            ss << "  <NextContinuationToken>" << encode(lastEntry) << "</NextContinuationToken>\n";
+        }
+    }
+    else {
+        ss << "  <Marker>" << encode(marker) << "</Marker>\n";
+        if (truncated) {
+            ss << "  <NextMarker>" << encode(lastEntry) << "</NextMarker>\n";
+        }
+    }
+    ss << contents.str() << "</ListBucketResult>\n";
+    resp.addHeader("Content-Type", "application/xml");
+    resp.body = ss.str();
+}
+
+void OssEmulator::initiateMultipartUpload(const Request& req, Response& resp)
+{
+    MultipartUpload upload;
+    upload.bucket = req.bucket;
+    upload.key = req.key;
+    upload.contentType = req.header("content-type");
+    for (const auto& h : req.headers) {
+        if (h.first.compare(0, 11, "x-oss-meta-") == 0) {
+            upload.userMeta[h.first] = h.second;
+        }
+    }
+
+    std::string uploadId;
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        std::stringstream id;
+        id << std::hex << std::uppercase << static_cast<uint64_t>(std::time(nullptr)) << "EMU" << ++uploadSeq_;
+        uploadId = id.str();
+        uploads_[uploadId] = std::move(upload);
+    }
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<InitiateMultipartUploadResult>\n"
+       << "  <Bucket>" << XmlEscape(req.bucket) << "</Bucket>\n"
+       << "  <Key>" << XmlEscape(req.key) << "</Key>\n"
+       << "  <UploadId>" << uploadId << "</UploadId>\n"
+       << "</InitiateMultipartUploadResult>\n";
+    resp.addHeader("Content-Type", "application/xml");
+    resp.body = ss.str();
+}
+
+void OssEmulator::uploadPart(const Request& req, Response& resp)
+{
+    int partNumber = std::atoi(req.param("partNumber").c_str());
+    if (partNumber < 1 || partNumber > 10000) {
+        setError(resp, 400, "InvalidArgument", "Part number must be an integer between 1 and 10000.");
+        return;
+    }
+
+    Part part;
+    part.crc64 = ComputeCRC64(0, const_cast<char*>(req.body.data()), req.body.size());
+    part.eTag = ComputeContentETag(req.body.data(), req.body.size());
+    part.lastModified = std::time(nullptr);
+    part.data = std::make_shared<const std::string>(req.body);
+
+    resp.addHeader("ETag", "\"" + part.eTag + "\"");
+    resp.addHeader("x-oss-hash-crc64ecma", std::to_string(part.crc64));
+
+    std::unique_lock<std::mutex> lck(dataMtx_);
+    auto it = uploads_.find(req.param("uploadId"));
+    if (it == uploads_.end()) {
+        lck.unlock();
+        setError(resp, 404, "NoSuchUpload", "The specified upload does not exist.");
+        return;
+    }
+    it->second.parts[partNumber] = std::move(part);
+}
+
+void OssEmulator::listParts(const Request& req, Response& resp)
+{
+    int marker = std::atoi(req.param("part-number-marker").c_str());
+    int maxParts = req.hasParam("max-parts") ? std::atoi(req.param("max-parts").c_str()) : 1000;
+    maxParts = std::max(1, std::min(maxParts, 1000));
+
+    std::stringstream parts;
+    int count = 0;
+    int nextMarker = marker;
+    bool truncated = false;
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        auto it = uploads_.find(req.param("uploadId"));
+        if (it == uploads_.end()) {
+            lck.unlock();
+            setError(resp, 404, "NoSuchUpload", "The specified upload does not exist.");
+            return;
+        }
+        for (auto p = it->second.parts.upper_bound(marker); p != it->second.parts.end(); ++p) {
+            if (count == maxParts) {
+                truncated = true;
+                break;
+            }
+            count++;
+            nextMarker = p->first;
+            parts << "  <Part>\n"
+                  << "    <PartNumber>" << p->first << "</PartNumber>\n"
+                  << "    <LastModified>" << UtcTime(p->second.lastModified) << "</LastModified>\n"
+                  << "    <ETag>&quot;" << p->second.eTag << "&quot;</ETag>\n"
+                  << "    <HashCrc64ecma>" << p->second.crc64 << "</HashCrc64ecma>\n"
+                  << "    <Size>" << p->second.data->size() << "</Size>\n"
+                  << "  </Part>\n";
+        }
+    }
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListPartsResult>\n"
+       << "  <Bucket>" << XmlEscape(req.bucket) << "</Bucket>\n"
+       << "  <Key>" << XmlEscape(req.key) << "</Key>\n"
+       << "  <UploadId>" << XmlEscape(req.param("uploadId")) << "</UploadId>\n"
+       << "  <PartNumberMarker>" << marker << "</PartNumberMarker>\n"
+       << "  <NextPartNumberMarker>" << nextMarker << "</NextPartNumberMarker>\n"
+       << "  <MaxParts>" << maxParts << "</MaxParts>\n"
+       << "  <IsTruncated>" << (truncated ? "true" : "false") << "</IsTruncated>\n"
+       << parts.str()
+       << "</ListPartsResult>\n";
+    resp.addHeader("Content-Type", "application/xml");
+    resp.body = ss.str();
+}
+
+void OssEmulator::completeMultipartUpload(const Request& req, Response& resp)
+{
+    auto numbers = XmlValues(req.body, "PartNumber");
+    auto eTags = XmlValues(req.body, "ETag");
+    if (numbers.empty() || numbers.size() != eTags.size()) {
+        setError(resp, 400, "MalformedXML", "The XML you provided was not well-formed.");
+        return;
+    }
+
+    MultipartUpload upload;
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        auto it = uploads_.find(req.param("uploadId"));
+        if (it == uploads_.end()) {
+            lck.unlock();
+            setError(resp, 404, "NoSuchUpload", "The specified upload does not exist.");
+            return;
+        }
+        upload = it->second;
+    }
+
+    std::vector<const Part*> parts;
+    int lastNumber = 0;
+    size_t totalSize = 0;
+    std::string partETags;
+    for (size_t i = 0; i < numbers.size(); i++) {
+        int number = std::atoi(numbers[i].c_str());
+        auto part = upload.parts.find(number);
+        if (number <= lastNumber) {
+            setError(resp, 400, "InvalidPartOrder", "The list of parts was not in ascending order.");
+            return;
+        }
+        if (part == upload.parts.end() || part->second.eTag != StripETag(eTags[i])) {
+            setError(resp, 400, "InvalidPart", "One or more of the specified parts could not be found.");
+            return;
+        }
+        lastNumber = number;
+        totalSize += part->second.data->size();
+        partETags.append(part->second.eTag);
+        parts.push_back(&part->second);
+    }
+
+    std::string data;
+    data.reserve(totalSize);
+    for (const auto part : parts) {
+        data.append(*part->data);
+    }
+
+    Object object;
+    object.crc64 = ComputeCRC64(0, const_cast<char*>(data.data()), data.size());
+    object.eTag = ComputeContentETag(partETags.data(), partETags.size()) + "-" + std::to_string(parts.size());
+    object.lastModified = std::time(nullptr);
+    object.contentType = upload.contentType;
+    object.userMeta = upload.userMeta;
+    object.data = std::make_shared<const std::string>(std::move(data));
+    std::string eTag = object.eTag;
+    uint64_t crc64 = object.crc64;
+
+    {
+        std::unique_lock<std::mutex> lck(dataMtx_);
+        uploads_.erase(req.param("uploadId"));
+        buckets_[upload.bucket][upload.key] = std::move(object);
+    }
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<CompleteMultipartUploadResult>\n"
+       << "  <Location>" << Endpoint() << "/" << XmlEscape(req.bucket) << "/" << XmlEscape(req.key) << "</Location>\n"
+       << "  <Bucket>" << XmlEscape(req.bucket) << "</Bucket>\n"
+       << "  <Key>" << XmlEscape(req.key) << "</Key>\n"
+       << "  <ETag>&quot;" << eTag << "&quot;</ETag>\n"
+       << "</CompleteMultipartUploadResult>\n";
+    resp.addHeader("Content-Type", "application/xml");
+    resp.addHeader("x-oss-hash-crc64ecma", std::to_string(crc64));
+    resp.body = ss.str();
+}
+
+void OssEmulator::abortMultipartUpload(const Request& req, Response& resp)
+{
+    std::unique_lock<std::mutex> lck(dataMtx_);
+    if (uploads_.erase(req.param("uploadId")) == 0) {
+        lck.unlock();
+        setError(resp, 404, "NoSuchUpload", "The specified upload does not exist.");
+        return;
+    }
+    resp.status = 204;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+namespace PTest
+{
+    /*
+    * An in-memory stand-in for the OSS service, serving plain HTTP/1.1 on a local port.
+    * It implements the subset of the object API which the ptest commands use: PutObject,
+    * GetObject (with ranges), HeadObject, DeleteObject, DeleteObjects, ListObjects (v1 and v2)
+    * and the multipart upload calls. Requests are not authenticated and every bucket name
+    * is accepted, objects always carry the x-oss-hash-crc64ecma header.
+    */
+    class OssEmulator
+    {
+    public:
+        explicit OssEmulator(const std::string& host = "127.0.0.1", int port = 0);
+        ~OssEmulator();
+
+        /* binds and starts serving, port 0 picks a free port */
+        bool start();
+        void stop();
+        bool isRunning() const { return running_; }
+
+        int Port() const { return port_; }
+        std::string Endpoint() const;
+        uint64_t RequestCount() const { return requestCount_; }
+
+        /* stores an object directly, e.g. to seed the data for download benchmarks */
+        void putObject(const std::string& bucket, const std::string& key, std::string&& data);
+
+        struct Request
+        {
+            std::string method;
+            std::string bucket;
+            std::string key;
+            std::map<std::string, std::string> params;
+            /* the header names are in lower case */
+            std::map<std::string, std::string> headers;
+            std::string body;
+
+            bool hasParam(const std::string& name) const { return params.find(name) != params.end(); }
+            std::string param(const std::string& name) const;
+            std::string header(const std::string& name) const;
+        };
+
+        struct Response
+        {
+            int status;
+            std::vector<std::pair<std::string, std::string>> headers;
+            std::string body;
+            /* object data is sent from the stored buffer without a copy */
+            std::shared_ptr<const std::string> payload;
+            size_t offset;
+            size_t length;
+            bool headOnly;
+
+            Response() : status(200), offset(0), length(0), headOnly(false) {}
+            void addHeader(const std::string& name, const std::string& value) { headers.emplace_back(name, value); }
+            const char* Data() const { return payload ? payload->data() + offset : body.data(); }
+            size_t Size() const { return payload ? length : body.size(); }
+        };
+
+        /*
+        * serves one request without a socket, the target is the path with the query string.
+        * It is used by the socket server and by the in-process SimulatedHttpClient.
+        */
+        void serve(const std::string& target, Request& req, Response& resp);
+
+    private:
+        struct Object
+        {
+            std::shared_ptr<const std::string> data;
+            std::string eTag;
+            uint64_t crc64;
+            std::time_t lastModified;
+            std::string contentType;
+            std::map<std::string, std::string> userMeta;
+        };
+        struct Part
+        {
+            std::shared_ptr<const std::string> data;
+            std::string eTag;
+            uint64_t crc64;
+            std::time_t lastModified;
+        };
+        struct MultipartUpload
+        {
+            std::string bucket;
+            std::string key;
+            std::string contentType;
+            std::map<std::string, std::string> userMeta;
+            std::map<int, Part> parts;
+        };
+        void acceptLoop();
+        void serveConnection(int fd);
+        void dispatch(const Request& req, Response& resp);
+
+        void putObject(const Request& req, Response& resp);
+        void getObject(const Request& req, Response& resp, bool headOnly);
+        void deleteObject(const Request& req, Response& resp);
+        void deleteObjects(const Request& req, Response& resp);
+        void listObjects(const Request& req, Response& resp);
+        void initiateMultipartUpload(const Request& req, Response& resp);
+        void uploadPart(const Request& req, Response& resp);
+        void listParts(const Request& req, Response& resp);
+        void completeMultipartUpload(const Request& req, Response& resp);
+        void abortMultipartUpload(const Request& req, Response& resp);
+        void setError(Response& resp, int status, const std::string& code, const std::string& message);
+
+        std::string host_;
+        int port_;
+        int listenFd_;
+        std::atomic<bool> running_;
+        std::atomic<uint64_t> requestCount_;
+        std::thread acceptThread_;
+
+        std::mutex connMtx_;
+        std::map<int, std::thread> connections_;
+        std::vector<std::thread> finished_;
+
+        std::mutex dataMtx_;
+        std::map<std::string, std::map<std::string, Object>> buckets_;
+        std::map<std::string, MultipartUpload> uploads_;
+        uint64_t uploadSeq_;
+    };
+}
+}
+}
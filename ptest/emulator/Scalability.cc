@@ -0,0 +1,347 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OssEmulator.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <src/utils/LockProfiler.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::PTest;
+
+struct Options
+{
+    std::string command = "head";
+    std::string endpoint;
+    std::string bucket = "scalability";
+    std::vector<int> threads;
+    int64_t size = 4 * 1024;
+    double duration = 3.0;
+    unsigned maxConnections = 0;
+    std::string log = "off";
+    std::string jsonFile;
+};
+
+struct StepResult
+{
+    int threads;
+    double elapsedS;
+    uint64_t ops;
+    uint64_t errors;
+    std::vector<LockSiteStat> locks;
+};
+
+static FILE* LogSink = nullptr;
+
+/* a file sink, like an application logging to disk, but writing to the null device */
+static void NullLogCallback(LogLevel level, const std::string& stream)
+{
+    (void)level;
+    if (LogSink != nullptr) {
+        fwrite(stream.data(), 1, stream.size(), LogSink);
+    }
+}
+
+static void PrintHelp()
+{
+    std::cout << "\n";
+    std::cout << "Usage: cpp-sdk-scalability [-h] [-c head|get|put|resumable] [--size SIZE]      \n";
+    std::cout << "                           [--threads COUNTS] [--duration SEC] [--maxConnections N]      \n";
+    std::cout << "                           [--log off|sync|async] [--endpoint URL] [-b BUCKET] [--json FILE]      \n";
+    std::cout << "Optional arguments:      \n";
+    std::cout << "  -h, --help             show this help message and exit.           \n";
+    std::cout << "  -c COMMAND             the operation every thread issues in a loop, default is head. \n";
+    std::cout << "  --size SIZE            object size of get, put and resumable, default is 4096. \n";
+    std::cout << "  --threads COUNTS       comma separated thread counts, default is 1,2,4,... up to twice the cores. \n";
+    std::cout << "  --duration SEC         seconds to run each thread count, default is 3. \n";
+    std::cout << "  --maxConnections N     ClientConfiguration::maxConnections, default is the sdk default. \n";
+    std::cout << "  --log MODE             sdk logging at debug level to the null device, synchronous or asynchronous. \n";
+    std::cout << "  --endpoint URL         a running cpp-sdk-emulator, default is an in-process emulator. \n";
+    std::cout << "  -b BUCKET              bucket name, default is scalability. \n";
+    std::cout << "  --json FILE            write the results as json to FILE. \n";
+    std::cout << "\nAll the threads share one OssClient. The lock wait columns are the share of the thread\n";
+    std::cout << "time spent waiting on the lock, and the contended acquisitions per operation.\n";
+    std::cout << "\nExamples :  \n";
+    std::cout << "    cpp-sdk-scalability -c head --threads 1,8,32,96 \n";
+    std::cout << "    cpp-sdk-scalability -c resumable --size 1048576 --log sync \n";
+}
+
+static bool RunOperation(const OssClient& client, const Options& options, int threadId,
+    const std::string& localFile, const std::shared_ptr<std::string>& data)
+{
+    static const std::string ObjectKey = "scalability/object";
+    if (options.command == "head") {
+        return client.HeadObject(options.bucket, ObjectKey).isSuccess();
+    }
+    else if (options.command == "get") {
+        return client.GetObject(options.bucket, ObjectKey).isSuccess();
+    }
+    else if (options.command == "put") {
+        auto content = std::make_shared<std::stringstream>(*data);
+        return client.PutObject(options.bucket, "scalability/put-" + std::to_string(threadId), content).isSuccess();
+    }
+    UploadObjectRequest request(options.bucket, "scalability/resumable-" + std::to_string(threadId), localFile);
+    request.setPartSize((std::max)(options.size / 4, static_cast<int64_t>(100 * 1024)));
+    request.setThreadNum(4);
+    return client.ResumableUploadObject(request).isSuccess();
+}
+
+static StepResult RunStep(const OssClient& client, const Options& options, int threads,
+    const std::string& localFile, const std::shared_ptr<std::string>& data)
+{
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::atomic<bool> stop(false);
+    std::vector<uint64_t> ops(static_cast<size_t>(threads), 0);
+    std::vector<uint64_t> errors(static_cast<size_t>(threads), 0);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i]() {
+            // one request before the measurement, to grow the handle pool
+            RunOperation(client, options, i, localFile, data);
+            ready++;
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            uint64_t done = 0;
+            uint64_t failed = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!RunOperation(client, options, i, localFile, data)) {
+                    failed++;
+                }
+                done++;
+            }
+            ops[static_cast<size_t>(i)] = done;
+            errors[static_cast<size_t>(i)] = failed;
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    LockProfiler::reset();
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int64_t>(options.duration * 1000)));
+    stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    StepResult result;
+    result.threads = threads;
+    result.elapsedS = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.locks = LockProfiler::snapshot();
+    result.ops = 0;
+    result.errors = 0;
+    for (int i = 0; i < threads; i++) {
+        result.ops += ops[static_cast<size_t>(i)];
+        result.errors += errors[static_cast<size_t>(i)];
+    }
+    return result;
+}
+
+static void WriteJson(const Options& options, const std::vector<StepResult>& results)
+{
+    std::fstream out(options.jsonFile, std::ios::out | std::ios::trunc);
+    if (!out.good()) {
+        std::cout << "Open json file " << options.jsonFile << " fail." << std::endl;
+        return;
+    }
+    out << std::setiosflags(std::ios::fixed) << std::setprecision(3);
+    out << "{\n  \"command\": \"" << options.command << "\",\n  \"size\": " << options.size
+        << ",\n  \"log\": \"" << options.log << "\",\n  \"steps\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const StepResult& r = results[i];
+        out << "    {\"threads\": " << r.threads << ", \"seconds\": " << r.elapsedS
+            << ", \"ops\": " << r.ops << ", \"errors\": " << r.errors
+            << ", \"opsPerSec\": " << r.ops / r.elapsedS << ", \"locks\": {";
+        for (size_t j = 0; j < r.locks.size(); j++) {
+            out << (j > 0 ? ", " : "") << "\"" << r.locks[j].Name << "\": {\"waits\": " << r.locks[j].Waits
+                << ", \"waitSeconds\": " << r.locks[j].WaitNanos / 1e9 << "}";
+        }
+        out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-h" || arg == "--help") {
+            PrintHelp();
+            return 0;
+        }
+        else if (arg == "-c" && hasValue) {
+            options.command = argv[++i];
+        }
+        else if (arg == "--size" && hasValue) {
+            options.size = std::atoll(argv[++i]);
+        }
+        else if (arg == "--threads" && hasValue) {
+            std::istringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                if (std::atoi(item.c_str()) > 0) {
+                    options.threads.push_back(std::atoi(item.c_str()));
+                }
+            }
+        }
+        else if (arg == "--duration" && hasValue) {
+            options.duration = std::atof(argv[++i]);
+        }
+        else if (arg == "--maxConnections" && hasValue) {
+            options.maxConnections = static_cast<unsigned>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--log" && hasValue) {
+            options.log = argv[++i];
+        }
+        else if (arg == "--endpoint" && hasValue) {
+            options.endpoint = argv[++i];
+        }
+        else if (arg == "-b" && hasValue) {
+            options.bucket = argv[++i];
+        }
+        else if (arg == "--json" && hasValue) {
+            options.jsonFile = argv[++i];
+        }
+    }
+
+    if ((options.command != "head" && options.command != "get" && options.command != "put" &&
+        options.command != "resumable") || (options.log != "off" && options.log != "sync" &&
+        options.log != "async") || options.size < 0 || options.duration <= 0.0) {
+        PrintHelp();
+        return 1;
+    }
+    if (options.threads.empty()) {
+        int cores = static_cast<int>((std::max)(std::thread::hardware_concurrency(), 1u));
+        for (int n = 1; n <= cores * 2; n *= 2) {
+            options.threads.push_back(n);
+        }
+    }
+
+    InitializeSdk();
+
+    OssEmulator emulator;
+    if (options.endpoint.empty()) {
+        if (!emulator.start()) {
+            std::cout << "Start the OSS emulator fail." << std::endl;
+            return 1;
+        }
+        options.endpoint = emulator.Endpoint();
+    }
+
+    auto data = std::make_shared<std::string>(static_cast<size_t>(options.size), 'x');
+    std::string localFile = "cpp-sdk-scalability.tmp";
+    if (options.command == "resumable") {
+        std::fstream out(localFile, std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(data->data(), static_cast<std::streamsize>(data->size()));
+    }
+
+    if (options.log != "off") {
+        LogSink = fopen("/dev/null", "w");
+        SetLogLevel(LogLevel::LogDebug);
+        SetLogCallback(NullLogCallback);
+        LockProfiler::setCallbackTiming(true);
+        if (options.log == "async") {
+            EnableAsyncLog();
+        }
+    }
+
+    ClientConfiguration conf;
+    if (options.maxConnections > 0) {
+        conf.maxConnections = options.maxConnections;
+    }
+    OssClient client(options.endpoint, "scalability", "scalability", conf);
+    if (options.command == "head" || options.command == "get") {
+        auto content = std::make_shared<std::stringstream>(*data);
+        auto outcome = client.PutObject(options.bucket, "scalability/object", content);
+        if (!outcome.isSuccess()) {
+            std::cout << "Put the object to " << options.endpoint << " fail, " << outcome.error().Code() << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Command=" << options.command << ", Size=" << options.size << ", Endpoint=" << options.endpoint <<
+        ", MaxConnections=" << conf.maxConnections << ", Log=" << options.log <<
+        ", Cores=" << std::thread::hardware_concurrency() << std::endl;
+
+    std::vector<StepResult> results;
+    for (auto threads : options.threads) {
+        results.push_back(RunStep(client, options, threads, localFile, data));
+    }
+
+    double baseRate = results[0].ops / results[0].elapsedS / results[0].threads;
+    std::cout << std::setiosflags(std::ios::fixed);
+    std::cout << std::left << std::setw(9) << "Threads" << std::right << std::setw(12) << "Ops/s" <<
+        std::setw(16) << "Ops/s/thread" << std::setw(12) << "Scaling" << std::setw(9) << "Errors" << std::endl;
+    for (const auto& r : results) {
+        double rate = r.ops / r.elapsedS;
+        std::cout << std::left << std::setw(9) << r.threads << std::right <<
+            std::setprecision(0) << std::setw(12) << rate << std::setw(16) << rate / r.threads <<
+            std::setprecision(2) << std::setw(12) << (baseRate > 0.0 ? rate / r.threads / baseRate : 0.0) <<
+            std::setw(9) << r.errors << std::endl;
+    }
+
+    std::cout << "\nLock wait, % of thread time / contended acquisitions per operation" << std::endl;
+    std::cout << std::left << std::setw(9) << "Threads" << std::right;
+    for (const auto& lock : results[0].locks) {
+        std::cout << std::setw(20) << lock.Name;
+    }
+    std::cout << std::endl;
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(9) << r.threads << std::right;
+        for (const auto& lock : r.locks) {
+            std::stringstream cell;
+            cell << std::setiosflags(std::ios::fixed) << std::setprecision(2) <<
+                lock.WaitNanos / 1e9 / (r.elapsedS * r.threads) * 100.0 << "% / " <<
+                std::setprecision(3) << (r.ops > 0 ? static_cast<double>(lock.Waits) / r.ops : 0.0);
+            std::cout << std::setw(20) << cell.str();
+        }
+        std::cout << std::endl;
+    }
+
+    if (!options.jsonFile.empty()) {
+        WriteJson(options, results);
+    }
+
+    if (options.log == "async") {
+        DisableAsyncLog();
+    }
+    SetLogCallback(nullptr);
+    if (LogSink != nullptr) {
+        fclose(LogSink);
+    }
+    std::remove(localFile.c_str());
+    emulator.stop();
+    ShutdownSdk();
+    return 0;
+}
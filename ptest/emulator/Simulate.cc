@@ -0,0 +1,327 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SimulatedHttpClient.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::PTest;
+
+static const char* BucketName = "simulation";
+static const char* ObjectKey = "simulation-object";
+
+struct RunResult
+{
+    int64_t partSize;
+    int threads;
+    bool success;
+    std::string error;
+    double virtualS;
+    double realS;
+    SimulationStats stats;
+};
+
+static void PrintHelp()
+{
+    std::cout << "\n";
+    std::cout << "Usage: cpp-sdk-simulate [-h] [-c upload|download] [--objectSize SIZE]      \n";
+    std::cout << "                        [--partSizes SIZES] [--threads COUNTS]      \n";
+    std::cout << "                        [--latency MS] [--jitter SIGMA] [--connBandwidth MBPS] [--bandwidth MBPS]      \n";
+    std::cout << "                        [--maxConnections N] [--slowDown P] [--reset P] [--corrupt P]      \n";
+    std::cout << "                        [--seed N] [--quiescence US] [--json FILE]      \n";
+    std::cout << "Optional arguments:      \n";
+    std::cout << "  -h, --help             show this help message and exit.           \n";
+    std::cout << "  -c COMMAND             resumable upload or download, default is upload. \n";
+    std::cout << "  --objectSize SIZE      object size, accepts K, M and G suffixes, default is 64M. \n";
+    std::cout << "  --partSizes SIZES      comma separated part sizes to sweep, default is 1M,4M,16M. \n";
+    std::cout << "  --threads COUNTS       comma separated thread counts to sweep, default is 1,2,4,8,16. \n";
+    std::cout << "  --latency MS           median latency of a request, default is 20. \n";
+    std::cout << "  --jitter SIGMA         log-normal sigma of the latency, 0 means constant, default is 0.5. \n";
+    std::cout << "  --connBandwidth MBPS   bandwidth of one connection in MB/s, 0 means unlimited, default is 20. \n";
+    std::cout << "  --bandwidth MBPS       aggregate bandwidth in MB/s, 0 means unlimited, default is 200. \n";
+    std::cout << "  --maxConnections N     connection limit, default is 16. \n";
+    std::cout << "  --slowDown P           probability of a 503 SlowDown response. \n";
+    std::cout << "  --reset P              probability of a connection reset. \n";
+    std::cout << "  --corrupt P            probability of corrupted data, detected by crc64. \n";
+    std::cout << "  --seed N               seed of the latency and the injected errors, default is 1. \n";
+    std::cout << "  --quiescence US        real time without requests before the virtual clock moves, default is 2000. \n";
+    std::cout << "  --json FILE            write the results as json to FILE. \n";
+    std::cout << "\nExamples :  \n";
+    std::cout << "    cpp-sdk-simulate --partSizes 1M,8M --threads 4,16 --latency 30 --slowDown 0.01 \n";
+    std::cout << "    cpp-sdk-simulate -c download --objectSize 256M --bandwidth 100 \n";
+}
+
+static int64_t ParseSize(const std::string& value)
+{
+    char* end = nullptr;
+    double size = std::strtod(value.c_str(), &end);
+    switch (end != nullptr ? *end : '\0') {
+    case 'k': case 'K': size *= 1024.0; break;
+    case 'm': case 'M': size *= 1024.0 * 1024.0; break;
+    case 'g': case 'G': size *= 1024.0 * 1024.0 * 1024.0; break;
+    default: break;
+    }
+    return static_cast<int64_t>(size);
+}
+
+static std::vector<int64_t> ParseList(const std::string& value, bool sizes)
+{
+    std::vector<int64_t> list;
+    std::istringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            list.push_back(sizes ? ParseSize(item) : std::atoll(item.c_str()));
+        }
+    }
+    return list;
+}
+
+static std::string FormatSize(int64_t size)
+{
+    std::stringstream ss;
+    if (size >= 1024 * 1024 && size % (1024 * 1024) == 0) {
+        ss << size / (1024 * 1024) << "M";
+    }
+    else if (size >= 1024 && size % 1024 == 0) {
+        ss << size / 1024 << "K";
+    }
+    else {
+        ss << size;
+    }
+    return ss.str();
+}
+
+static RunResult RunOne(const std::string& command, const SimulationOptions& options,
+    const std::string& localFile, const std::shared_ptr<const std::string>& objectData,
+    int64_t partSize, int threads)
+{
+    RunResult result;
+    result.partSize = partSize;
+    result.threads = threads;
+
+    auto backend = std::make_shared<OssEmulator>();
+    auto httpClient = std::make_shared<SimulatedHttpClient>(options, backend);
+    ClientConfiguration conf;
+    conf.httpClient = httpClient;
+    if (options.maxConnections > 0) {
+        conf.maxConnections = options.maxConnections;
+    }
+    OssClient client("http://127.0.0.1", "simulation", "simulation", conf);
+
+    auto start = std::chrono::steady_clock::now();
+    if (command == "upload") {
+        UploadObjectRequest request(BucketName, ObjectKey, localFile);
+        request.setPartSize(partSize);
+        request.setThreadNum(threads);
+        auto outcome = client.ResumableUploadObject(request);
+        result.success = outcome.isSuccess();
+        if (!outcome.isSuccess()) {
+            result.error = outcome.error().Code();
+        }
+    }
+    else {
+        backend->putObject(BucketName, ObjectKey, std::string(*objectData));
+        std::string downloadFile = localFile + ".download";
+        DownloadObjectRequest request(BucketName, ObjectKey, downloadFile);
+        request.setPartSize(partSize);
+        request.setThreadNum(threads);
+        auto outcome = client.ResumableDownloadObject(request);
+        result.success = outcome.isSuccess();
+        if (!outcome.isSuccess()) {
+            result.error = outcome.error().Code();
+        }
+        std::remove(downloadFile.c_str());
+    }
+    result.realS = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.virtualS = httpClient->NowSeconds();
+    result.stats = httpClient->Stats();
+    return result;
+}
+
+static void WriteJson(const std::string& file, const std::string& command, int64_t objectSize,
+    const std::vector<RunResult>& results)
+{
+    std::fstream out(file, std::ios::out | std::ios::trunc);
+    if (!out.good()) {
+        std::cout << "Open json file " << file << " fail." << std::endl;
+        return;
+    }
+    out << std::setiosflags(std::ios::fixed) << std::setprecision(3);
+    out << "{\n  \"command\": \"" << command << "\",\n  \"objectSize\": " << objectSize << ",\n  \"runs\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const RunResult& r = results[i];
+        out << "    {\"partSize\": " << r.partSize
+            << ", \"threads\": " << r.threads
+            << ", \"success\": " << (r.success ? "true" : "false")
+            << ", \"virtualSeconds\": " << r.virtualS
+            << ", \"throughputMBPerSec\": " << (r.virtualS > 0.0 ? (double)objectSize / 1024.0 / 1024.0 / r.virtualS : 0.0)
+            << ", \"requests\": " << r.stats.Requests
+            << ", \"retryWaits\": " << r.stats.RetryWaits
+            << ", \"slowDowns\": " << r.stats.SlowDowns
+            << ", \"resets\": " << r.stats.Resets
+            << ", \"crcCorruptions\": " << r.stats.CrcCorruptions
+            << ", \"peakConnections\": " << r.stats.PeakConnections
+            << ", \"connectionWaitSeconds\": " << r.stats.ConnectionWaitS
+            << ", \"realSeconds\": " << r.realS << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char **argv)
+{
+    std::string command = "upload";
+    int64_t objectSize = 64 * 1024 * 1024;
+    std::vector<int64_t> partSizes = { 1024 * 1024, 4 * 1024 * 1024, 16 * 1024 * 1024 };
+    std::vector<int64_t> threadCounts = { 1, 2, 4, 8, 16 };
+    double latencyMs = 20.0;
+    double jitter = 0.5;
+    double connBandwidthMB = 20.0;
+    double bandwidthMB = 200.0;
+    std::string jsonFile;
+    SimulationOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-h" || arg == "--help") {
+            PrintHelp();
+            return 0;
+        }
+        else if (arg == "-c" && hasValue) {
+            command = argv[++i];
+        }
+        else if (arg == "--objectSize" && hasValue) {
+            objectSize = ParseSize(argv[++i]);
+        }
+        else if (arg == "--partSizes" && hasValue) {
+            partSizes = ParseList(argv[++i], true);
+        }
+        else if (arg == "--threads" && hasValue) {
+            threadCounts = ParseList(argv[++i], false);
+        }
+        else if (arg == "--latency" && hasValue) {
+            latencyMs = std::atof(argv[++i]);
+        }
+        else if (arg == "--jitter" && hasValue) {
+            jitter = std::atof(argv[++i]);
+        }
+        else if (arg == "--connBandwidth" && hasValue) {
+            connBandwidthMB = std::atof(argv[++i]);
+        }
+        else if (arg == "--bandwidth" && hasValue) {
+            bandwidthMB = std::atof(argv[++i]);
+        }
+        else if (arg == "--maxConnections" && hasValue) {
+            options.maxConnections = std::atoi(argv[++i]);
+        }
+        else if (arg == "--slowDown" && hasValue) {
+            options.slowDownRate = std::atof(argv[++i]);
+        }
+        else if (arg == "--reset" && hasValue) {
+            options.resetRate = std::atof(argv[++i]);
+        }
+        else if (arg == "--corrupt" && hasValue) {
+            options.crcCorruptionRate = std::atof(argv[++i]);
+        }
+        else if (arg == "--seed" && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--quiescence" && hasValue) {
+            options.quiescenceUs = std::atoi(argv[++i]);
+        }
+        else if (arg == "--json" && hasValue) {
+            jsonFile = argv[++i];
+        }
+    }
+
+    if ((command != "upload" && command != "download") || objectSize <= 0 ||
+        partSizes.empty() || threadCounts.empty()) {
+        PrintHelp();
+        return 1;
+    }
+    options.latency = jitter > 0.0 ?
+        LatencyDistribution::LogNormal(latencyMs, jitter) : LatencyDistribution::Constant(latencyMs);
+    options.connectionBandwidth = connBandwidthMB * 1024.0 * 1024.0;
+    options.aggregateBandwidth = bandwidthMB * 1024.0 * 1024.0;
+
+    /* the content is pseudo random, so that the crc64 of each part differs */
+    std::string localFile = "cpp-sdk-simulate.tmp";
+    auto objectData = std::make_shared<std::string>(static_cast<size_t>(objectSize), '\0');
+    uint64_t x = options.seed | 1;
+    for (auto& c : *objectData) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        c = static_cast<char>(x);
+    }
+    {
+        std::fstream out(localFile, std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(objectData->data(), static_cast<std::streamsize>(objectData->size()));
+        if (!out.good()) {
+            std::cout << "Write the local file " << localFile << " fail." << std::endl;
+            return 1;
+        }
+    }
+
+    InitializeSdk();
+
+    std::cout << "Command=" << command << ", ObjectSize=" << FormatSize(objectSize) <<
+        ", Latency=" << latencyMs << "ms (sigma " << jitter << ")" <<
+        ", ConnBandwidth=" << connBandwidthMB << "MB/s, Bandwidth=" << bandwidthMB << "MB/s" <<
+        ", MaxConnections=" << options.maxConnections <<
+        ", SlowDown=" << options.slowDownRate << ", Reset=" << options.resetRate <<
+        ", Corrupt=" << options.crcCorruptionRate << ", Seed=" << options.seed << std::endl;
+    std::cout << std::left << std::setw(10) << "PartSize" << std::setw(9) << "Threads" << std::setw(8) << "Result" <<
+        std::right << std::setw(12) << "VirtualS" << std::setw(10) << "MB/s" << std::setw(10) << "Requests" <<
+        std::setw(9) << "Retries" << std::setw(11) << "PeakConns" << std::setw(10) << "RealS" << std::endl;
+
+    std::vector<RunResult> results;
+    for (auto partSize : partSizes) {
+        for (auto threads : threadCounts) {
+            RunResult r = RunOne(command, options, localFile, objectData, partSize, static_cast<int>(threads));
+            double rate = r.virtualS > 0.0 ? (double)objectSize / 1024.0 / 1024.0 / r.virtualS : 0.0;
+            std::cout << std::left << std::setw(10) << FormatSize(partSize) << std::setw(9) << threads <<
+                std::setw(8) << (r.success ? "OK" : "NG") << std::right <<
+                std::setiosflags(std::ios::fixed) << std::setprecision(3) << std::setw(12) << r.virtualS <<
+                std::setprecision(2) << std::setw(10) << rate <<
+                std::setw(10) << r.stats.Requests << std::setw(9) << r.stats.RetryWaits <<
+                std::setw(11) << r.stats.PeakConnections <<
+                std::setprecision(2) << std::setw(10) << r.realS;
+            if (!r.success) {
+                std::cout << "  " << r.error;
+            }
+            std::cout << std::endl;
+            results.push_back(r);
+        }
+    }
+
+    if (!jsonFile.empty()) {
+        WriteJson(jsonFile, command, objectSize, results);
+    }
+
+    std::remove(localFile.c_str());
+    ShutdownSdk();
+    return 0;
+}
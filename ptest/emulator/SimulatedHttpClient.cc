@@ -0,0 +1,445 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SimulatedHttpClient.h"
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/Error.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace AlibabaCloud::OSS;
+using namespace AlibabaCloud::OSS::PTest;
+
+namespace
+{
+    /* a transfer with fewer bytes left than this is complete, it absorbs the rounding of the rates */
+    const double TRANSFER_EPSILON = 1e-3;
+
+    uint64_t Fnv1a(uint64_t hash, const std::string& data)
+    {
+        for (unsigned char c : data) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /* the method, path, parameters and range of a request, without the random upload id */
+    std::string RequestIdentity(const std::shared_ptr<HttpRequest>& request)
+    {
+        std::string identity(Http::MethodToString(request->method()));
+        identity.append(" ").append(request->url().path());
+        std::istringstream query(request->url().query());
+        std::string item;
+        while (std::getline(query, item, '&')) {
+            if (item.compare(0, 9, "uploadId=") != 0) {
+                identity.append("&").append(item);
+            }
+        }
+        if (request->hasHeader(Http::RANGE)) {
+            identity.append(" ").append(request->Header(Http::RANGE));
+        }
+        return identity;
+    }
+
+    std::string ToLower(std::string str)
+    {
+        std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return static_cast<char>(::tolower(c)); });
+        return str;
+    }
+}
+
+LatencyDistribution LatencyDistribution::Constant(double ms)
+{
+    return LatencyDistribution(ConstantType, ms, 0.0);
+}
+
+LatencyDistribution LatencyDistribution::Uniform(double minMs, double maxMs)
+{
+    return LatencyDistribution(UniformType, minMs, maxMs);
+}
+
+LatencyDistribution LatencyDistribution::LogNormal(double medianMs, double sigma)
+{
+    return LatencyDistribution(LogNormalType, medianMs, sigma);
+}
+
+double LatencyDistribution::sample(std::mt19937_64& rng) const
+{
+    switch (type_) {
+    case UniformType:
+        return std::uniform_real_distribution<double>(a_, b_)(rng);
+    case LogNormalType:
+        return a_ > 0.0 ? std::lognormal_distribution<double>(std::log(a_), b_)(rng) : 0.0;
+    default:
+        return a_;
+    }
+}
+
+SimulationOptions::SimulationOptions() :
+    latency(LatencyDistribution::Constant(10.0)),
+    connectionBandwidth(0.0),
+    aggregateBandwidth(0.0),
+    maxConnections(16),
+    slowDownRate(0.0),
+    resetRate(0.0),
+    crcCorruptionRate(0.0),
+    seed(1),
+    quiescenceUs(2000)
+{
+}
+
+SimulatedHttpClient::SimulatedHttpClient(const SimulationOptions& options, const std::shared_ptr<OssEmulator>& backend) :
+    HttpClient(),
+    options_(options),
+    backend_(backend),
+    activeConnections_(0),
+    preparing_(0),
+    arrivals_(0),
+    now_(0.0),
+    stop_(false)
+{
+    scheduler_ = std::thread(&SimulatedHttpClient::schedule, this);
+}
+
+SimulatedHttpClient::~SimulatedHttpClient()
+{
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        stop_ = true;
+    }
+    scheduleCv_.notify_all();
+    scheduler_.join();
+}
+
+double SimulatedHttpClient::NowSeconds() const
+{
+    std::unique_lock<std::mutex> lck(mtx_);
+    return now_;
+}
+
+SimulationStats SimulatedHttpClient::Stats() const
+{
+    std::unique_lock<std::mutex> lck(mtx_);
+    return stats_;
+}
+
+std::mt19937_64 SimulatedHttpClient::requestRandom(const std::shared_ptr<HttpRequest>& request)
+{
+    std::string identity = RequestIdentity(request);
+    int attempt;
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        attempt = attempts_[identity]++;
+    }
+    uint64_t hash = Fnv1a(14695981039346656037ULL ^ options_.seed, identity);
+    hash = Fnv1a(hash, std::to_string(attempt));
+    return std::mt19937_64(hash);
+}
+
+std::shared_ptr<HttpResponse> SimulatedHttpClient::makeRequest(const std::shared_ptr<HttpRequest>& request)
+{
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        preparing_++;
+    }
+
+    auto rng = requestRandom(request);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    double roll = uniform(rng);
+    bool slowDown = roll < options_.slowDownRate;
+    bool reset = !slowDown && roll < options_.slowDownRate + options_.resetRate;
+    bool corrupt = uniform(rng) < options_.crcCorruptionRate;
+    double latencyS = std::max(0.0, options_.latency.sample(rng)) / 1000.0;
+
+    std::string method(Http::MethodToString(request->method()));
+    bool isUpload = request->method() == Http::Method::Put || request->method() == Http::Method::Post;
+
+    OssEmulator::Request req;
+    req.method = method;
+    for (const auto& header : request->Headers()) {
+        req.headers[ToLower(header.first)] = header.second;
+    }
+
+    std::iostream::pos_type requestBodyPos = -1;
+    auto& content = request->Body();
+    if (content != nullptr) {
+        requestBodyPos = content->tellg();
+        /* like the curl transport, a chunked upload still stops at Content-Length */
+        if (request->hasHeader(Http::CONTENT_LENGTH)) {
+            req.body.resize(static_cast<size_t>(std::atoll(request->Header(Http::CONTENT_LENGTH).c_str())));
+            content->read(&req.body[0], static_cast<std::streamsize>(req.body.size()));
+            req.body.resize(static_cast<size_t>(content->gcount()));
+        }
+        else {
+            req.body.assign(std::istreambuf_iterator<char>(*content), std::istreambuf_iterator<char>());
+        }
+    }
+
+    OssEmulator::Response resp;
+    if (slowDown) {
+        resp.status = 503;
+        resp.addHeader("Content-Type", "application/xml");
+        resp.addHeader("x-oss-request-id", "simulated");
+        resp.body = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Error>\n"
+            "  <Code>SlowDown</Code>\n  <Message>Please reduce your request rate.</Message>\n"
+            "  <RequestId>simulated</RequestId>\n</Error>\n";
+    }
+    else if (!reset) {
+        std::string target = request->url().path();
+        if (!request->url().query().empty()) {
+            target.append("?").append(request->url().query());
+        }
+        backend_->serve(target, req, resp);
+    }
+
+    bool corrupted = false;
+    std::string downloaded;
+    const char* data = resp.Data();
+    size_t size = resp.headOnly ? 0 : resp.Size();
+    if (corrupt && !slowDown && !reset && resp.status / 100 == 2) {
+        if (!isUpload && size > 0) {
+            downloaded.assign(data, size);
+            downloaded[size / 2] ^= 0x01;
+            data = downloaded.data();
+            corrupted = true;
+        }
+        else if (isUpload) {
+            for (auto& header : resp.headers) {
+                if (header.first == "x-oss-hash-crc64ecma") {
+                    header.second = std::to_string(std::strtoull(header.second.c_str(), nullptr, 10) + 1);
+                    corrupted = true;
+                }
+            }
+        }
+    }
+
+    auto response = std::make_shared<HttpResponse>(request);
+    uint64_t crc64 = 0;
+    int64_t transferred = 0;
+    if (reset) {
+        response->setStatusCode(ERROR_CURL_BASE + 56);
+        response->setStatusMsg("Connection reset by peer (simulated).");
+        response->addBody(std::make_shared<std::stringstream>());
+        transferred = static_cast<int64_t>(req.body.size() / 2);
+    }
+    else {
+        response->setStatusCode(resp.status);
+        for (const auto& header : resp.headers) {
+            response->setHeader(header.first, header.second);
+        }
+        response->setHeader(Http::CONTENT_LENGTH, std::to_string(resp.Size()));
+
+        std::shared_ptr<std::iostream> body;
+        if (resp.status / 100 == 2 && request->ResponseStreamFactory()) {
+            body = request->ResponseStreamFactory()();
+        }
+        if (body == nullptr) {
+            body = std::make_shared<std::stringstream>();
+        }
+        body->write(data, static_cast<std::streamsize>(size));
+        body->flush();
+        response->addBody(body);
+
+        if (request->hasCheckCrc64()) {
+            crc64 = isUpload ?
+                ComputeCRC64(0, const_cast<char*>(req.body.data()), req.body.size()) :
+                ComputeCRC64(0, const_cast<char*>(data), size);
+        }
+        transferred = static_cast<int64_t>(isUpload ? req.body.size() : size);
+
+        const auto& progress = request->TransferProgress();
+        if (progress.Handler && transferred > 0) {
+            progress.Handler(static_cast<size_t>(transferred), transferred, transferred, progress.UserData);
+        }
+    }
+    request->setCrc64Result(crc64);
+    request->setTransferedBytes(transferred);
+
+    if (requestBodyPos != static_cast<std::streampos>(-1)) {
+        content->clear();
+        content->seekg(requestBodyPos);
+    }
+
+    Task task;
+    task.stage = Task::WaitConnection;
+    task.readyAt = 0.0;
+    task.latency = latencyS;
+    task.remaining = reset ? static_cast<double>(req.body.size() / 2) : static_cast<double>(req.body.size() + size);
+    task.queuedAt = 0.0;
+    task.holdsConnection = false;
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        preparing_--;
+        stats_.Requests++;
+        stats_.SlowDowns += slowDown ? 1 : 0;
+        stats_.Resets += reset ? 1 : 0;
+        stats_.CrcCorruptions += corrupted ? 1 : 0;
+        stats_.BytesSent += reset ? req.body.size() / 2 : req.body.size();
+        stats_.BytesReceived += reset ? 0 : size;
+    }
+    runTask(task);
+    return response;
+}
+
+void SimulatedHttpClient::waitForRetry(long milliseconds)
+{
+    if (milliseconds <= 0 || !isEnable()) {
+        return;
+    }
+    Task task;
+    task.stage = Task::Sleep;
+    task.latency = 0.0;
+    task.remaining = 0.0;
+    task.queuedAt = 0.0;
+    task.holdsConnection = false;
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        stats_.RetryWaits++;
+        task.readyAt = now_ + static_cast<double>(milliseconds) / 1000.0;
+    }
+    runTask(task);
+}
+
+void SimulatedHttpClient::runTask(Task& task)
+{
+    std::unique_lock<std::mutex> lck(mtx_);
+    arrivals_++;
+    task.queuedAt = now_;
+    tasks_.push_back(&task);
+    if (task.stage == Task::WaitConnection) {
+        if (options_.maxConnections <= 0 || activeConnections_ < options_.maxConnections) {
+            startLatency(&task);
+        }
+        else {
+            connectionQueue_.push_back(&task);
+        }
+    }
+    scheduleCv_.notify_all();
+    doneCv_.wait(lck, [&]() { return task.stage == Task::Done || stop_; });
+}
+
+void SimulatedHttpClient::startLatency(Task* task)
+{
+    activeConnections_++;
+    stats_.PeakConnections = std::max(stats_.PeakConnections, activeConnections_);
+    stats_.ConnectionWaitS += now_ - task->queuedAt;
+    task->holdsConnection = true;
+    task->stage = Task::Latency;
+    task->readyAt = now_ + task->latency;
+}
+
+void SimulatedHttpClient::finish(Task* task)
+{
+    task->stage = Task::Done;
+    tasks_.remove(task);
+    if (task->holdsConnection) {
+        task->holdsConnection = false;
+        activeConnections_--;
+        if (!connectionQueue_.empty()) {
+            Task* next = connectionQueue_.front();
+            connectionQueue_.pop_front();
+            startLatency(next);
+        }
+    }
+}
+
+void SimulatedHttpClient::schedule()
+{
+    std::unique_lock<std::mutex> lck(mtx_);
+    while (!stop_) {
+        if (tasks_.empty() || preparing_ > 0) {
+            scheduleCv_.wait(lck);
+            continue;
+        }
+        uint64_t seen = arrivals_;
+        bool woken = scheduleCv_.wait_for(lck, std::chrono::microseconds(options_.quiescenceUs),
+            [&]() { return stop_ || arrivals_ != seen || preparing_ > 0; });
+        if (!woken) {
+            advance();
+        }
+    }
+    doneCv_.notify_all();
+}
+
+void SimulatedHttpClient::advance()
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    int transfers = 0;
+    for (const auto task : tasks_) {
+        transfers += task->stage == Task::Transfer ? 1 : 0;
+    }
+    double rate = infinity;
+    if (transfers > 0 && options_.aggregateBandwidth > 0.0) {
+        rate = options_.aggregateBandwidth / transfers;
+    }
+    if (options_.connectionBandwidth > 0.0) {
+        rate = std::min(rate, options_.connectionBandwidth);
+    }
+
+    double next = infinity;
+    for (const auto task : tasks_) {
+        if (task->stage == Task::Latency || task->stage == Task::Sleep) {
+            next = std::min(next, task->readyAt);
+        }
+        else if (task->stage == Task::Transfer) {
+            next = std::min(next, rate == infinity ? now_ : now_ + task->remaining / rate);
+        }
+    }
+    if (next == infinity) {
+        return;
+    }
+
+    double elapsed = std::max(0.0, next - now_);
+    for (const auto task : tasks_) {
+        if (task->stage == Task::Transfer) {
+            task->remaining = rate == infinity ? 0.0 : task->remaining - rate * elapsed;
+        }
+    }
+    now_ = std::max(now_, next);
+    bool unlimited = options_.aggregateBandwidth <= 0.0 && options_.connectionBandwidth <= 0.0;
+
+    /* a finished transfer may hand its connection to a queued request, which may be due at once */
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        std::vector<Task*> snapshot(tasks_.begin(), tasks_.end());
+        for (const auto task : snapshot) {
+            if (task->stage == Task::Sleep && task->readyAt <= now_) {
+                finish(task);
+                changed = true;
+            }
+            else if (task->stage == Task::Latency && task->readyAt <= now_) {
+                task->stage = Task::Transfer;
+                if (unlimited) {
+                    task->remaining = 0.0;
+                }
+                changed = true;
+            }
+            else if (task->stage == Task::Transfer && task->remaining <= TRANSFER_EPSILON) {
+                finish(task);
+                changed = true;
+            }
+        }
+    }
+    doneCv_.notify_all();
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/http/HttpClient.h>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include "OssEmulator.h"
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+namespace PTest
+{
+    /* the distribution of the simulated per-request latency, in milliseconds */
+    class LatencyDistribution
+    {
+    public:
+        static LatencyDistribution Constant(double ms);
+        static LatencyDistribution Uniform(double minMs, double maxMs);
+        /* a long tailed distribution, sigma is the standard deviation of the log */
+        static LatencyDistribution LogNormal(double medianMs, double sigma);
+
+        double sample(std::mt19937_64& rng) const;
+    private:
+        enum Type { ConstantType, UniformType, LogNormalType };
+        LatencyDistribution(Type type, double a, double b) : type_(type), a_(a), b_(b) {}
+        Type type_;
+        double a_;
+        double b_;
+    };
+
+    class SimulationOptions
+    {
+    public:
+        SimulationOptions();
+
+        LatencyDistribution latency;
+        /* in bytes per second, 0 means unlimited */
+        double connectionBandwidth;
+        double aggregateBandwidth;
+        /* the number of requests in flight at once, the others queue for a connection, 0 means unlimited */
+        int maxConnections;
+        /* the probabilities of the injected errors */
+        double slowDownRate;
+        double resetRate;
+        double crcCorruptionRate;
+        uint64_t seed;
+        /*
+        * the virtual clock moves on only after no request has arrived for this long in real time,
+        * so that all the requests which are issued at the same virtual time compete for the network.
+        */
+        int quiescenceUs;
+    };
+
+    class SimulationStats
+    {
+    public:
+        SimulationStats() : Requests(0), RetryWaits(0), SlowDowns(0), Resets(0), CrcCorruptions(0),
+            BytesSent(0), BytesReceived(0), PeakConnections(0), ConnectionWaitS(0.0) {}
+        uint64_t Requests;
+        uint64_t RetryWaits;
+        uint64_t SlowDowns;
+        uint64_t Resets;
+        uint64_t CrcCorruptions;
+        uint64_t BytesSent;
+        uint64_t BytesReceived;
+        int PeakConnections;
+        double ConnectionWaitS;
+    };
+
+    /*
+    * An HttpClient which never opens a socket. Requests are served in-process by an OssEmulator,
+    * and take the time of a simulated network on a virtual clock: every request waits for a
+    * connection, pays a sampled latency, then shares the aggregate bandwidth fairly with the other
+    * transfers in flight, capped by the per-connection bandwidth. Retry waits are virtual as well,
+    * so the simulation runs as fast as the CPU allows.
+    *
+    * Latency and injected errors are drawn from a seed and the identity of the request, so a run
+    * is reproducible as long as the caller does not spend more than the quiescence time between
+    * two requests. The endpoint must be path style, e.g. an IP address.
+    */
+    class SimulatedHttpClient : public HttpClient
+    {
+    public:
+        SimulatedHttpClient(const SimulationOptions& options, const std::shared_ptr<OssEmulator>& backend);
+        ~SimulatedHttpClient();
+
+        std::shared_ptr<HttpResponse> makeRequest(const std::shared_ptr<HttpRequest>& request) override;
+        void waitForRetry(long milliseconds) override;
+
+        /* the virtual time elapsed since the client was created */
+        double NowSeconds() const;
+        SimulationStats Stats() const;
+        const std::shared_ptr<OssEmulator>& Backend() const { return backend_; }
+
+    private:
+        struct Task
+        {
+            enum Stage { WaitConnection, Latency, Transfer, Sleep, Done };
+            Stage stage;
+            double readyAt;
+            double latency;
+            double remaining;
+            double queuedAt;
+            bool holdsConnection;
+        };
+
+        void schedule();
+        void advance();
+        void startLatency(Task* task);
+        void finish(Task* task);
+        void runTask(Task& task);
+        std::mt19937_64 requestRandom(const std::shared_ptr<HttpRequest>& request);
+
+        SimulationOptions options_;
+        std::shared_ptr<OssEmulator> backend_;
+
+        mutable std::mutex mtx_;
+        std::condition_variable scheduleCv_;
+        std::condition_variable doneCv_;
+        std::list<Task*> tasks_;
+        std::list<Task*> connectionQueue_;
+        int activeConnections_;
+        int preparing_;
+        uint64_t arrivals_;
+        double now_;
+        bool stop_;
+        SimulationStats stats_;
+        std::map<std::string, int> attempts_;
+        std::thread scheduler_;
+    };
+}
+}
+}
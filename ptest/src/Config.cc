@@ -33,6 +33,9 @@ int Config::SpeedKBPerSec = 0;   //
 bool Config::Debug = false;
 bool Config::DumpDetail = false;
 bool Config::PrintPercentile = false;
+std::string Config::JsonFile = "";
+
+bool Config::UseEmulator = false;
 
 static std::string LeftTrim(const char* source)
 {
@@ -79,7 +82,7 @@ void Config::PrintHelp()
     std::cout << "                      [-k REMOTEKEY] [-p PARALLEL]      \n";
     std::cout << "                      [-m MULTITHREAD] [--partSize PARTSIZE]      \n";
     std::cout << "                      [-loopTimes TIMES]|[--loopDuration SEC]|[--persistent]      \n";
-    std::cout << "                      [--differentsource]      \n";
+    std::cout << "                      [--differentsource] [--emulator] [--json FILE]      \n";
     std::cout << "Optional arguments:      \n";
     std::cout << "  -h, --help          show this help mestd::coutage and exit.           \n";
     std::cout << "  -v                  show program's version number and exit.    \n";
@@ -96,7 +99,9 @@ void Config::PrintHelp()
     std::cout << "  --differentsource   Whether transfer from different source files.  \n";
     std::cout << "  --limit SPEED       Whether to limit the upload or download speed, in kB/s.  \n";
     std::cout << "  --detail            print detail inforamtion for each testcase. \n";
-    std::cout << "  --percentile        print the 90th and 95th percentile value. \n";
+    std::cout << "  --percentile        print the 50th, 90th, 99th and 99.9th percentile latency. \n";
+    std::cout << "  --json FILE         write the statistic report as json to FILE, - for stdout. \n";
+    std::cout << "  --emulator          run against an in-process OSS emulator, oss.ini is not required. \n";
 
 
     std::cout << "\nExamples :  \n";
@@ -115,6 +120,7 @@ void Config::PrintHelp()
     std::cout << "    cpp-sdk-ptest -c download_async -f mylocalfilename -k myobjectkeyname \n";
     std::cout << "    cpp-sdk-ptest -c dna -f mylocalfilename -k myobjectkeyname -m 5 \n";
     std::cout << "    cpp-sdk-ptest -c dn -f mylocalfilename -k myobjectkeyname -m 5 \n";
+    std::cout << "    cpp-sdk-ptest -c upload_multipart -f mylocalfilename -k myobjectkeyname --emulator --json result.json \n";
 }
 
 void Config::PrintCfgInfo()
@@ -244,6 +250,13 @@ int Config::ParseArg(int argc, char **argv)
             else if (!strcmp("--percentile", argv[i])) {
                 Config::PrintPercentile = true;
             }
+            else if (!strcmp("--json", argv[i])) {
+                Config::JsonFile = argv[i + 1];
+                i++;
+            }
+            else if (!strcmp("--emulator", argv[i])) {
+                Config::UseEmulator = true;
+            }
         }
         i++;
     };
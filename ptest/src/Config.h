@@ -42,6 +42,9 @@ namespace PTest
         static bool Debug;
         static bool DumpDetail;
         static bool PrintPercentile;
+        static std::string JsonFile;
+
+        static bool UseEmulator;
     };
 }
 }
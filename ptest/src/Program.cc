@@ -1,5 +1,6 @@
 #include <alibabacloud/oss/OssClient.h>
 #include <alibabacloud/oss/client/RateLimiter.h>
+#include <alibabacloud/oss/client/Metrics.h>
 #include <iostream>
 #include <memory>
 #include "Config.h"
@@ -9,7 +10,12 @@
 #include <chrono>
 #include <iomanip>
 #include <atomic>
+#include <iterator>
+#include <cstdio>
 #include<algorithm>
+#ifdef USE_OSS_EMULATOR
+#include "OssEmulator.h"
+#endif
 
 using namespace AlibabaCloud::OSS;
 using namespace AlibabaCloud::OSS::PTest;
@@ -24,6 +30,7 @@ static int totalSucessCnt;
 static int totalFailCnt;
 static std::mutex logMtx;
 static std::mutex updateMtx;
+static LatencyHistogram totalLatency;
 
 static uint64_t uploadFileCRC64;
 
@@ -162,19 +169,76 @@ static void log_result_detail_msg(std::ostream& out)
     out.flush();
 }
 
-static void get_90th_95th_latency_percentile(int64_t &per90, int64_t &per95)
+static double get_latency_percentile_ms(double percentile)
 {
-    std::vector<int64_t> latentcy;
-    for (const auto& results : totalResults) {
-        for (const auto& result : results) {
-            int64_t durationMs = (std::chrono::duration_cast<std::chrono::milliseconds>(result.stopTimePoint - result.startTimePoint)).count();
-            latentcy.push_back(durationMs);
+    if (totalLatency.Count() == 0) {
+        return 0.0;
+    }
+    return (double)totalLatency.ValueAtPercentile(percentile) / 1000.0;
+}
+
+static std::string json_escape(const std::string &str)
+{
+    std::string out;
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out.append(buf);
+        }
+        else {
+            out.push_back(c);
         }
     }
-    std::sort(latentcy.begin(), latentcy.end());
+    return out;
+}
 
-    per90 = latentcy[latentcy.size() * 90 / 100];
-    per95 = latentcy[latentcy.size() * 95 / 100];
+static void write_json_report(int64_t totalTimeMS, double transferSizeMB, double transferRateMBPerS)
+{
+    std::stringstream ss;
+    ss << std::setiosflags(std::ios::fixed) << std::setprecision(3);
+    ss << "{\n" <<
+        "  \"command\": \"" << json_escape(Config::Command) << "\",\n" <<
+        "  \"endpoint\": \"" << json_escape(Config::Endpoint) << "\",\n" <<
+        "  \"emulator\": " << (Config::UseEmulator ? "true" : "false") << ",\n" <<
+        "  \"localFile\": \"" << json_escape(Config::BaseLocalFile) << "\",\n" <<
+        "  \"remoteKey\": \"" << json_escape(Config::BaseRemoteKey) << "\",\n" <<
+        "  \"parallel\": " << Config::Parallel << ",\n" <<
+        "  \"multithread\": " << Config::Multithread << ",\n" <<
+        "  \"partSize\": " << Config::PartSize << ",\n" <<
+        "  \"limitKBPerSec\": " << Config::SpeedKBPerSec << ",\n" <<
+        "  \"totalTimeMs\": " << totalTimeMS << ",\n" <<
+        "  \"totalSizeMB\": " << transferSizeMB << ",\n" <<
+        "  \"transferRateMBPerSec\": " << transferRateMBPerS << ",\n" <<
+        "  \"ok\": " << totalSucessCnt << ",\n" <<
+        "  \"ng\": " << totalFailCnt << ",\n" <<
+        "  \"latencyMs\": {\n" <<
+        "    \"count\": " << totalLatency.Count() << ",\n" <<
+        "    \"min\": " << (double)totalLatency.Min() / 1000.0 << ",\n" <<
+        "    \"max\": " << (double)totalLatency.Max() / 1000.0 << ",\n" <<
+        "    \"mean\": " << totalLatency.Mean() / 1000.0 << ",\n" <<
+        "    \"p50\": " << get_latency_percentile_ms(50.0) << ",\n" <<
+        "    \"p90\": " << get_latency_percentile_ms(90.0) << ",\n" <<
+        "    \"p99\": " << get_latency_percentile_ms(99.0) << ",\n" <<
+        "    \"p999\": " << get_latency_percentile_ms(99.9) << "\n" <<
+        "  }\n" <<
+        "}\n";
+
+    if (Config::JsonFile == "-") {
+        log_msg(std::cout, ss.str());
+        return;
+    }
+    std::fstream out(Config::JsonFile, std::ios::out | std::ios::trunc);
+    if (!out.good()) {
+        log_msg(std::cout, "Open json file " + Config::JsonFile + " fail.\n");
+        return;
+    }
+    out << ss.str();
+    out.close();
 }
 
 static std::string get_task_key(int taskId)
@@ -227,11 +291,11 @@ static taskResult upload_async(const OssClient &client, const std::string &key,
     result.transferSize = get_file_size(fileToUpload);
 
     std::shared_ptr<std::iostream> content = std::make_shared<std::fstream>(fileToUpload, std::ios::in|std::ios::binary);
+    result.startTimePoint = std::chrono::system_clock::now();
+
     auto outcomeCallable = client.PutObjectCallable(PutObjectRequest(Config::BucketName, key, content));
     auto outcome = outcomeCallable.get();
 
-    result.startTimePoint = std::chrono::system_clock::now();
-
     result.success = outcome.isSuccess();
     result.stopTimePoint = std::chrono::system_clock::now();
     return result;
@@ -435,6 +499,7 @@ static void runSingleTask(int taskId)
     int64_t taskTransferDurationMs = 0;
     int taskSucessCnt = 0;
     int taskFailCnt   = 0;
+    LatencyHistogram taskLatency;
 
     ClientConfiguration conf;
     auto rateLimiter = std::make_shared<DefaultRateLimiter>();
@@ -498,12 +563,14 @@ static void runSingleTask(int taskId)
 
             taskMinTransferDurationMs = std::min(trasnferDuration, taskMinTransferDurationMs);
             taskMaxTransferDurationMs = std::max(trasnferDuration, taskMaxTransferDurationMs);
+            taskLatency.record(static_cast<uint64_t>(
+                (std::chrono::duration_cast<std::chrono::microseconds>(result.stopTimePoint - result.startTimePoint)).count()));
         }
         else {
             taskFailCnt += 1;
         }
 
-        if (Config::DumpDetail || Config::PrintPercentile) {
+        if (Config::DumpDetail) {
             result.taskId = taskId;
             result.seqNum = runIndex;
             resultVec.push_back(result);
@@ -538,6 +605,7 @@ static void runSingleTask(int taskId)
     totalFailCnt += taskFailCnt;
     minTransferDurationMS = std::min(minTransferDurationMS, taskMinTransferDurationMs);
     maxTransferDurationMS = std::max(maxTransferDurationMS, taskMaxTransferDurationMs);
+    totalLatency.merge(taskLatency);
     }
 
 }
@@ -556,6 +624,7 @@ void statistic_report_begin()
     totalStartTimePoint = std::chrono::system_clock::now();
     totalSucessCnt = 0;
     totalFailCnt = 0;
+    totalLatency = LatencyHistogram();
     totalResults.resize(Config::Multithread);
     std::stringstream ss;
     ss << std::endl <<"The Begin : StartTime =" << to_datetime_string(totalStartTimePoint) << std::endl;
@@ -589,13 +658,18 @@ void statistic_report_end()
                                 ", Latency(min,max,avg)=(" << minTransferDurationMS << "," << maxTransferDurationMS << "," << avgTrasnferDurationMs << ") Ms";
     
     if (Config::PrintPercentile) {
-        int64_t per90, per95;
-        get_90th_95th_latency_percentile(per90, per95);
-        ss << ", Latency Percentile(90th, 95th) Ms=(" << per90 << "," << per95 << ")";
+        ss << ", Latency Percentile(50th, 90th, 99th, 99.9th) Ms=(" << get_latency_percentile_ms(50.0) <<
+            "," << get_latency_percentile_ms(90.0) <<
+            "," << get_latency_percentile_ms(99.0) <<
+            "," << get_latency_percentile_ms(99.9) << ")";
     }
     ss << std::endl;
     log_msg(std::cout, ss.str());
 
+    if (!Config::JsonFile.empty()) {
+        write_json_report(totalTimeMS, transferSizeMB, transferRateMBPerS);
+    }
+
     if (Config::DumpDetail) {
         log_result_detail_msg(std::cout);
     }
@@ -616,12 +690,48 @@ int main(int argc, char **argv)
         return 0;
     }
 
-    if (Config::LoadCfgFile() != 0) {
+    if (Config::UseEmulator) {
+#ifdef USE_OSS_EMULATOR
+        Config::AccessKeyId = "emulator";
+        Config::AccessKeySecret = "emulator";
+        if (Config::BucketName.empty()) {
+            Config::BucketName = "ptest-emulator";
+        }
+#else
+        std::cout << "The OSS emulator is not supported on this platform." << std::endl;
+        return 0;
+#endif
+    }
+    else if (Config::LoadCfgFile() != 0) {
         return 0;
     }
 
     AlibabaCloud::OSS::InitializeSdk();
 
+#ifdef USE_OSS_EMULATOR
+    OssEmulator emulator;
+    if (Config::UseEmulator) {
+        if (!emulator.start()) {
+            std::cout << "Start the OSS emulator fail." << std::endl;
+            AlibabaCloud::OSS::ShutdownSdk();
+            return 0;
+        }
+        Config::Endpoint = emulator.Endpoint();
+
+        //the download commands read the local file back from the emulator
+        if (Config::Command.compare(0, 8, "download") == 0) {
+            std::fstream in(Config::BaseLocalFile, std::ios::in | std::ios::binary);
+            if (!in.good()) {
+                std::cout << "Open the local file " << Config::BaseLocalFile << " to seed the OSS emulator fail." << std::endl;
+                AlibabaCloud::OSS::ShutdownSdk();
+                return 0;
+            }
+            std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            emulator.putObject(Config::BucketName, Config::BaseRemoteKey, std::move(data));
+        }
+    }
+#endif
+
     if (Config::Debug) {
         AlibabaCloud::OSS::SetLogLevel(AlibabaCloud::OSS::LogLevel::LogAll);
         AlibabaCloud::OSS::SetLogCallback(LogCallbackFunc);
@@ -36,6 +36,13 @@ namespace OSS
     /*Log*/
     void ALIBABACLOUD_OSS_EXPORT SetLogLevel(LogLevel level);
     void ALIBABACLOUD_OSS_EXPORT SetLogCallback(LogCallback callback);
+    /* pass the log lines to the callback from a background thread, bufferSize bytes are kept for each
+       logging thread, a line which doesn't fit is dropped. Also enabled by OSS_SDK_LOG_ASYNC=1 */
+    void ALIBABACLOUD_OSS_EXPORT EnableAsyncLog(size_t bufferSize = 256 * 1024);
+    /* pass the queued lines to the callback and log synchronously again */
+    void ALIBABACLOUD_OSS_EXPORT DisableAsyncLog();
+    void ALIBABACLOUD_OSS_EXPORT FlushLog();
+    uint64_t ALIBABACLOUD_OSS_EXPORT GetDroppedLogCount();
 
     /*Utils*/
     std::string ALIBABACLOUD_OSS_EXPORT ComputeContentMD5(const char *data, size_t size);
@@ -26,6 +26,7 @@ namespace AlibabaCloud
 namespace OSS
 {
     class EncryptionResumableDownloader;
+    class ContentKeyCache;
     class EncryptionResumableUploader;
     class ALIBABACLOUD_OSS_EXPORT OssEncryptionClient : public OssClient
     {
@@ -88,6 +89,7 @@ namespace OSS
     private:
         std::shared_ptr<EncryptionMaterials> encryptionMaterials_;
         CryptoConfiguration cryptoConfig_;
+        std::shared_ptr<ContentKeyCache> keyCache_;
     };
 }
 }
@@ -28,6 +28,7 @@ namespace OSS
     using CommonPrefixeList = std::vector<std::string>;
 
     class OssClientImpl;
+    class XmlDocument;
     class ALIBABACLOUD_OSS_EXPORT OssResult
     {
     public:
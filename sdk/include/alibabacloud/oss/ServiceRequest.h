@@ -30,6 +30,7 @@ namespace OSS
     const int REQUEST_FLAG_CHECK_CRC64   = (1 << 2);
     const int REQUEST_FLAG_SAVE_CLIENT_CRC64 = (1 << 3);
     const int REQUEST_FLAG_CHUNKED_ENCODING = (1 << 4);
+    const int REQUEST_FLAG_ACCEPT_GZIP = (1 << 5);
 
     class ALIBABACLOUD_OSS_EXPORT ServiceRequest
     {
@@ -40,12 +41,16 @@ namespace OSS
         virtual HeaderCollection Headers() const = 0;
         virtual ParameterCollection Parameters() const = 0;
         virtual std::shared_ptr<std::iostream> Body() const = 0;
+        /* the name of the operation in metrics and request events, e.g. PutObject */
+        virtual const char* OperationName() const { return "Request"; }
 
         int Flags() const;
         void setFlags(int flags);
 
         const IOStreamFactory& ResponseStreamFactory() const;
         void setResponseStreamFactory(const IOStreamFactory& factory);
+        /* true until setResponseStreamFactory is called, the body then goes to a new std::stringstream */
+        bool hasDefaultResponseStreamFactory() const;
         
         const AlibabaCloud::OSS::TransferProgress& TransferProgress() const;
         void setTransferProgress(const AlibabaCloud::OSS::TransferProgress& arg);
@@ -57,6 +62,7 @@ namespace OSS
         int flags_;
         std::string path_;
         IOStreamFactory responseStreamFactory_;
+        bool defaultResponseStreamFactory_;
         AlibabaCloud::OSS::TransferProgress transferProgress_;
     };
 }
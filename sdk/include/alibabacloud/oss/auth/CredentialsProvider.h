@@ -15,6 +15,12 @@
  */
 
 #pragma once
+#include <ctime>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include "Credentials.h"
 
 namespace AlibabaCloud
@@ -27,6 +33,12 @@ namespace OSS
         CredentialsProvider() = default;
         virtual ~CredentialsProvider();
         virtual Credentials getCredentials() = 0;
+        /**
+        * Returns an immutable view of the current credentials. The default
+        * implementation wraps getCredentials(); providers that cache their
+        * credentials override it to hand out the cached object without copying.
+        */
+        virtual std::shared_ptr<const Credentials> getCredentialsSnapshot();
     private:
 
     };
@@ -40,8 +52,9 @@ namespace OSS
         ~SimpleCredentialsProvider();
 
         virtual Credentials getCredentials() override;
+        virtual std::shared_ptr<const Credentials> getCredentialsSnapshot() override;
     private:
-        Credentials credentials_;
+        std::shared_ptr<const Credentials> credentials_;
     };
 
     class ALIBABACLOUD_OSS_EXPORT EnvironmentVariableCredentialsProvider : public CredentialsProvider
@@ -49,5 +62,80 @@ namespace OSS
     public:
         Credentials getCredentials() override;
     };
+
+    class HttpClient;
+    class ALIBABACLOUD_OSS_EXPORT CredentialsFetcher
+    {
+    public:
+        CredentialsFetcher() = default;
+        virtual ~CredentialsFetcher();
+        /**
+        * Fetch a new set of credentials. expiration is the unix time at which they
+        * stop being valid, 0 if they never expire. Returns false on failure.
+        */
+        virtual bool fetch(Credentials& credentials, std::time_t& expiration) = 0;
+    };
+
+    /**
+    * Reads credentials from a json file in the STS/ECS RAM role format:
+    * {"AccessKeyId":"", "AccessKeySecret":"", "SecurityToken":"", "Expiration":"2017-11-01T05:20:02Z"}
+    */
+    class ALIBABACLOUD_OSS_EXPORT FileCredentialsFetcher : public CredentialsFetcher
+    {
+    public:
+        FileCredentialsFetcher(const std::string& filePath);
+        ~FileCredentialsFetcher();
+        bool fetch(Credentials& credentials, std::time_t& expiration) override;
+    private:
+        std::string filePath_;
+    };
+
+    /**
+    * Fetches credentials with a GET request to a url (e.g. the ECS metadata service or
+    * a local credentials server). The response body uses the same json format as
+    * FileCredentialsFetcher.
+    */
+    class ALIBABACLOUD_OSS_EXPORT HttpCredentialsFetcher : public CredentialsFetcher
+    {
+    public:
+        HttpCredentialsFetcher(const std::string& url, long timeoutMs = 5000);
+        ~HttpCredentialsFetcher();
+        bool fetch(Credentials& credentials, std::time_t& expiration) override;
+    private:
+        std::string url_;
+        std::shared_ptr<HttpClient> httpClient_;
+    };
+
+    /**
+    * Caches the credentials returned by a CredentialsFetcher and refreshes them on a
+    * background thread before they expire, so requests never wait on the fetcher.
+    * Readers get the current credentials through an atomic shared_ptr load.
+    * Without a fetcher the credentials stay empty and no refresh thread is started.
+    */
+    class ALIBABACLOUD_OSS_EXPORT RefreshableCredentialsProvider : public CredentialsProvider
+    {
+    public:
+        RefreshableCredentialsProvider(const std::shared_ptr<CredentialsFetcher>& fetcher,
+            long refreshAheadSeconds = 300, long retryIntervalMs = 5000);
+        ~RefreshableCredentialsProvider();
+
+        virtual Credentials getCredentials() override;
+        virtual std::shared_ptr<const Credentials> getCredentialsSnapshot() override;
+        std::time_t Expiration() const;
+        bool refresh();
+    private:
+        void refreshLoop();
+        std::shared_ptr<CredentialsFetcher> fetcher_;
+        long refreshAheadSeconds_;
+        long retryIntervalMs_;
+        std::shared_ptr<const Credentials> credentials_;
+        std::atomic<std::time_t> expiration_;
+        std::atomic<bool> lastRefreshOk_;
+        std::mutex refreshLock_;
+        std::mutex lock_;
+        std::condition_variable signal_;
+        bool shutdown_;
+        std::thread thread_;
+    };
 }
 }
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <alibabacloud/oss/OssClient.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* the objects of a chunk which could not be deleted, with the error of the last attempt */
+    class ALIBABACLOUD_OSS_EXPORT BulkDeleteError
+    {
+    public:
+        BulkDeleteError(const OssError& error, ObjectIdentifierList&& objects) :
+            error_(error), objects_(std::move(objects)) {}
+        const OssError& Error() const { return error_; }
+        const ObjectIdentifierList& Objects() const { return objects_; }
+    private:
+        OssError error_;
+        ObjectIdentifierList objects_;
+    };
+    using BulkDeleteErrorList = std::vector<BulkDeleteError>;
+
+    /**
+    * Deletes any number of objects. Keys are taken one by one, from a prefix listing or
+    * from a version listing, grouped into quiet mode requests of up to 1000 keys and sent
+    * by several threads at a time. A failed request is retried as a whole, the keys of a
+    * request which still fails are reported by Errors().
+    * The client must outlive the deleter.
+    */
+    class ALIBABACLOUD_OSS_EXPORT BulkObjectDeleter
+    {
+    public:
+        BulkObjectDeleter(const OssClient& client, const std::string& bucket);
+        ~BulkObjectDeleter();
+        BulkObjectDeleter(const BulkObjectDeleter&) = delete;
+        BulkObjectDeleter& operator=(const BulkObjectDeleter&) = delete;
+
+        void setConcurrency(int value) { concurrency_ = value > 0 ? value : 1; }
+        void setMaxRetries(int value) { maxRetries_ = value; }
+        void setRequestPayer(RequestPayer value) { requestPayer_ = value; }
+
+        /* blocks while too many requests are waiting to be sent */
+        void addKey(const std::string& key);
+        void addObject(const ObjectIdentifier& object);
+        /* lists and deletes all the objects under the prefix */
+        bool deletePrefix(const std::string& prefix);
+        /* lists and deletes all the versions and delete markers under the prefix */
+        bool deleteVersions(const std::string& prefix);
+        /* sends the pending keys and waits for all the requests */
+        void flush();
+
+        uint64_t DeletedCount() const { return deletedCount_; }
+        uint64_t FailedCount() const { return failedCount_; }
+        /* set when a listing of deletePrefix or deleteVersions failed */
+        const OssError& ListError() const { return listError_; }
+        BulkDeleteErrorList Errors() const;
+
+    private:
+        struct Chunk
+        {
+            ObjectIdentifierList objects;
+            bool versioned;
+        };
+        void dispatch();
+        void workLoop();
+        OssError deleteChunk(const Chunk& chunk);
+
+        const OssClient& client_;
+        std::string bucket_;
+        int concurrency_;
+        int maxRetries_;
+        RequestPayer requestPayer_;
+
+        Chunk pending_;
+        mutable std::mutex lock_;
+        std::condition_variable signal_;
+        std::deque<Chunk> chunks_;
+        std::vector<std::thread> workers_;
+        bool closing_;
+        std::atomic<uint64_t> deletedCount_;
+        std::atomic<uint64_t> failedCount_;
+        BulkDeleteErrorList errors_;
+        OssError listError_;
+    };
+}
+}
@@ -21,6 +21,7 @@
 #include <alibabacloud/oss/auth/CredentialsProvider.h>
 #include <alibabacloud/oss/http/HttpClient.h>
 #include <alibabacloud/oss/http/HttpInterceptor.h>
+#include <alibabacloud/oss/http/RequestObserver.h>
 #include <alibabacloud/oss/utils/Executor.h>
 
 namespace AlibabaCloud
@@ -29,6 +30,10 @@ namespace OSS
 {
     class RetryStrategy;
     class RateLimiter;
+    class MetricsRegistry;
+    class ObjectContentCache;
+    class ObjectMetaCache;
+    class ObjectBlockCache;
     class ALIBABACLOUD_OSS_EXPORT ClientConfiguration
     {
     public:
@@ -141,6 +146,37 @@ namespace OSS
         * Your http interceptor implement
         */
         std::shared_ptr<HttpInterceptor> httpInterceptor;
+
+        /**
+        * Registry to collect request metrics. default is nullptr, no metrics are collected.
+        */
+        std::shared_ptr<MetricsRegistry> metrics;
+
+        /**
+        * Observer of the lifecycle events of the requests. default is nullptr.
+        */
+        std::shared_ptr<RequestObserver> requestObserver;
+
+        /**
+        * Cache of the contents of GetObject, may be shared by several clients. default is nullptr, no content is cached.
+        */
+        std::shared_ptr<ObjectContentCache> contentCache;
+
+        /**
+        * Cache of the answers of HeadObject and GetObjectMeta, may be shared by several clients. default is nullptr.
+        */
+        std::shared_ptr<ObjectMetaCache> metaCache;
+
+        /**
+        * Local disk cache of the blocks read by ranged GetObject. default is nullptr.
+        */
+        std::shared_ptr<ObjectBlockCache> blockCache;
+
+        /**
+        * enable or disable sharing one request between concurrent identical GetObject, HeadObject
+        * and GetObjectMeta calls. default is false.
+        */
+        bool enableReadCoalescing;
     };
 }
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <alibabacloud/oss/OssClient.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * Walks all the pages of a ListObjectsV2 request. The next pages are listed by a
+    * background thread while the caller consumes the current one.
+    * prefetchDepth is the number of pages listed ahead of the caller, maxBufferedBytes
+    * bounds the (estimated) memory held by those pages, 0 means no limit.
+    * The client must outlive the paginator.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ListObjectsV2Paginator
+    {
+    public:
+        class ALIBABACLOUD_OSS_EXPORT Iterator
+        {
+        public:
+            Iterator() : paginator_(nullptr), outcome_() {}
+            const ListObjectsV2Outcome& operator*() const { return outcome_; }
+            const ListObjectsV2Outcome* operator->() const { return &outcome_; }
+            Iterator& operator++();
+            bool operator==(const Iterator& rhs) const { return paginator_ == rhs.paginator_; }
+            bool operator!=(const Iterator& rhs) const { return paginator_ != rhs.paginator_; }
+        private:
+            friend class ListObjectsV2Paginator;
+            explicit Iterator(ListObjectsV2Paginator* paginator);
+            ListObjectsV2Paginator* paginator_;
+            ListObjectsV2Outcome outcome_;
+        };
+
+        ListObjectsV2Paginator(const OssClient& client, const ListObjectsV2Request& request,
+            size_t prefetchDepth = 1, size_t maxBufferedBytes = 0);
+        ~ListObjectsV2Paginator();
+        ListObjectsV2Paginator(const ListObjectsV2Paginator&) = delete;
+        ListObjectsV2Paginator& operator=(const ListObjectsV2Paginator&) = delete;
+
+        /* blocks until the next page is listed, false once all pages or a failed page are consumed */
+        bool hasNext();
+        ListObjectsV2Outcome next();
+        Iterator begin();
+        Iterator end() { return Iterator(); }
+
+    private:
+        struct Page
+        {
+            ListObjectsV2Outcome outcome;
+            size_t size;
+        };
+        void prefetchLoop();
+        bool canPrefetch() const;
+        static size_t EstimateSize(const ListObjectsV2Result& result);
+
+        const OssClient& client_;
+        ListObjectsV2Request request_;
+        size_t prefetchDepth_;
+        size_t maxBufferedBytes_;
+        std::mutex lock_;
+        std::condition_variable signal_;
+        std::deque<Page> pages_;
+        size_t bufferedBytes_;
+        bool finished_;
+        bool shutdown_;
+        std::thread thread_;
+    };
+}
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <alibabacloud/oss/Export.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * A log-linear (HDR style) histogram of microsecond values. Every power of two is split
+    * into 32 buckets, so a recorded value is kept with a relative error of about 3%.
+    */
+    class ALIBABACLOUD_OSS_EXPORT LatencyHistogram
+    {
+    public:
+        static const size_t SUB_BUCKET_COUNT = 32;
+        static const size_t BUCKET_COUNT = 1184;
+
+        LatencyHistogram();
+        void record(uint64_t micros, uint64_t count = 1);
+        void merge(const LatencyHistogram& other);
+
+        uint64_t Count() const { return count_; }
+        uint64_t Sum() const { return sum_; }
+        uint64_t Min() const;
+        uint64_t Max() const;
+        double Mean() const;
+        /* the highest value equivalent to the value at the percentile, p is in [0, 100] */
+        uint64_t ValueAtPercentile(double p) const;
+        /* the number of values not greater than the micros */
+        uint64_t CountAtOrBelow(uint64_t micros) const;
+        const std::vector<uint64_t>& Buckets() const { return buckets_; }
+
+        static size_t BucketIndex(uint64_t micros);
+        static uint64_t BucketLowerBound(size_t index);
+        static uint64_t BucketUpperBound(size_t index);
+    private:
+        friend class MetricsRegistry;
+        void subtract(const LatencyHistogram& other);
+        std::vector<uint64_t> buckets_;
+        uint64_t count_;
+        uint64_t sum_;
+    };
+
+    /* the stages of the request pipeline whose thread cpu time is accounted */
+    enum class CpuStage
+    {
+        Build = 0,      /* headers, parameters and url of the http request */
+        Sign,
+        Checksum,       /* crc64 and md5 of the content */
+        Encryption,
+        Parse,          /* xml of the results and the errors */
+        Log,
+        Count
+    };
+
+    class ALIBABACLOUD_OSS_EXPORT OperationMetrics
+    {
+    public:
+        OperationMetrics();
+        uint64_t Requests() const { return requests_; }
+        uint64_t Errors() const { return errors_; }
+        uint64_t Retries() const { return retries_; }
+        /* the time of the whole operation, retries included */
+        const LatencyHistogram& Latency() const { return latency_; }
+        /* the thread cpu time of the operation, zero unless MetricsRegistry::EnableStageCpu */
+        uint64_t CpuNanos() const { return cpuNanos_; }
+        /* the part of CpuNanos spent in the stage, the rest is the http transfer and the sdk glue */
+        uint64_t StageCpuNanos(CpuStage stage) const { return stageCpuNanos_[static_cast<int>(stage)]; }
+    private:
+        friend class MetricsRegistry;
+        uint64_t requests_;
+        uint64_t errors_;
+        uint64_t retries_;
+        LatencyHistogram latency_;
+        uint64_t cpuNanos_;
+        uint64_t stageCpuNanos_[static_cast<int>(CpuStage::Count)];
+    };
+    using OperationMetricsMap = std::map<std::string, OperationMetrics>;
+
+    class ALIBABACLOUD_OSS_EXPORT MetricsSnapshot
+    {
+    public:
+        MetricsSnapshot();
+        /* keyed by the operation name, e.g. PutObject */
+        const OperationMetricsMap& Operations() const { return operations_; }
+        const std::map<std::string, uint64_t>& RetriesByErrorCode() const { return retriesByErrorCode_; }
+        uint64_t BytesSent() const { return bytesSent_; }
+        uint64_t BytesReceived() const { return bytesReceived_; }
+        uint64_t CrcFailures() const { return crcFailures_; }
+        int64_t CurlPoolSize() const { return curlPoolSize_; }
+        const LatencyHistogram& CurlAcquireWait() const { return curlAcquireWait_; }
+        int64_t ExecutorQueueDepth() const { return executorQueueDepth_; }
+
+        /* the snapshot in the prometheus text exposition format */
+        std::string PrometheusText(const std::string& prefix = "oss_sdk") const;
+    private:
+        friend class MetricsRegistry;
+        OperationMetricsMap operations_;
+        std::map<std::string, uint64_t> retriesByErrorCode_;
+        uint64_t bytesSent_;
+        uint64_t bytesReceived_;
+        uint64_t crcFailures_;
+        int64_t curlPoolSize_;
+        LatencyHistogram curlAcquireWait_;
+        int64_t executorQueueDepth_;
+    };
+
+    /**
+    * Collects the metrics of the clients which share it through ClientConfiguration::metrics.
+    * Counters and histograms are kept per thread, the recording thread only writes its own
+    * counters with plain relaxed stores; Snapshot merges all the threads. The counters of a
+    * thread are folded into one shared total when the thread exits. Reset sets the
+    * counters back to zero, the gauges (curl pool size, executor queue depth) are kept.
+    *
+    * EnableStageCpu turns on the thread cpu time accounting of the operations and their
+    * stages. A stage nested in another one is only charged to the inner stage. The stages
+    * run right after an operation on the same thread, e.g. parsing its result, are charged
+    * to that operation. Reading the thread cpu clock costs a system call on some platforms,
+    * so it is off by default.
+    */
+    class ALIBABACLOUD_OSS_EXPORT MetricsRegistry
+    {
+    public:
+        MetricsRegistry();
+        ~MetricsRegistry();
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        MetricsSnapshot Snapshot() const;
+        void Reset();
+        std::string PrometheusText(const std::string& prefix = "oss_sdk") const;
+        void EnableStageCpu(bool enable) { stageCpu_ = enable; }
+        bool StageCpuEnabled() const { return stageCpu_.load(std::memory_order_relaxed); }
+
+        /* recording, called by the sdk, the operation is a name with static storage, see ServiceRequest::OperationName */
+        void recordRequest(const char* operation, bool success, int retries, uint64_t latencyMicros);
+        void recordRetry(const std::string& errorCode);
+        void recordTransfer(uint64_t sent, uint64_t received);
+        void recordCrcFailure();
+        void recordCurlAcquireWait(uint64_t micros);
+        /* stageNanos holds CpuStage::Count values */
+        void recordCpu(const char* operation, uint64_t cpuNanos, const uint64_t* stageNanos);
+        void adjustCurlPoolSize(int64_t delta) { curlPoolSize_ += delta; }
+        void adjustExecutorQueueDepth(int64_t delta) { executorQueueDepth_ += delta; }
+
+        /* CpuStage::Sign -> sign */
+        static const char* StageName(CpuStage stage);
+    private:
+        struct Shard;
+        struct ShardList;
+        struct LocalShardList;
+        Shard& localShard();
+        MetricsSnapshot collect() const;
+        static LocalShardList& localShards();
+        static void collectShard(Shard& shard, MetricsSnapshot& snapshot);
+        static void retireShard(ShardList& list, const std::shared_ptr<Shard>& shard);
+
+        const uint64_t id_;
+        mutable std::mutex lock_;
+        std::shared_ptr<ShardList> shards_;
+        MetricsSnapshot baseline_;
+        std::atomic<int64_t> curlPoolSize_;
+        std::atomic<int64_t> executorQueueDepth_;
+        std::atomic<bool> stageCpu_;
+    };
+}
+}
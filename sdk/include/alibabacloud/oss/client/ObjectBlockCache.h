@@ -0,0 +1,94 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <alibabacloud/oss/Export.h>
+#include <alibabacloud/oss/Types.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * A persistent cache of fixed size, aligned blocks of objects on a local disk, set in
+    * ClientConfiguration::blockCache for ranged GetObject reads. A block is kept by bucket, key,
+    * etag and block index, so a changed object never reads the blocks of its old content.
+    * The blocks live in the slots of a data file, the slots are described by an index file
+    * mapped in memory, and the least recently used slot is reused once the budget is full.
+    * A slot is marked free before its data is written and valid after, and every block carries
+    * its crc64, so the cache left by a crashed process is reused safely by the next one.
+    * The etag and size of an object are taken from HeadObject, and trusted for freshSeconds.
+    * A directory is used by one cache at a time, IsOpen is false when it can not be used.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ObjectBlockCache
+    {
+    public:
+        struct ObjectState
+        {
+            std::string eTag;
+            int64_t size;
+            /* the headers of HeadObject, the base of the headers of the reads served by the cache */
+            HeaderCollection headers;
+        };
+
+        /**
+        * capacityBytes: the size of the data file, a multiple of blockSize.
+        * readaheadBlocks: the blocks after a read which are fetched together with its missing blocks.
+        */
+        ObjectBlockCache(const std::string& directory, uint64_t capacityBytes, uint32_t blockSize = 1024 * 1024,
+            uint32_t readaheadBlocks = 0, int64_t freshSeconds = 60);
+        ~ObjectBlockCache();
+
+        bool IsOpen() const;
+        uint32_t BlockSize() const { return blockSize_; }
+        uint32_t ReadaheadBlocks() const { return readaheadBlocks_; }
+
+        /* the data of a block, false when it is not kept or its crc64 does not match */
+        bool readBlock(const std::string& bucket, const std::string& key, const std::string& eTag,
+            uint64_t index, std::string& data);
+        void writeBlock(const std::string& bucket, const std::string& key, const std::string& eTag,
+            uint64_t index, const char* data, size_t length);
+
+        /* the etag and size of an object which are fresh enough to be trusted */
+        bool findObject(const std::string& bucket, const std::string& key, const std::string& versionId, ObjectState& state);
+        void putObject(const std::string& bucket, const std::string& key, const std::string& versionId, const ObjectState& state);
+        /* forgets the etag and size of every version of the object, its blocks are not read again */
+        void invalidate(const std::string& bucket, const std::string& key);
+
+        uint64_t Hits() const { return hits_.load(); }
+        uint64_t Misses() const { return misses_.load(); }
+        uint64_t Evictions() const { return evictions_.load(); }
+        uint64_t CorruptBlocks() const { return corruptBlocks_.load(); }
+        uint64_t BytesFromCache() const { return bytesFromCache_.load(); }
+        size_t Blocks() const;
+
+    private:
+        class Store;
+        std::unique_ptr<Store> store_;
+        const uint32_t blockSize_;
+        const uint32_t readaheadBlocks_;
+        const int64_t freshSeconds_;
+        std::atomic<uint64_t> hits_;
+        std::atomic<uint64_t> misses_;
+        std::atomic<uint64_t> evictions_;
+        std::atomic<uint64_t> corruptBlocks_;
+        std::atomic<uint64_t> bytesFromCache_;
+    };
+}
+}
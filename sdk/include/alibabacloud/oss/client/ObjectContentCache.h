@@ -0,0 +1,97 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <alibabacloud/oss/Export.h>
+#include <alibabacloud/oss/Types.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * An in-process cache of the contents of GetObject, shared by the clients which set it in
+    * ClientConfiguration::contentCache. The entries are kept by bucket, key, version and range in
+    * lru lists bounded by bytes, each shard has its own lock. An entry older than freshSeconds is
+    * revalidated with If-None-Match and its etag, a 304 answer serves it again without the content.
+    * Put, Append, Copy, Delete and CompleteMultipartUpload of the same client drop the entries of the object.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ObjectContentCache
+    {
+    public:
+        struct Entry
+        {
+            std::shared_ptr<const std::string> content;
+            HeaderCollection headers;
+            std::string eTag;
+            bool fresh;
+            /* set by find, put does not keep a content when the object is invalidated meanwhile */
+            uint64_t epoch;
+        };
+
+        /**
+        * capacityBytes: the size of the contents kept, split evenly between the shards.
+        * freshSeconds: the time an entry is served without asking the server, 0 revalidates every read.
+        * maxObjectBytes: bigger contents are not kept.
+        */
+        ObjectContentCache(uint64_t capacityBytes, int64_t freshSeconds = 60,
+            uint64_t maxObjectBytes = 1024 * 1024, size_t shardCount = 16);
+        ~ObjectContentCache();
+
+        /* false when nothing is kept, the variant tells the version and the range of the object apart */
+        bool find(const std::string& bucket, const std::string& key, const std::string& variant, Entry& entry);
+        void put(const std::string& bucket, const std::string& key, const std::string& variant,
+            const std::shared_ptr<const std::string>& content, const HeaderCollection& headers, uint64_t epoch);
+        /* the answer to the revalidation of a stale entry, unchanged is a 304 */
+        void revalidated(const std::string& bucket, const std::string& key, const std::string& variant, bool unchanged);
+        /* drops every version and range of the object */
+        void invalidate(const std::string& bucket, const std::string& key);
+        void clear();
+
+        uint64_t MaxObjectBytes() const { return maxObjectBytes_; }
+        /* reads served without the content, revalidated ones included */
+        uint64_t Hits() const { return hits_.load(); }
+        /* reads whose content came from the server */
+        uint64_t Misses() const { return misses_.load(); }
+        /* hits which needed a 304 round trip */
+        uint64_t Revalidations() const { return revalidations_.load(); }
+        uint64_t HitBytes() const { return hitBytes_.load(); }
+        uint64_t Evictions() const { return evictions_.load(); }
+        uint64_t Invalidations() const { return invalidations_.load(); }
+        size_t Size() const;
+        uint64_t Bytes() const;
+
+    private:
+        class Shard;
+        Shard& shardOf(const std::string& objectId) const;
+        static std::string ObjectId(const std::string& bucket, const std::string& key);
+
+        const int64_t freshSeconds_;
+        const uint64_t maxObjectBytes_;
+        std::vector<std::unique_ptr<Shard>> shards_;
+        std::atomic<uint64_t> hits_;
+        std::atomic<uint64_t> misses_;
+        std::atomic<uint64_t> revalidations_;
+        std::atomic<uint64_t> hitBytes_;
+        std::atomic<uint64_t> evictions_;
+        std::atomic<uint64_t> invalidations_;
+    };
+}
+}
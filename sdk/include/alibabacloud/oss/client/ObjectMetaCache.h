@@ -0,0 +1,102 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <alibabacloud/oss/Export.h>
+#include <alibabacloud/oss/Types.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * An in-process cache of the answers of HeadObject and GetObjectMeta, shared by the clients which
+    * set it in ClientConfiguration::metaCache. The headers of HeadObject and of full GetObject reads are
+    * complete and serve both calls. The headers of GetObjectMeta and the summaries of ListObjectsV2 hold
+    * the size, etag and last modified time only, they serve GetObjectMeta. Missing objects are kept as
+    * negative entries with their own time to live. Every shard is an lru list bounded by entries.
+    * The mutations of the same client drop the entries of the object. Every shard has an epoch bumped
+    * by its invalidations, a fill is dropped when the shard of its object was invalidated meanwhile.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ObjectMetaCache
+    {
+    public:
+        struct Entry
+        {
+            HeaderCollection headers;
+            /* false for a negative entry, the error tells why */
+            bool exists;
+            std::string errorCode;
+            std::string errorMessage;
+        };
+
+        /**
+        * maxEntries: the objects kept, split evenly between the shards.
+        * ttlSeconds: the time an entry of an existing object is served.
+        * negativeTtlSeconds: the time an entry of a missing object is served.
+        */
+        ObjectMetaCache(size_t maxEntries = 10000, int64_t ttlSeconds = 60,
+            int64_t negativeTtlSeconds = 5, size_t shardCount = 16);
+        ~ObjectMetaCache();
+
+        /* false when nothing usable is kept, complete asks for the headers of HeadObject */
+        bool find(const std::string& bucket, const std::string& key, const std::string& versionId, bool complete, Entry& entry);
+        /* the epoch is read before the request, a put is dropped when the shard was invalidated meanwhile */
+        void put(const std::string& bucket, const std::string& key, const std::string& versionId,
+            const HeaderCollection& headers, bool complete, uint64_t epoch);
+        void putMissing(const std::string& bucket, const std::string& key, const std::string& versionId,
+            const std::string& errorCode, const std::string& errorMessage, uint64_t epoch);
+        /* drops every version of the object */
+        void invalidate(const std::string& bucket, const std::string& key);
+        void clear();
+        /* the epoch of the shard of the object */
+        uint64_t Epoch(const std::string& bucket, const std::string& key) const;
+        /* the epochs of every shard, for the fills of a listing whose keys are not known before */
+        std::vector<uint64_t> Epochs() const;
+        /* the epoch of the shard of the object in a snapshot of Epochs() */
+        uint64_t Epoch(const std::string& bucket, const std::string& key, const std::vector<uint64_t>& epochs) const;
+
+        /* the hits on negative entries are counted in Hits and NegativeHits */
+        uint64_t Hits() const { return hits_.load(); }
+        uint64_t NegativeHits() const { return negativeHits_.load(); }
+        uint64_t Misses() const { return misses_.load(); }
+        uint64_t Evictions() const { return evictions_.load(); }
+        uint64_t Invalidations() const { return invalidations_.load(); }
+        size_t Size() const;
+
+    private:
+        class Shard;
+        struct Node;
+        size_t shardIndex(const std::string& objectId) const;
+        Shard& shardOf(const std::string& objectId) const;
+        void insert(const std::string& bucket, const std::string& key, const std::string& versionId, Node&& node, uint64_t epoch);
+        static std::string ObjectId(const std::string& bucket, const std::string& key);
+
+        const int64_t ttlSeconds_;
+        const int64_t negativeTtlSeconds_;
+        std::vector<std::unique_ptr<Shard>> shards_;
+        std::atomic<uint64_t> hits_;
+        std::atomic<uint64_t> negativeHits_;
+        std::atomic<uint64_t> misses_;
+        std::atomic<uint64_t> evictions_;
+        std::atomic<uint64_t> invalidations_;
+    };
+}
+}
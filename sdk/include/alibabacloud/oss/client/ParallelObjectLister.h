@@ -0,0 +1,107 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <alibabacloud/oss/OssClient.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * Lists all the objects under a prefix with several concurrent ListObjectsV2 streams.
+    * The key space is split into disjoint shards, either by the caller supplied split keys
+    * or by the CommonPrefixes found with a delimiter listing under the prefix.
+    * The summaries of all the shards are merged into one stream, in key order when
+    * ordered mode is set, otherwise in the order they are received.
+    * Discovery lists the keys directly under the prefix by itself, so a flat key space
+    * should be split by split keys (e.g. sampled from a previous listing).
+    * The client must outlive the lister.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ParallelObjectLister
+    {
+    public:
+        ParallelObjectLister(const OssClient& client, const std::string& bucket, const std::string& prefix = "");
+        ~ParallelObjectLister();
+        ParallelObjectLister(const ParallelObjectLister&) = delete;
+        ParallelObjectLister& operator=(const ParallelObjectLister&) = delete;
+
+        void setConcurrency(int value) { concurrency_ = value > 0 ? value : 1; }
+        void setOrdered(bool value) { ordered_ = value; }
+        void setMaxKeys(int value) { maxKeys_ = value; }
+        void setDelimiter(const std::string& value) { delimiter_ = value; }
+        /* shard i covers the keys in (splitKeys[i-1], splitKeys[i]] */
+        void setSplitKeys(const std::vector<std::string>& value) { splitKeys_ = value; }
+
+        /* blocks until a summary is available, false at the end of the listing or on failure */
+        bool next(ObjectSummary& summary);
+        bool hasError() const { return failed_; }
+        const OssError& Error() const { return error_; }
+        size_t ShardCount() const { return shards_.size(); }
+
+    private:
+        struct Shard
+        {
+            std::string prefix;
+            std::string startAfter;
+            std::string endKey;
+            bool preListed;
+            ObjectSummaryList listed;
+            std::deque<ObjectSummaryList> pages;
+            bool done;
+        };
+        void start();
+        void discover();
+        void addListedShard(const ObjectSummary& summary);
+        void addShard(const std::string& prefix, const std::string& startAfter, const std::string& endKey);
+        void workLoop();
+        void listShard(size_t index);
+        bool pushPage(size_t index, ObjectSummaryList&& page);
+        bool popPage();
+        void setFailed(const OssError& error);
+
+        const OssClient& client_;
+        std::string bucket_;
+        std::string prefix_;
+        std::string delimiter_;
+        std::vector<std::string> splitKeys_;
+        int concurrency_;
+        int maxKeys_;
+        bool ordered_;
+
+        std::mutex lock_;
+        std::condition_variable signal_;
+        std::vector<Shard> shards_;
+        std::deque<ObjectSummaryList> ready_;
+        std::vector<std::thread> workers_;
+        size_t nextShard_;
+        size_t doneShards_;
+        size_t readShard_;
+        bool started_;
+        std::atomic<bool> failed_;
+        bool shutdown_;
+        OssError error_;
+        ObjectSummaryList current_;
+        size_t currentPos_;
+    };
+}
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <alibabacloud/oss/OssClient.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* the outcome of one split range of a parallel select */
+    class ALIBABACLOUD_OSS_EXPORT SelectRangeResult
+    {
+    public:
+        SelectRangeResult(int64_t splitStart, int64_t splitEnd) :
+            splitStart_(splitStart), splitEnd_(splitEnd), done_(false),
+            recordCount_(0), size_(0), crc64_(0), scannedBytes_(0) {}
+        int64_t SplitStart() const { return splitStart_; }
+        int64_t SplitEnd() const { return splitEnd_; }
+        bool Done() const { return done_; }
+        uint64_t RecordCount() const { return recordCount_; }
+        uint64_t Size() const { return size_; }
+        /* crc64 of the output of the range, only reported. the payload of every frame is verified with crc32 */
+        uint64_t CRC64() const { return crc64_; }
+        uint64_t ScannedBytes() const { return scannedBytes_; }
+    private:
+        friend class ParallelSelectExecutor;
+        int64_t splitStart_;
+        int64_t splitEnd_;
+        bool done_;
+        uint64_t recordCount_;
+        uint64_t size_;
+        uint64_t crc64_;
+        uint64_t scannedBytes_;
+    };
+    using SelectRangeResultList = std::vector<SelectRangeResult>;
+
+    /**
+    * Runs a select over a large csv or json lines object as several concurrent SelectObject
+    * requests. The splits of the object are read with CreateSelectObjectMeta and divided into
+    * split ranges; the records of all the ranges are passed to one record handler, in the
+    * order of the ranges when ordered mode is set (the output of a range which finishes
+    * before the ranges in front of it is kept in memory), otherwise as they arrive.
+    * The handler is never called concurrently. The client must outlive the executor.
+    */
+    class ALIBABACLOUD_OSS_EXPORT ParallelSelectExecutor
+    {
+    public:
+        ParallelSelectExecutor(const OssClient& client, const std::string& bucket, const std::string& key,
+            const std::string& expression, const CSVInputFormat& inputFormat, const CSVOutputFormat& outputFormat);
+        ParallelSelectExecutor(const OssClient& client, const std::string& bucket, const std::string& key,
+            const std::string& expression, const JSONInputFormat& inputFormat, const JSONOutputFormat& outputFormat);
+        ParallelSelectExecutor(const ParallelSelectExecutor&) = delete;
+        ParallelSelectExecutor& operator=(const ParallelSelectExecutor&) = delete;
+
+        void setConcurrency(int value) { concurrency_ = value > 0 ? value : 1; }
+        /* 0 means four ranges per concurrent request */
+        void setRangeCount(int value) { rangeCount_ = value > 0 ? value : 0; }
+        void setOrdered(bool value) { ordered_ = value; }
+        void setRecordHandler(const SelectRecordHandler& handler) { handler_ = handler; }
+        void setRequestPayer(RequestPayer value) { requestPayer_ = value; }
+
+        /* blocks until all the ranges are done, false when the meta or a range failed */
+        bool execute();
+        const OssError& Error() const { return error_; }
+        uint32_t SplitsCount() const { return splitsCount_; }
+        const SelectRangeResultList& RangeResults() const { return ranges_; }
+        uint64_t RecordCount() const;
+        uint64_t ScannedBytes() const;
+
+    private:
+        struct RangeOutput
+        {
+            std::string buffer;
+            size_t records;
+            bool done;
+        };
+        bool fetchMeta();
+        void workLoop();
+        bool selectRange(size_t index);
+        void deliver(size_t index, const char* data, size_t size, size_t records);
+        void complete(size_t index);
+        void setFailed(const OssError& error);
+
+        const OssClient& client_;
+        std::string bucket_;
+        std::string key_;
+        std::string expression_;
+        std::function<std::shared_ptr<InputFormat>()> makeInput_;
+        std::shared_ptr<OutputFormat> outputFormat_;
+        int concurrency_;
+        int rangeCount_;
+        bool ordered_;
+        SelectRecordHandler handler_;
+        RequestPayer requestPayer_;
+
+        std::mutex lock_;
+        uint32_t splitsCount_;
+        SelectRangeResultList ranges_;
+        std::vector<RangeOutput> outputs_;
+        size_t nextRange_;
+        size_t current_;
+        bool failed_;
+        OssError error_;
+    };
+}
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <alibabacloud/oss/OssClient.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* a byte range of the object and the buffer of the caller its bytes are written to */
+    class ALIBABACLOUD_OSS_EXPORT ReadRange
+    {
+    public:
+        ReadRange(int64_t offset, int64_t length, char* buffer) :
+            offset_(offset), length_(length), buffer_(buffer), bytesRead_(0) {}
+        int64_t Offset() const { return offset_; }
+        int64_t Length() const { return length_; }
+        char* Buffer() const { return buffer_; }
+        /* less than the length when the range goes past the end of the object */
+        int64_t BytesRead() const { return bytesRead_; }
+    private:
+        friend class VectoredObjectReader;
+        int64_t offset_;
+        int64_t length_;
+        char* buffer_;
+        int64_t bytesRead_;
+    };
+    using ReadRangeList = std::vector<ReadRange>;
+
+    /**
+    * Reads many byte ranges of one object, such as the footer and column chunks of a columnar
+    * file. Ranges whose gap is not larger than the max merge gap are merged into one ranged
+    * GetObject, as long as it stays within the max request size; overlapping ranges are always
+    * merged, and a larger merged span or range is split into requests of nearly the same size.
+    * The merged requests are sent concurrently and their bodies are written straight into the
+    * buffers of the ranges; the bytes of the gaps are dropped. Ranges may overlap and need not
+    * be sorted. The client must outlive the reader.
+    */
+    class ALIBABACLOUD_OSS_EXPORT VectoredObjectReader
+    {
+    public:
+        VectoredObjectReader(const OssClient& client, const std::string& bucket, const std::string& key);
+        VectoredObjectReader(const VectoredObjectReader&) = delete;
+        VectoredObjectReader& operator=(const VectoredObjectReader&) = delete;
+
+        void setConcurrency(int value) { concurrency_ = value > 0 ? value : 1; }
+        /* a negative value disables merging */
+        void setMaxMergeGap(int64_t value) { maxMergeGap_ = value; }
+        void setMaxRequestSize(int64_t value);
+        void setVersionId(const std::string& value) { versionId_ = value; }
+        /* each request is sent with If-Match, so all the ranges come from the same object */
+        void setETag(const std::string& value) { eTag_ = value; }
+        void setRequestPayer(RequestPayer value) { requestPayer_ = value; }
+
+        /* blocks until all the requests are done, false when a range is invalid or a request failed */
+        bool read(ReadRangeList& ranges);
+        const OssError& Error() const { return error_; }
+        /* the number of GetObject requests and the bytes they asked for, gaps included */
+        size_t RequestCount() const { return requests_.size(); }
+        int64_t RequestedBytes() const;
+
+    private:
+        struct MergedRequest
+        {
+            int64_t start;
+            int64_t end;
+            std::vector<size_t> ranges;
+        };
+        void plan(const ReadRangeList& ranges);
+        void workLoop(ReadRangeList& ranges);
+        bool readRequest(const MergedRequest& request, ReadRangeList& ranges);
+        void setFailed(const OssError& error);
+
+        const OssClient& client_;
+        std::string bucket_;
+        std::string key_;
+        int concurrency_;
+        int64_t maxMergeGap_;
+        int64_t maxRequestSize_;
+        std::string versionId_;
+        std::string eTag_;
+        RequestPayer requestPayer_;
+
+        std::mutex lock_;
+        std::vector<MergedRequest> requests_;
+        size_t nextRequest_;
+        bool failed_;
+        OssError error_;
+    };
+}
+}
@@ -43,6 +43,13 @@ namespace OSS
     public:
         CryptoMode cryptoMode;
         CryptoStorageMethod cryptoStorageMethod;
+        /* a wrapped content key is reused for up to this many new objects within
+           cekReuseMaxSeconds, each object still gets its own iv. 0 disables the reuse */
+        uint32_t cekReuseMaxObjects;
+        int64_t cekReuseMaxSeconds;
+        /* unwrapped content keys kept for reads, looked up by the wrapped key. 0 disables the cache */
+        uint32_t cekCacheMaxEntries;
+        int64_t cekCacheMaxSeconds;
     };
 }
 }
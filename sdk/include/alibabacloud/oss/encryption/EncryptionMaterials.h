@@ -31,6 +31,9 @@ namespace OSS
 
         virtual int EncryptCEK(ContentCryptoMaterial& contentCryptoMaterial) = 0;
         virtual int DecryptCEK(ContentCryptoMaterial& contentCryptoMaterial) = 0;
+        /* wraps or unwraps the iv only, used when the content key is reused. -1 when not supported */
+        virtual int EncryptIV(ContentCryptoMaterial& contentCryptoMaterial);
+        virtual int DecryptIV(ContentCryptoMaterial& contentCryptoMaterial);
     };
 
     using RSAEncryptionMaterial = std::pair<std::pair<std::string, std::string>, std::map<std::string, std::string>>;
@@ -45,6 +48,8 @@ namespace OSS
             const std::map<std::string, std::string>& description);
         virtual int EncryptCEK(ContentCryptoMaterial& contentCryptoMaterial);
         virtual int DecryptCEK(ContentCryptoMaterial& contentCryptoMaterial);
+        virtual int EncryptIV(ContentCryptoMaterial& contentCryptoMaterial);
+        virtual int DecryptIV(ContentCryptoMaterial& contentCryptoMaterial);
     private:
         int findIndexByDescription(const std::map<std::string, std::string>& description);
         std::string publicKey_;
@@ -39,7 +39,7 @@ namespace OSS
         bool isEnable();
         void disable();
         void enable();
-        void waitForRetry(long milliseconds);
+        virtual void waitForRetry(long milliseconds);
         
     protected:
         std::atomic<bool> disable_;
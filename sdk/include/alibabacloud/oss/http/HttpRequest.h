@@ -17,10 +17,12 @@
 #pragma once
 
 #include <string>
+#include <memory>
 #include <alibabacloud/oss/Types.h>
 #include <alibabacloud/oss/ServiceRequest.h>
 #include <alibabacloud/oss/http/HttpMessage.h>
 #include <alibabacloud/oss/http/Url.h>
+#include <alibabacloud/oss/http/RequestObserver.h>
 
 namespace AlibabaCloud
 {
@@ -55,6 +57,15 @@ namespace OSS
             void setChunkedEncoding(bool value) { chunkedEncoding_ = value; }
             bool chunkedEncoding() const { return chunkedEncoding_; }
 
+            void setAcceptEncoding(const std::string& value) { acceptEncoding_ = value; }
+            const std::string& acceptEncoding() const { return acceptEncoding_; }
+
+            void setObserver(const std::shared_ptr<RequestObserver>& observer, uint64_t requestId, int attempt);
+            bool hasObserver() const { return observer_ != nullptr; }
+            /* fills the id of the request and calls the observer, nothing is done without observer */
+            void notifyObserver(RequestEvent& event) const;
+            RequestEvent makeEvent(RequestEventType type) const { return RequestEvent(type, requestId_, attempt_); }
+
         private:
             Http::Method method_;
             Url url_;
@@ -64,6 +75,10 @@ namespace OSS
             uint64_t crc64Result_;
             int64_t transferedBytes_;
             bool chunkedEncoding_;
+            std::string acceptEncoding_;
+            std::shared_ptr<RequestObserver> observer_;
+            uint64_t requestId_;
+            int attempt_;
     };
 }
 }
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <alibabacloud/oss/Export.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    class HttpRequest;
+
+    enum class RequestEventType
+    {
+        Built,              /* headers and body are set, before signing */
+        Signed,
+        PoolAcquired,       /* a connection handle is taken from the http client pool */
+        FirstByteSent,      /* the connection is set up and the request starts to be sent */
+        HeadersReceived,
+        Completed,          /* the transfer is finished or failed */
+        RetryScheduled,
+        OutcomeParsed       /* the response is turned into the outcome of the operation */
+    };
+
+    /**
+    * One event of the lifecycle of a request. RequestId is given by the sdk and stays the same
+    * for all the attempts of an operation, Attempt counts from 0. Timestamp is taken from the
+    * steady clock.
+    */
+    class ALIBABACLOUD_OSS_EXPORT RequestEvent
+    {
+    public:
+        RequestEvent(RequestEventType type, uint64_t requestId, int attempt) :
+            type_(type), timestamp_(std::chrono::steady_clock::now()),
+            requestId_(requestId), attempt_(attempt), request_(nullptr),
+            statusCode_(0), bytesSent_(0), bytesReceived_(0), delayMs_(0), success_(false) {}
+
+        RequestEventType Type() const { return type_; }
+        std::chrono::steady_clock::time_point Timestamp() const { return timestamp_; }
+        uint64_t RequestId() const { return requestId_; }
+        int Attempt() const { return attempt_; }
+        /* the operation name, e.g. PutObject, set on Built and OutcomeParsed */
+        const std::string& Operation() const { return operation_; }
+        /* the http request of the attempt, nullptr on RetryScheduled and OutcomeParsed */
+        const HttpRequest* Request() const { return request_; }
+        /* x-oss-request-id, set once the response headers are received */
+        const std::string& ServerRequestId() const { return serverRequestId_; }
+        long StatusCode() const { return statusCode_; }
+        int64_t BytesSent() const { return bytesSent_; }
+        int64_t BytesReceived() const { return bytesReceived_; }
+        /* the error of a failed attempt or outcome */
+        const std::string& ErrorCode() const { return errorCode_; }
+        long DelayMs() const { return delayMs_; }
+        bool Success() const { return success_; }
+
+        void setTimestamp(std::chrono::steady_clock::time_point value) { timestamp_ = value; }
+        void setOperation(const std::string& value) { operation_ = value; }
+        void setRequest(const HttpRequest* value) { request_ = value; }
+        void setServerRequestId(const std::string& value) { serverRequestId_ = value; }
+        void setStatusCode(long value) { statusCode_ = value; }
+        void setBytesSent(int64_t value) { bytesSent_ = value; }
+        void setBytesReceived(int64_t value) { bytesReceived_ = value; }
+        void setErrorCode(const std::string& value) { errorCode_ = value; }
+        void setDelayMs(long value) { delayMs_ = value; }
+        void setSuccess(bool value) { success_ = value; }
+    private:
+        RequestEventType type_;
+        std::chrono::steady_clock::time_point timestamp_;
+        uint64_t requestId_;
+        int attempt_;
+        std::string operation_;
+        const HttpRequest* request_;
+        std::string serverRequestId_;
+        long statusCode_;
+        int64_t bytesSent_;
+        int64_t bytesReceived_;
+        std::string errorCode_;
+        long delayMs_;
+        bool success_;
+    };
+
+    /**
+    * Receives the lifecycle events of the requests of a client. It is called on the thread
+    * which runs the request, so it must be thread safe and should return quickly.
+    */
+    class ALIBABACLOUD_OSS_EXPORT RequestObserver
+    {
+    public:
+        RequestObserver() = default;
+        virtual ~RequestObserver() = default;
+        virtual void onRequestEvent(const RequestEvent& event) = 0;
+    };
+}
+}
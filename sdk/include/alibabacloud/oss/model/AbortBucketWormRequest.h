@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT AbortBucketWormRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "AbortBucketWorm"; }
         AbortBucketWormRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT AbortMultipartUploadRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "AbortMultipartUpload"; }
         AbortMultipartUploadRequest(const std::string& bucket, const std::string& key, 
             const std::string& uploadId);
     protected:
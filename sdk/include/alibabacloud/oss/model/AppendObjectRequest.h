@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT AppendObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "AppendObject"; }
         AppendObjectRequest(const std::string& bucket, const std::string& key,
             const std::shared_ptr<std::iostream>& content);
         AppendObjectRequest(const std::string& bucket, const std::string& key,
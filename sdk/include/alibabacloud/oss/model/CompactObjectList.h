@@ -0,0 +1,135 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/Export.h>
+#include <alibabacloud/oss/model/ListObjectsResult.h>
+#include <unordered_map>
+#include <iterator>
+#include <cstdint>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * A compact container of listed objects, for keeping millions of summaries in memory.
+    * Keys are prefix compressed into one blob, storage class, type and owner are interned,
+    * ETag is kept as raw bytes and LastModified as a timestamp. Values which do not fit the
+    * compact form are kept as they are, so every summary reads back unchanged.
+    * Summaries can be added while listing, e.g. from an ObjectSummaryHandler.
+    */
+    class ALIBABACLOUD_OSS_EXPORT CompactObjectList
+    {
+    private:
+        struct Record
+        {
+            uint64_t keyOffset;
+            int64_t size;
+            int64_t lastModified;
+            uint32_t owner;
+            uint32_t extra;
+            uint16_t storageClass;
+            uint16_t type;
+            uint16_t eTagParts;
+            uint8_t eTag[16];
+        };
+        struct Extra
+        {
+            std::string eTag;
+            std::string lastModified;
+            std::string restoreInfo;
+            std::string storageClass;
+            std::string type;
+        };
+
+    public:
+        class Iterator;
+        class ALIBABACLOUD_OSS_EXPORT View
+        {
+        public:
+            const std::string& Key() const { return key_; }
+            std::string ETag() const;
+            int64_t Size() const { return record_->size; }
+            std::string LastModified() const;
+            /* milliseconds since epoch, -1 if the value is not a valid time */
+            int64_t LastModifiedTime() const { return record_->lastModified; }
+            const std::string& StorageClass() const;
+            const std::string& Type() const;
+            const AlibabaCloud::OSS::Owner& Owner() const { return list_->owners_[record_->owner]; }
+            std::string RestoreInfo() const;
+            ObjectSummary Summary() const;
+        private:
+            friend class CompactObjectList;
+            friend class Iterator;
+            View() : list_(nullptr), record_(nullptr), index_(0) {}
+            const CompactObjectList* list_;
+            const Record* record_;
+            size_t index_;
+            std::string key_;
+        };
+
+        class ALIBABACLOUD_OSS_EXPORT Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = View;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const View*;
+            using reference = const View&;
+            const View& operator*() const { return view_; }
+            const View* operator->() const { return &view_; }
+            Iterator& operator++();
+            bool operator==(const Iterator& rhs) const { return view_.index_ == rhs.view_.index_; }
+            bool operator!=(const Iterator& rhs) const { return view_.index_ != rhs.view_.index_; }
+        private:
+            friend class CompactObjectList;
+            Iterator(const CompactObjectList* list, size_t index);
+            View view_;
+        };
+
+        CompactObjectList();
+        void add(const ObjectSummary& summary);
+        void add(const ObjectSummaryList& summaries);
+        size_t size() const { return records_.size(); }
+        bool empty() const { return records_.empty(); }
+        void clear();
+        void shrinkToFit();
+        /* bytes held by the container */
+        size_t MemoryUsage() const;
+
+        View at(size_t index) const;
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, records_.size()); }
+
+    private:
+        static const size_t RestartInterval = 16;
+        const Extra* extra(const Record& record) const;
+        uint16_t internString(const std::string& value);
+        uint32_t internOwner(const AlibabaCloud::OSS::Owner& owner);
+        void decodeKey(size_t index, std::string& key) const;
+
+        std::string keys_;
+        std::string lastKey_;
+        std::vector<Record> records_;
+        std::vector<Extra> extras_;
+        std::vector<std::string> strings_;
+        std::unordered_map<std::string, uint16_t> stringIndex_;
+        std::vector<AlibabaCloud::OSS::Owner> owners_;
+        std::unordered_map<std::string, uint32_t> ownerIndex_;
+    };
+}
+}
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CompleteBucketWormRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "CompleteBucketWorm"; }
         CompleteBucketWormRequest(const std::string& bucket, const std::string& wormId);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -29,6 +29,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CompleteMultipartUploadRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "CompleteMultipartUpload"; }
         CompleteMultipartUploadRequest(const std::string& bucket, const std::string& key);
         CompleteMultipartUploadRequest(const std::string& bucket, const std::string& key,
             const PartList& partList);
@@ -40,6 +40,7 @@ namespace OSS
         uint64_t CRC64() const;
         const std::shared_ptr<std::iostream>& Content() const;
     private:
+        void parse(XmlDocument& doc);
         std::string location_;
         std::string bucket_;
         std::string key_;
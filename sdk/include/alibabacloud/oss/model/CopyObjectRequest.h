@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CopyObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "CopyObject"; }
         CopyObjectRequest(const std::string& bucket, const std::string& key);
         CopyObjectRequest(const std::string& bucket, const std::string& key,
             const ObjectMetaData& meta);
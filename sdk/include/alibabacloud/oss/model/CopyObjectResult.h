@@ -41,6 +41,7 @@ namespace OSS
         void setVersionId(const std::string& versionId) { versionId_ = versionId; }
         void setRequestId(const std::string& requestId) { requestId_ = requestId; }
      private:
+         void parse(XmlDocument& doc);
         std::string etag_;
         std::string lastModified_;
         std::string sourceVersionId_;
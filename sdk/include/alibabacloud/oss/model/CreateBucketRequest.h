@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CreateBucketRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "CreateBucket"; }
         CreateBucketRequest(const std::string& bucket, StorageClass storageClass = StorageClass::Standard);
         CreateBucketRequest(const std::string& bucket, StorageClass storageClass, 
             CannedAccessControlList acl);
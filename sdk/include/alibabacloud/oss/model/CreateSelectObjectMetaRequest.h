@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CreateSelectObjectMetaRequest : public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "CreateSelectObjectMeta"; }
         CreateSelectObjectMetaRequest(const std::string& bucket, const std::string& key);
 
         void setOverWriteIfExists(bool overWriteIfExist);
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT CreateSymlinkRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "CreateSymlink"; }
         CreateSymlinkRequest(const std::string& bucket, const std::string& key);
         CreateSymlinkRequest(const std::string& bucket, const std::string& key,
             const ObjectMetaData& meta);
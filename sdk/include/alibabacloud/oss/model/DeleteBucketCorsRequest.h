@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketCorsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketCors"; }
         DeleteBucketCorsRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketEncryptionRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketEncryption"; }
         DeleteBucketEncryptionRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
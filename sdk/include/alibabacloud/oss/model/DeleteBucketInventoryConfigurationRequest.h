@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketInventoryConfigurationRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketInventoryConfiguration"; }
         DeleteBucketInventoryConfigurationRequest(const std::string& bucket);
         DeleteBucketInventoryConfigurationRequest(const std::string& bucket, const std::string& id);
         void setId(const std::string& id) { id_ = id; }
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketLifecycleRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketLifecycle"; }
         DeleteBucketLifecycleRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
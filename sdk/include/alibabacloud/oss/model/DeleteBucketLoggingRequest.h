@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketLoggingRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketLogging"; }
         DeleteBucketLoggingRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketPolicyRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketPolicy"; }
         DeleteBucketPolicyRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketQosInfoRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketQosInfo"; }
         DeleteBucketQosInfoRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
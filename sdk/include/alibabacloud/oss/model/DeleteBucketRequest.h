@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucket"; }
         DeleteBucketRequest(const std::string& bucket):
             OssBucketRequest(bucket)
         {
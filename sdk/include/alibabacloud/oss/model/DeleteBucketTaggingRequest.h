@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketTaggingRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketTagging"; }
         DeleteBucketTaggingRequest(const std::string& bucket);
         void setTagging(const Tagging& tagging);
 
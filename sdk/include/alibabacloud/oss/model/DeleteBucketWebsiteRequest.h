@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteBucketWebsiteRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteBucketWebsite"; }
         DeleteBucketWebsiteRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
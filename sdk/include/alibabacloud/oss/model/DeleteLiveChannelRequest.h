@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteLiveChannelRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteLiveChannel"; }
         DeleteLiveChannelRequest(const std::string& bucket, const std::string& channelName);
     protected:
         virtual ParameterCollection specialParameters() const;
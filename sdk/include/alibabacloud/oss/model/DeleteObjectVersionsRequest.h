@@ -43,6 +43,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteObjectVersionsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteObjectVersions"; }
         DeleteObjectVersionsRequest(const std::string& bucket);
         bool Quiet() const;
         const std::string& EncodingType() const;
@@ -54,6 +54,7 @@ namespace OSS
         bool Quiet() const;
         const DeletedObjectList& DeletedObjects() const;
     private:
+        void parse(XmlDocument& doc);
         bool quiet_;
         DeletedObjectList deletedObjects_;
     };
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DeleteObjectsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "DeleteObjects"; }
         DeleteObjectsRequest(const std::string& bucket);
         bool Quiet() const;
         const std::string& EncodingType() const;
@@ -34,6 +34,7 @@ namespace OSS
         bool Quiet() const;
         const std::list<std::string>& keyList() const;
     private:
+        void parse(XmlDocument& doc);
         bool quiet_;
         std::list<std::string> keyList_;
     };
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT DownloadObjectRequest : public OssResumableBaseRequest 
     {
     public:
+        const char* OperationName() const override { return "DownloadObject"; }
         DownloadObjectRequest(const std::string& bucket, const std::string& key, 
             const std::string& filePath);
         DownloadObjectRequest(const std::string& bucket, const std::string& key, 
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ExtendBucketWormRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ExtendBucketWorm"; }
         ExtendBucketWormRequest(const std::string& bucket, const std::string& wormId, uint32_t day);
     protected:
         virtual std::string payload() const;
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GenerateRTMPSignedUrlRequest: public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "GenerateRTMPSignedUrl"; }
         GenerateRTMPSignedUrlRequest(const std::string& bucket, 
             const std::string& channelName, const std::string& playlist, 
             uint64_t expires);
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketAclRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketAcl"; }
         GetBucketAclRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -35,6 +35,7 @@ namespace OSS
         const AlibabaCloud::OSS::Owner& Owner() { return owner_; }
         CannedAccessControlList Acl()const  { return acl_; }
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::Owner owner_;
         CannedAccessControlList acl_;
     };
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketCorsRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketCors"; }
         GetBucketCorsRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
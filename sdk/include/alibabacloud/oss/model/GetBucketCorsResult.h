@@ -32,6 +32,7 @@ namespace OSS
         GetBucketCorsResult& operator=(const std::string& data);
         const CORSRuleList& CORSRules() const { return ruleList_; };
     private:
+        void parse(XmlDocument& doc);
         CORSRuleList ruleList_;
     };
 } 
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketEncryptionRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketEncryption"; }
         GetBucketEncryptionRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
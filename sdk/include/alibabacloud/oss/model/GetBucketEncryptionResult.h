@@ -34,6 +34,7 @@ namespace OSS
         AlibabaCloud::OSS::SSEAlgorithm SSEAlgorithm() const { return SSEAlgorithm_; }
         const std::string& KMSMasterKeyID() const { return KMSMasterKeyID_; }
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::SSEAlgorithm SSEAlgorithm_;
         std::string KMSMasterKeyID_;
     };
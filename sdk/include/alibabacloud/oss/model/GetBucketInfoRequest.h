@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketInfoRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketInfo"; }
         GetBucketInfoRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -45,6 +45,7 @@ namespace OSS
         const std::string& KMSMasterKeyID() { return kmsMasterKeyID_; }
         AlibabaCloud::OSS::VersioningStatus VersioningStatus() { return versioningStatus_; }
     private:
+        void parse(XmlDocument& doc);
         std::string location_;
         std::string name_;
         std::string creationDate_;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketInventoryConfigurationRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketInventoryConfiguration"; }
         GetBucketInventoryConfigurationRequest(const std::string& bucket);
         GetBucketInventoryConfigurationRequest(const std::string& bucket, const std::string& id);
         void setId(const std::string& id) { id_ = id; }
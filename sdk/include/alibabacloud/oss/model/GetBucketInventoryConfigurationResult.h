@@ -33,6 +33,7 @@ namespace OSS
         GetBucketInventoryConfigurationResult& operator=(const std::string& data);
         AlibabaCloud::OSS::InventoryConfiguration InventoryConfiguration()const { return inventoryConfiguration_; }
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::InventoryConfiguration inventoryConfiguration_;
     };
 }
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketLifecycleRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketLifecycle"; }
         GetBucketLifecycleRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
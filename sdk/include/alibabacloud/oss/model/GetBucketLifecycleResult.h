@@ -33,6 +33,7 @@ namespace OSS
         GetBucketLifecycleResult& operator=(const std::string& data);
         const LifecycleRuleList& LifecycleRules() { return lifecycleRuleList_; }
     private:
+        void parse(XmlDocument& doc);
         LifecycleRuleList lifecycleRuleList_;
     };
 } 
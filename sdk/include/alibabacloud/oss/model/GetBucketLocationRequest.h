@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketLocationRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketLocation"; }
         GetBucketLocationRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -32,6 +32,7 @@ namespace OSS
         GetBucketLocationResult& operator=(const std::string& data);
         const std::string& Location() const { return location_; }
     private:
+        void parse(XmlDocument& doc);
         std::string location_;
     public:
     };
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketLoggingRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketLogging"; }
         GetBucketLoggingRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
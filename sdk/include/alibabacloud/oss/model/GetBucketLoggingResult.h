@@ -32,6 +32,7 @@ namespace OSS
         const std::string& TargetBucket() const { return targetBucket_; }
         const std::string& TargetPrefix() const { return targetPrefix_; }
     private:
+        void parse(XmlDocument& doc);
         std::string targetBucket_;
         std::string targetPrefix_;
     };
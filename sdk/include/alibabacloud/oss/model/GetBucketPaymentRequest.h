@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketRequestPaymentRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketRequestPayment"; }
         GetBucketRequestPaymentRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
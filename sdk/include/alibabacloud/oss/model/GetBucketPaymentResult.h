@@ -33,6 +33,7 @@ namespace OSS
         GetBucketPaymentResult& operator=(const std::string& data);
         RequestPayer Payer()const { return payer_; }
     private:
+        void parse(XmlDocument& doc);
         RequestPayer payer_;
     };
 } 
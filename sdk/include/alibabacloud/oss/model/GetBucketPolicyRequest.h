@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketPolicyRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketPolicy"; }
         GetBucketPolicyRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
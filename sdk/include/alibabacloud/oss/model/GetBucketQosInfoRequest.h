@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketQosInfoRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketQosInfo"; }
         GetBucketQosInfoRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
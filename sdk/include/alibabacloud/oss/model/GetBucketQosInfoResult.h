@@ -32,6 +32,7 @@ namespace OSS
         GetBucketQosInfoResult& operator=(const std::string& data);
         const QosConfiguration& QosInfo() const { return qosInfo_; }
     private:
+        void parse(XmlDocument& doc);
         QosConfiguration qosInfo_;
     };
 }
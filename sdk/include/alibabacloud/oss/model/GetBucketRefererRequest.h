@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketRefererRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketReferer"; }
         GetBucketRefererRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -34,6 +34,7 @@ namespace OSS
         const AlibabaCloud::OSS::RefererList& RefererList() const { return refererList_;}
         bool AllowEmptyReferer() const { return allowEmptyReferer_; }
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::RefererList refererList_;
         bool allowEmptyReferer_;
     };
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketStatRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketStat"; }
         GetBucketStatRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -45,6 +45,7 @@ namespace OSS
         uint64_t ColdArchiveObjectCount() const { return coldArchiveObjectCount_; }
 
     private:
+        void parse(XmlDocument& doc);
         uint64_t storage_;
         uint64_t objectCount_;
         uint64_t multipartUploadCount_;
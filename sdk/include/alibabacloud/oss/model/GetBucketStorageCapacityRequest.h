@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketStorageCapacityRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketStorageCapacity"; }
         GetBucketStorageCapacityRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -33,6 +33,7 @@ namespace OSS
         GetBucketStorageCapacityResult& operator=(const std::string& data);
         int64_t StorageCapacity() const  { return storageCapacity_; }
     private:
+        void parse(XmlDocument& doc);
         int64_t storageCapacity_;
     };
 } 
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketTaggingRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketTagging"; }
         GetBucketTaggingRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -32,6 +32,7 @@ namespace OSS
         GetBucketTaggingResult& operator=(const std::string& data);
         const AlibabaCloud::OSS::Tagging& Tagging() const { return tagging_; };
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::Tagging tagging_;
     };
 }
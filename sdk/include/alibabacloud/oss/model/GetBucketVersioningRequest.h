@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketVersioningRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketVersioning"; }
         GetBucketVersioningRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -33,6 +33,7 @@ namespace OSS
         GetBucketVersioningResult& operator=(const std::string& data);
         VersioningStatus Status() const { return status_; }
     private:
+        void parse(XmlDocument& doc);
         VersioningStatus status_;
     };
 } 
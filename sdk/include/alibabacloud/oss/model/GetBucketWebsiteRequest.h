@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketWebsiteRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketWebsite"; }
         GetBucketWebsiteRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
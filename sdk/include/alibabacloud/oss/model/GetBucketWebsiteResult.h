@@ -33,6 +33,7 @@ namespace OSS
         const std::string& IndexDocument() const { return indexDocument_; }
         const std::string& ErrorDocument() const { return errorDocument_; }
     private:
+        void parse(XmlDocument& doc);
         std::string indexDocument_;
         std::string errorDocument_;
     };
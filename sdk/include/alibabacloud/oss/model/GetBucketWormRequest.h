@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetBucketWormRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "GetBucketWorm"; }
         GetBucketWormRequest(const std::string& bucket);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -35,6 +35,7 @@ namespace OSS
         const std::string& State() const { return state_; }
         uint32_t Day() const { return day_; }
     private:
+        void parse(XmlDocument& doc);
         std::string wormId_;
         std::string creationDate_;
         std::string state_;
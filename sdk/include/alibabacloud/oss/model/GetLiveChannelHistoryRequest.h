@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetLiveChannelHistoryRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "GetLiveChannelHistory"; }
         GetLiveChannelHistoryRequest(const std::string& bucket, const std::string& channelName);
 
     protected:
@@ -47,6 +47,7 @@ namespace OSS
 
         const LiveRecordVec& LiveRecordList() const;
     private:
+        void parse(XmlDocument& doc);
         LiveRecordVec recordList_;
     };
 } 
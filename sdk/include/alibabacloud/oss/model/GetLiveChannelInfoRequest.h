@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetLiveChannelInfoRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "GetLiveChannelInfo"; }
         GetLiveChannelInfoRequest(const std::string& bucket, const std::string& channelName);
 
     protected:
@@ -41,6 +41,7 @@ namespace OSS
         uint64_t FragCount() const;
         const std::string& PlaylistName() const;
     private:
+        void parse(XmlDocument& doc);
         std::string channelType_;
         LiveChannelStatus status_;
         std::string description_;
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetLiveChannelStatRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "GetLiveChannelStat"; }
         GetLiveChannelStatRequest(const std::string& bucket, const std::string& channelName);
 
     protected:
@@ -45,6 +45,7 @@ namespace OSS
         uint64_t AudioBandWidth() const;
         const std::string& AudioCodec() const;
     private:
+        void parse(XmlDocument& doc);
         std::string connectedTime_;
         LiveChannelStatus status_;
         std::string remoteAddr_;
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetObjectAclRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "GetObjectAcl"; }
         GetObjectAclRequest(const std::string& bucket, const std::string& key);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetObjectByUrlRequest: public ServiceRequest
     {
     public:
+        const char* OperationName() const override { return "GetObjectByUrl"; }
         GetObjectByUrlRequest(const std::string& url);
         GetObjectByUrlRequest(const std::string& url, const ObjectMetaData& metaData);
         virtual HeaderCollection Headers() const;
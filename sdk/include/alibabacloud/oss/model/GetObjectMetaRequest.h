@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetObjectMetaRequest : public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "GetObjectMeta"; }
         GetObjectMetaRequest(const std::string& bucket, const std::string& key):
             OssObjectRequest(bucket, key)
         {
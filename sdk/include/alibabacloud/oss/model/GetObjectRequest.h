@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "GetObject"; }
         GetObjectRequest(const std::string& bucket, const std::string& key);
         GetObjectRequest(const std::string& bucket, const std::string& key, 
             const std::string& process);
@@ -49,6 +50,7 @@ namespace OSS
         void setUserAgent(const std::string& ua);
 
         std::pair<int64_t, int64_t> Range() const;
+        bool RangeIsStandardMode() const { return rangeIsStandardMode_; }
     protected:
         virtual HeaderCollection specialHeaders() const ;
         virtual ParameterCollection specialParameters() const;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetObjectTaggingRequest : public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "GetObjectTagging"; }
         GetObjectTaggingRequest(const std::string& bucket, const std::string& key);
     protected:
         virtual ParameterCollection specialParameters() const;
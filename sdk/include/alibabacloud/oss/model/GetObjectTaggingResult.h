@@ -33,6 +33,7 @@ namespace OSS
         GetObjectTaggingResult& operator=(const std::string& data);
         const AlibabaCloud::OSS::Tagging& Tagging() const { return tagging_; };
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::Tagging tagging_;
     };
 } 
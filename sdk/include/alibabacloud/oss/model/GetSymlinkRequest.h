@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetSymlinkRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "GetSymlink"; }
         GetSymlinkRequest(const std::string& bucket, const std::string& key);
     protected:
         virtual ParameterCollection specialParameters() const;
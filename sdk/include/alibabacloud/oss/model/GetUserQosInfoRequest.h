@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetUserQosInfoRequest : public OssRequest
     {
     public:
+        const char* OperationName() const override { return "GetUserQosInfo"; }
         GetUserQosInfoRequest();
     protected:
         virtual ParameterCollection specialParameters() const;
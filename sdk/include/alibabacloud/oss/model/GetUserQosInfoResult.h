@@ -33,6 +33,7 @@ namespace OSS
         const QosConfiguration& QosInfo() const { return qosInfo_; }
         const std::string& Region() const { return region_; }
     private:
+        void parse(XmlDocument& doc);
         std::string region_;
         QosConfiguration qosInfo_;
     };
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT GetVodPlaylistRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "GetVodPlaylist"; }
         GetVodPlaylistRequest(const std::string& bucket, 
             const std::string& channelName);
 
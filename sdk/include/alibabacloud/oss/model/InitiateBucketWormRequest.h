@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT InitiateBucketWormRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "InitiateBucketWorm"; }
         InitiateBucketWormRequest(const std::string& bucket, uint32_t day);
     protected:
         virtual std::string payload() const;
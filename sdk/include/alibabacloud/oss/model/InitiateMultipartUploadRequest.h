@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT InitiateMultipartUploadRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "InitiateMultipartUpload"; }
         InitiateMultipartUploadRequest(const std::string& bucket, const std::string& key);
         InitiateMultipartUploadRequest(const std::string& bucket, const std::string& key,
             const ObjectMetaData& metaData);
@@ -37,6 +37,7 @@ namespace OSS
         const std::string& UploadId() const { return uploadId_; }
         const std::string& EncodingType() const { return encodingType_; }
     private:
+        void parse(XmlDocument& doc);
         std::string bucket_;
         std::string key_;
         std::string uploadId_;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListBucketInventoryConfigurationsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListBucketInventoryConfigurations"; }
         ListBucketInventoryConfigurationsRequest(const std::string& bucket);
         void setContinuationToken(const std::string& token) { continuationToken_ = token; }
     protected:
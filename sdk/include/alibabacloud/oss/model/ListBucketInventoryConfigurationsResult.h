@@ -36,6 +36,7 @@ namespace OSS
         const std::string& NextContinuationToken() const { return nextContinuationToken_; }
 
     private:
+        void parse(XmlDocument& doc);
         AlibabaCloud::OSS::InventoryConfigurationList inventoryConfigurationList_;
         bool isTruncated_;
         std::string nextContinuationToken_;
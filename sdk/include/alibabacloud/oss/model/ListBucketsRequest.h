@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListBucketsRequest: public OssRequest
     {
     public:
+        const char* OperationName() const override { return "ListBuckets"; }
         ListBucketsRequest();
         ListBucketsRequest(const std::string& prefix, const std::string& marker, int maxKeys = 100);
 
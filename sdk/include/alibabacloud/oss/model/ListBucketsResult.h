@@ -39,6 +39,7 @@ namespace OSS
         bool IsTruncated() const { return isTruncated_; }
         const std::vector<Bucket>& Buckets() const { return buckets_; }
     private:
+        void parse(XmlDocument& doc);
         std::string prefix_;
         std::string marker_;
         std::string nextMarker_;
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListLiveChannelRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListLiveChannel"; }
         ListLiveChannelRequest(const std::string &bucket);
 
         void setMarker(const std::string& marker);   
@@ -51,6 +51,7 @@ namespace OSS
         const LiveChannelListInfo& LiveChannelList() const;
         uint32_t MaxKeys() const;
     private:
+        void parse(XmlDocument& doc);
         std::string prefix_;
         std::string marker_;
         std::string nextMarker_;
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListMultipartUploadsRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListMultipartUploads"; }
         ListMultipartUploadsRequest(const std::string& bucket);
         void setDelimiter(const std::string& delimiter);
         void setMaxUploads(uint32_t maxUploads);
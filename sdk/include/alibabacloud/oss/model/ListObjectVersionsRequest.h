@@ -17,6 +17,7 @@
 #pragma once
 #include <alibabacloud/oss/Export.h>
 #include <alibabacloud/oss/OssRequest.h>
+#include <alibabacloud/oss/model/ListObjectVersionsResult.h>
 
 namespace AlibabaCloud
 {
@@ -26,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListObjectVersionsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListObjectVersions"; }
         ListObjectVersionsRequest(const std::string& bucket):
             OssBucketRequest(bucket),
             delimiterIsSet_(false),
@@ -35,13 +37,20 @@ namespace OSS
             encodingTypeIsSet_(false),
             versionIdMarkerIsSet_(false)
         {
+            setFlags(Flags() | REQUEST_FLAG_ACCEPT_GZIP);
         }
         void setDelimiter(const std::string& delimiter) { delimiter_ = delimiter; delimiterIsSet_ = true; }
         void setKeyMarker(const std::string& marker) { keyMarker_ = marker; keyMarkerIsSet_ = true;}
         void setMaxKeys(int maxKeys) {maxKeys_ = maxKeys; maxKeysIsSet_ = true;} 
         void setPrefix(const std::string& prefix) { prefix_ = prefix; prefixIsSet_ = true; }
         void setEncodingType(const std::string& type) { encodingType_ = type; encodingTypeIsSet_ = true; }
+        const std::string& EncodingType() const { return encodingType_; }
         void setVersionIdMarker(const std::string& marker) { versionIdMarker_ = marker; versionIdMarkerIsSet_ = true; }
+        /* summaries are passed to the handlers while the response is parsed instead of being kept in the result */
+        void setObjectVersionSummaryHandler(const AlibabaCloud::OSS::ObjectVersionSummaryHandler& handler) { objectVersionSummaryHandler_ = handler; }
+        void setDeleteMarkerSummaryHandler(const AlibabaCloud::OSS::DeleteMarkerSummaryHandler& handler) { deleteMarkerSummaryHandler_ = handler; }
+        const AlibabaCloud::OSS::ObjectVersionSummaryHandler& ObjectVersionSummaryHandler() const { return objectVersionSummaryHandler_; }
+        const AlibabaCloud::OSS::DeleteMarkerSummaryHandler& DeleteMarkerSummaryHandler() const { return deleteMarkerSummaryHandler_; }
 
     protected:
         virtual ParameterCollection specialParameters() const 
@@ -69,6 +78,8 @@ namespace OSS
         bool encodingTypeIsSet_;
         std::string versionIdMarker_;
         bool versionIdMarkerIsSet_;
+        AlibabaCloud::OSS::ObjectVersionSummaryHandler objectVersionSummaryHandler_;
+        AlibabaCloud::OSS::DeleteMarkerSummaryHandler deleteMarkerSummaryHandler_;
     };
 } 
 }
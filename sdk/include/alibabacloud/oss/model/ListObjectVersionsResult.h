@@ -19,6 +19,7 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <functional>
 #include <alibabacloud/oss/OssResult.h>
 #include <alibabacloud/oss/model/Owner.h>
 
@@ -27,6 +28,7 @@ namespace AlibabaCloud
 namespace OSS
 {
     class ListObjectVersionsResult;
+    class ListObjectVersionsXmlParser;
     class ALIBABACLOUD_OSS_EXPORT ObjectVersionSummary
     {
     public:
@@ -42,6 +44,7 @@ namespace OSS
         const AlibabaCloud::OSS::Owner& Owner() const { return owner_; }
     private:
         friend class ListObjectVersionsResult;
+        friend class ListObjectVersionsXmlParser;
         std::string key_;
         std::string versionid_;
         std::string eTag_;
@@ -53,6 +56,7 @@ namespace OSS
         AlibabaCloud::OSS::Owner owner_;
     };
     using ObjectVersionSummaryList = std::vector<ObjectVersionSummary>;
+    using ObjectVersionSummaryHandler = std::function<void(const ObjectVersionSummary&)>;
 
     class ALIBABACLOUD_OSS_EXPORT DeleteMarkerSummary
     {
@@ -65,6 +69,7 @@ namespace OSS
         const AlibabaCloud::OSS::Owner& Owner() const { return owner_; }
     private:
         friend class ListObjectVersionsResult;
+        friend class ListObjectVersionsXmlParser;
         std::string key_;
         std::string versionid_;
         std::string lastModified_;
@@ -72,6 +77,7 @@ namespace OSS
         AlibabaCloud::OSS::Owner owner_;
     };
     using DeleteMarkerSummaryList = std::vector<DeleteMarkerSummary>;
+    using DeleteMarkerSummaryHandler = std::function<void(const DeleteMarkerSummary&)>;
 
     class ALIBABACLOUD_OSS_EXPORT ListObjectVersionsResult : public OssResult
     {
@@ -94,6 +100,7 @@ namespace OSS
         const ObjectVersionSummaryList& ObjectVersionSummarys() const { return objectVersionSummarys_; }
         const DeleteMarkerSummaryList& DeleteMarkerSummarys() const { return deleteMarkerSummarys_; }
     private:
+        friend class ListObjectVersionsXmlParser;
         std::string name_;
         std::string prefix_;
         std::string keyMarker_;
@@ -17,6 +17,7 @@
 #pragma once
 #include <alibabacloud/oss/Export.h>
 #include <alibabacloud/oss/OssRequest.h>
+#include <alibabacloud/oss/model/ListObjectsResult.h>
 
 namespace AlibabaCloud
 {
@@ -26,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListObjectsRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListObjects"; }
         ListObjectsRequest(const std::string& bucket):
             OssBucketRequest(bucket),
             delimiterIsSet_(false),
@@ -35,13 +37,18 @@ namespace OSS
             encodingTypeIsSet_(false),
             requestPayer_(RequestPayer::NotSet)
         {
+            setFlags(Flags() | REQUEST_FLAG_ACCEPT_GZIP);
         }
         void setDelimiter(const std::string& delimiter) { delimiter_ = delimiter; delimiterIsSet_ = true; }
         void setMarker(const std::string& marker) {marker_ = marker; markerIsSet_ = true;}    
         void setMaxKeys(int maxKeys) {maxKeys_ = maxKeys; maxKeysIsSet_ = true;} 
         void setPrefix(const std::string& prefix) { prefix_ = prefix; prefixIsSet_ = true; }
         void setEncodingType(const std::string& type) { encodingType_ = type; encodingTypeIsSet_ = true; }
+        const std::string& EncodingType() const { return encodingType_; }
         void setRequestPayer(RequestPayer value) { requestPayer_ = value; }
+        /* summaries are passed to the handler while the response is parsed instead of being kept in the result */
+        void setObjectSummaryHandler(const AlibabaCloud::OSS::ObjectSummaryHandler& handler) { objectSummaryHandler_ = handler; }
+        const AlibabaCloud::OSS::ObjectSummaryHandler& ObjectSummaryHandler() const { return objectSummaryHandler_; }
 
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -58,6 +65,7 @@ namespace OSS
         std::string encodingType_;
         bool encodingTypeIsSet_;
         RequestPayer requestPayer_;
+        AlibabaCloud::OSS::ObjectSummaryHandler objectSummaryHandler_;
     };
 } 
 }
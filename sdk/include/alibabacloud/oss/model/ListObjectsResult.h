@@ -19,6 +19,7 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <functional>
 #include <alibabacloud/oss/OssResult.h>
 #include <alibabacloud/oss/model/Owner.h>
 
@@ -28,6 +29,9 @@ namespace OSS
 {
     class ListObjectsResult;
     class ListObjectsV2Result;
+    class ListObjectsXmlParser;
+    class ListObjectsV2XmlParser;
+    class CompactObjectList;
     class ALIBABACLOUD_OSS_EXPORT ObjectSummary
     {
     public:
@@ -43,6 +47,9 @@ namespace OSS
     private:
         friend class ListObjectsResult;
         friend class ListObjectsV2Result;
+        friend class ListObjectsXmlParser;
+        friend class ListObjectsV2XmlParser;
+        friend class CompactObjectList;
         std::string key_;
         std::string eTag_;
         int64_t size_;
@@ -54,6 +61,7 @@ namespace OSS
     };
 
     using ObjectSummaryList = std::vector<ObjectSummary>;
+    using ObjectSummaryHandler = std::function<void(const ObjectSummary&)>;
 
     class ALIBABACLOUD_OSS_EXPORT ListObjectsResult : public OssResult
     {
@@ -73,6 +81,7 @@ namespace OSS
         const CommonPrefixeList& CommonPrefixes() const { return commonPrefixes_; }
         const ObjectSummaryList& ObjectSummarys() const { return objectSummarys_; }
     private:
+        friend class ListObjectsXmlParser;
         std::string name_;
         std::string prefix_;
         std::string marker_;
@@ -17,6 +17,7 @@
 #pragma once
 #include <alibabacloud/oss/Export.h>
 #include <alibabacloud/oss/OssRequest.h>
+#include <alibabacloud/oss/model/ListObjectsResult.h>
 
 namespace AlibabaCloud
 {
@@ -25,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListObjectsV2Request: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "ListObjectsV2"; }
         ListObjectsV2Request(const std::string& bucket):
             OssBucketRequest(bucket),
             delimiterIsSet_(false),
@@ -36,6 +38,7 @@ namespace OSS
             fetchOwnerIsSet_(false),
             requestPayer_(RequestPayer::NotSet)
         {
+            setFlags(Flags() | REQUEST_FLAG_ACCEPT_GZIP);
         }
         void setDelimiter(const std::string& delimiter) { delimiter_ = delimiter; delimiterIsSet_ = true; }
         void setStartAfter(const std::string& value) { startAfter_ = value; startAfterIsSet_ = true;}
@@ -43,8 +46,12 @@ namespace OSS
         void setMaxKeys(int maxKeys) {maxKeys_ = maxKeys; maxKeysIsSet_ = true;}
         void setPrefix(const std::string& prefix) { prefix_ = prefix; prefixIsSet_ = true; }
         void setEncodingType(const std::string& type) { encodingType_ = type; encodingTypeIsSet_ = true; }
+        const std::string& EncodingType() const { return encodingType_; }
         void setFetchOwner(bool value) { fetchOwner_ = value; fetchOwnerIsSet_ = true; }
         void setRequestPayer(RequestPayer value) { requestPayer_ = value; }
+        /* summaries are passed to the handler while the response is parsed instead of being kept in the result */
+        void setObjectSummaryHandler(const AlibabaCloud::OSS::ObjectSummaryHandler& handler) { objectSummaryHandler_ = handler; }
+        const AlibabaCloud::OSS::ObjectSummaryHandler& ObjectSummaryHandler() const { return objectSummaryHandler_; }
 
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -65,6 +72,7 @@ namespace OSS
         bool fetchOwner_;
         bool fetchOwnerIsSet_;
         RequestPayer requestPayer_;
+        AlibabaCloud::OSS::ObjectSummaryHandler objectSummaryHandler_;
     };
 } 
 }
@@ -47,6 +47,7 @@ namespace OSS
         const CommonPrefixeList& CommonPrefixes() const { return commonPrefixes_; }
         const ObjectSummaryList& ObjectSummarys() const { return objectSummarys_; }
     private:
+        friend class ListObjectsV2XmlParser;
         std::string name_;
         std::string prefix_;
         std::string startAfter_;
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ListPartsRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "ListParts"; }
         ListPartsRequest(const std::string& bucket, const std::string& key);
         ListPartsRequest(const std::string& bucket, const std::string& key,
             const std::string& uploadId);
@@ -45,6 +45,7 @@ namespace OSS
         const AlibabaCloud::OSS::PartList& PartList()const;
         bool IsTruncated() const;
     private:
+        void parse(XmlDocument& doc);
         std::string uploadId_;
         uint32_t maxParts_;
         uint32_t partNumberMarker_;
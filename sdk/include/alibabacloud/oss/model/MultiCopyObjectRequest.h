@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT MultiCopyObjectRequest : public OssResumableBaseRequest
     {
     public:
+        const char* OperationName() const override { return "MultiCopyObject"; }
         MultiCopyObjectRequest(const std::string& bucket, const std::string& key, 
             const std::string& srcBucket, const std::string& srcKey);
         MultiCopyObjectRequest(const std::string& bucket, const std::string& key, 
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT PostVodPlaylistRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "PostVodPlaylist"; }
         PostVodPlaylistRequest(const std::string& bucket, const std::string& channelName, 
             const std::string& playList, uint64_t startTime, uint64_t endTime);
 
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT ProcessObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "ProcessObject"; }
         ProcessObjectRequest(const std::string& bucket, const std::string& key);
         ProcessObjectRequest(const std::string& bucket, const std::string& key,
             const std::string& process);
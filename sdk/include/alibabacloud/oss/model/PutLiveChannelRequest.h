@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT PutLiveChannelRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "PutLiveChannel"; }
         PutLiveChannelRequest(const std::string& bucket, const std::string& channelName, 
             const std::string& type);
 
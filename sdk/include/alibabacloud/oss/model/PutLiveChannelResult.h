@@ -36,6 +36,7 @@ namespace OSS
         const std::string& PublishUrl() const;
         const std::string& PlayUrl() const;
     private:
+        void parse(XmlDocument& doc);
         std::string publishUrl_;
         std::string playUrl_;
     };
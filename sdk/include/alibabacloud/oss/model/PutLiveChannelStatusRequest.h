@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT PutLiveChannelStatusRequest : public LiveChannelRequest
     {
     public:
+        const char* OperationName() const override { return "PutLiveChannelStatus"; }
         PutLiveChannelStatusRequest(const std::string& bucket, const std::string& channelName);
         PutLiveChannelStatusRequest(const std::string& bucket, const std::string& channelName, 
             LiveChannelStatus status);
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT PutObjectByUrlRequest : public ServiceRequest
     {
     public:
+        const char* OperationName() const override { return "PutObjectByUrl"; }
         PutObjectByUrlRequest(const std::string& url, 
             const std::shared_ptr<std::iostream>& content);
         PutObjectByUrlRequest(const std::string& url, 
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT PutObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "PutObject"; }
         PutObjectRequest(const std::string& bucket, const std::string& key,
             const std::shared_ptr<std::iostream>& content);
         PutObjectRequest(const std::string& bucket, const std::string& key,
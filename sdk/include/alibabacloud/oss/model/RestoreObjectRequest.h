@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT RestoreObjectRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "RestoreObject"; }
         RestoreObjectRequest(const std::string& bucket, const std::string& key);
         void setDays(uint32_t days);
         void setTierType(TierType type);
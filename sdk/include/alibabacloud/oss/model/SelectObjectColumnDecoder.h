@@ -0,0 +1,117 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/Export.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    enum class SelectColumnType
+    {
+        Int64,
+        Double,
+        String,
+        /* "yyyy-mm-dd[ hh:mm:ss[.ffffff]]", decoded as microseconds since the epoch (UTC) */
+        Timestamp
+    };
+
+    /* the values of one column of a batch, one entry per row */
+    class ALIBABACLOUD_OSS_EXPORT SelectColumn
+    {
+    public:
+        explicit SelectColumn(SelectColumnType type) : type_(type), stringOffsets_(1, 0) {}
+        SelectColumnType Type() const { return type_; }
+        /* the values of int64 and timestamp columns */
+        const std::vector<int64_t>& Int64Values() const { return int64Values_; }
+        const std::vector<double>& DoubleValues() const { return doubleValues_; }
+        /* the value of row i is StringData()[StringOffsets()[i], StringOffsets()[i + 1]) */
+        const std::string& StringData() const { return stringData_; }
+        const std::vector<uint32_t>& StringOffsets() const { return stringOffsets_; }
+        /* 1 when the field is missing, or is empty or invalid in a non string column */
+        const std::vector<uint8_t>& Nulls() const { return nulls_; }
+    private:
+        friend class SelectObjectColumnDecoder;
+        void clear();
+        SelectColumnType type_;
+        std::vector<int64_t> int64Values_;
+        std::vector<double> doubleValues_;
+        std::string stringData_;
+        std::vector<uint32_t> stringOffsets_;
+        std::vector<uint8_t> nulls_;
+    };
+
+    class ALIBABACLOUD_OSS_EXPORT SelectColumnBatch
+    {
+    public:
+        SelectColumnBatch() : rowCount_(0) {}
+        size_t RowCount() const { return rowCount_; }
+        size_t ColumnCount() const { return columns_.size(); }
+        const SelectColumn& Column(size_t index) const { return columns_[index]; }
+    private:
+        friend class SelectObjectColumnDecoder;
+        std::vector<SelectColumn> columns_;
+        size_t rowCount_;
+    };
+
+    /* the batch and its buffers are reused after the call */
+    using SelectColumnBatchHandler = std::function<void(const SelectColumnBatch& batch)>;
+
+    /**
+    * Decodes csv records into columnar batches of a fixed schema, without building
+    * a string per field. Columns beyond the schema are ignored. Attach it to a
+    * SelectObjectRequest with csv output to decode the select output as it arrives,
+    * the delimiters are then taken from the output format.
+    */
+    class ALIBABACLOUD_OSS_EXPORT SelectObjectColumnDecoder
+    {
+    public:
+        SelectObjectColumnDecoder(const std::vector<SelectColumnType>& schema,
+            const SelectColumnBatchHandler& handler, size_t batchRows = 4096);
+
+        /* drops the undelivered rows and sets the delimiters, the header record is skipped if set */
+        void reset(char fieldDelimiter = ',', const std::string& recordDelimiter = "\n", bool skipHeader = false);
+        /* data holds complete records, the delimiter of the last record is optional */
+        void decode(const char* data, size_t size);
+        /* delivers the rows of the last partial batch */
+        void flush();
+
+        uint64_t RowCount() const { return rowCount_; }
+        /* non empty fields which could not be parsed as the column type */
+        uint64_t InvalidValues() const { return invalidValues_; }
+
+    private:
+        const char* decodeRecord(const char* data, const char* end);
+        void appendField(size_t column, const char* data, size_t size, bool quoted);
+        void appendNull(size_t column);
+
+        SelectColumnBatchHandler handler_;
+        size_t batchRows_;
+        SelectColumnBatch batch_;
+        char fieldDelimiter_;
+        std::string recordDelimiter_;
+        bool skipHeader_;
+        std::string unquoted_;
+        uint64_t rowCount_;
+        uint64_t invalidValues_;
+    };
+}
+}
@@ -21,6 +21,8 @@
 #include <alibabacloud/oss/model/InputFormat.h>
 #include <alibabacloud/oss/model/OutputFormat.h>
 #include <alibabacloud/oss/model/CreateSelectObjectMetaRequest.h>
+#include <alibabacloud/oss/model/SelectObjectColumnDecoder.h>
+#include <functional>
 
 namespace AlibabaCloud
 {
@@ -30,10 +32,36 @@ namespace OSS
 	{
 		SQL,
 	};
-    class OssClientImpl;
+
+    /**
+    * A batch of complete output records, stored back to back. Every record ends with
+    * the record delimiter, except the last record of the output if it has none.
+    * The data is only valid during the call.
+    */
+    using SelectRecordHandler = std::function<void(const char* data, size_t size, size_t records)>;
+
+    /* the statistics carried by the end frame of a select response */
+    class ALIBABACLOUD_OSS_EXPORT SelectObjectEndFrame
+    {
+    public:
+        SelectObjectEndFrame() : received_(false), scannedBytes_(0), status_(0) {}
+        bool Received() const { return received_; }
+        uint64_t ScannedBytes() const { return scannedBytes_; }
+        int Status() const { return status_; }
+        const std::string& ErrorMessage() const { return errorMessage_; }
+    private:
+        friend class SelectObjectRequest;
+        bool received_;
+        uint64_t scannedBytes_;
+        int status_;
+        std::string errorMessage_;
+    };
+
+    class OssClientImpl;
 	class ALIBABACLOUD_OSS_EXPORT SelectObjectRequest : public GetObjectRequest
 	{
 	public:
+	    const char* OperationName() const override { return "SelectObject"; }
 		SelectObjectRequest(const std::string& bucket, const std::string& key);
 
 		void setExpression(const std::string& expression, ExpressionType type = SQL);
@@ -43,6 +71,17 @@ namespace OSS
 
         uint64_t MaxSkippedRecordsAllowed() const;
         void setResponseStreamFactory(const IOStreamFactory& factory);
+        /* delivers the output as batches of records as the frames arrive, instead of
+           writing it to the response stream. a retried attempt skips the records already delivered */
+        void setRecordHandler(const SelectRecordHandler& handler);
+        const SelectRecordHandler& RecordHandler() const { return recordHandler_; }
+        /* decodes csv output into columnar batches as the frames arrive, the delimiters are taken
+           from the output format. it is reset on the first attempt and flushed when SelectObject returns */
+        void setColumnDecoder(const std::shared_ptr<SelectObjectColumnDecoder>& decoder);
+        const std::shared_ptr<SelectObjectColumnDecoder>& ColumnDecoder() const { return columnDecoder_; }
+        /* valid after SelectObject returns */
+        const SelectObjectEndFrame& EndFrame() const { return endFrame_; }
+        uint64_t RecordCount() const { return recordCount_; }
 
 	protected:
         friend class OssClientImpl;
@@ -61,6 +100,10 @@ namespace OSS
         mutable std::shared_ptr<std::streambuf> streamBuffer_;
         mutable std::shared_ptr<std::iostream> upperContent_;
         IOStreamFactory upperResponseStreamFactory_;
+        SelectRecordHandler recordHandler_;
+        std::shared_ptr<SelectObjectColumnDecoder> columnDecoder_;
+        mutable SelectObjectEndFrame endFrame_;
+        mutable uint64_t recordCount_;
 	};
 
 }
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketAclRequest: public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketAcl"; }
         SetBucketAclRequest(const std::string& bucket, CannedAccessControlList acl);
         void setAcl(CannedAccessControlList acl);
     protected:
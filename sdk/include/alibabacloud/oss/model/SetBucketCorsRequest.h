@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketCorsRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketCors"; }
         SetBucketCorsRequest(const std::string& bucket);
         void addCORSRule(const CORSRule& rule);
         void setCORSRules(const CORSRuleList& rules);
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketEncryptionRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketEncryption"; }
         SetBucketEncryptionRequest(const std::string& bucket, SSEAlgorithm sse = SSEAlgorithm::AES256, const std::string& key = "");
         void setSSEAlgorithm(SSEAlgorithm sse);
         void setKMSMasterKeyID(const std::string& key);
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketInventoryConfigurationRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketInventoryConfiguration"; }
         SetBucketInventoryConfigurationRequest(const std::string& bucket);
         SetBucketInventoryConfigurationRequest(const std::string& bucket, const InventoryConfiguration& conf);
         void setInventoryConfiguration(InventoryConfiguration conf);
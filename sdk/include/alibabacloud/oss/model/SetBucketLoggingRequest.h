@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketLoggingRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketLogging"; }
         SetBucketLoggingRequest(const std::string& bucket);
         SetBucketLoggingRequest(const std::string& bucket,
             const std::string& targetBucket, const std::string& targetPrefix);
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketRequestPaymentRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketRequestPayment"; }
         SetBucketRequestPaymentRequest(const std::string& bucket);
         SetBucketRequestPaymentRequest(const std::string& bucket, RequestPayer payer);
         void setRequestPayer(RequestPayer payer) { payer_ = payer; }
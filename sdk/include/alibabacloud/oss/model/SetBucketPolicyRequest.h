@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketPolicyRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketPolicy"; }
         SetBucketPolicyRequest(const std::string& bucket);
         SetBucketPolicyRequest(const std::string& bucket, const std::string& policy);
         void setPolicy(const std::string& policy) { policy_ = policy; }
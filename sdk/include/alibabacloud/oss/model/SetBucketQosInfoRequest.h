@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketQosInfoRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketQosInfo"; }
         SetBucketQosInfoRequest(const std::string& bucket);
         SetBucketQosInfoRequest(const std::string& bucket, const QosConfiguration& qos);
     protected:
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketRefererRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketReferer"; }
         SetBucketRefererRequest(const std::string& bucket);
         SetBucketRefererRequest(const std::string& bucket, const RefererList& refererList);
         SetBucketRefererRequest(const std::string& bucket, const RefererList& refererList,
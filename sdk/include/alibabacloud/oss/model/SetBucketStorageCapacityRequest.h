@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketStorageCapacityRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketStorageCapacity"; }
         SetBucketStorageCapacityRequest(const std::string& bucket, int64_t storageCapacity);
     protected:
         virtual ParameterCollection specialParameters() const;
@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketTaggingRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketTagging"; }
         SetBucketTaggingRequest(const std::string& bucket);
         SetBucketTaggingRequest(const std::string& bucket, const Tagging& tagging);
         void setTagging(const Tagging& tagging);
@@ -25,6 +25,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketVersioningRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketVersioning"; }
         SetBucketVersioningRequest(const std::string& bucket, VersioningStatus status);
         void setStatus(VersioningStatus status);
     protected:
@@ -24,6 +24,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetBucketWebsiteRequest : public OssBucketRequest
     {
     public:
+        const char* OperationName() const override { return "SetBucketWebsite"; }
         SetBucketWebsiteRequest(const std::string& bucket);
         void setIndexDocument(const std::string& document)
         { 
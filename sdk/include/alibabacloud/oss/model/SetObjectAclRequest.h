@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetObjectAclRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "SetObjectAcl"; }
         SetObjectAclRequest(const std::string& bucket, const std::string& key);
         SetObjectAclRequest(const std::string& bucket, const std::string& key,
             CannedAccessControlList acl);
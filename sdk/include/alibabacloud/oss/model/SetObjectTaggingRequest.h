@@ -26,6 +26,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT SetObjectTaggingRequest : public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "SetObjectTagging"; }
         SetObjectTaggingRequest(const std::string& bucket, const std::string& key);
         SetObjectTaggingRequest(const std::string& bucket, const std::string& key, 
             const Tagging& tagging);
@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT UploadObjectRequest : public OssResumableBaseRequest
     {
     public:
+        const char* OperationName() const override { return "UploadObject"; }
         UploadObjectRequest(const std::string& bucket, const std::string& key, 
             const std::string& filePath, const std::string& checkpointDir,
             const uint64_t partSize, const uint32_t threadNum);
@@ -27,6 +27,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT UploadPartCopyRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "UploadPartCopy"; }
         UploadPartCopyRequest(const std::string& bucket, const std::string& key);
         UploadPartCopyRequest(const std::string& bucket, const std::string& key,
                               const std::string& srcBucket, const std::string& srcKey);
@@ -38,6 +38,7 @@ namespace OSS
         const std::string& SourceVersionId() { return sourceVersionId_; }
 
      private:
+         void parse(XmlDocument& doc);
         std::string lastModified_;
         std::string eTag_;
         std::string sourceVersionId_;
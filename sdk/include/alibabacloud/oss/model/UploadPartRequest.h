@@ -28,6 +28,7 @@ namespace OSS
     class ALIBABACLOUD_OSS_EXPORT UploadPartRequest: public OssObjectRequest
     {
     public:
+        const char* OperationName() const override { return "UploadPart"; }
         UploadPartRequest(const std::string& bucket, const std::string& key,
             const std::shared_ptr<std::iostream>& content);
         UploadPartRequest(const std::string &bucket, const std::string& key,
@@ -59,6 +59,26 @@ void AlibabaCloud::OSS::SetLogCallback(LogCallback callback)
 {
     SetLogCallbackInner(callback);
 }
+
+void AlibabaCloud::OSS::EnableAsyncLog(size_t bufferSize)
+{
+    SetAsyncLogInner(true, bufferSize);
+}
+
+void AlibabaCloud::OSS::DisableAsyncLog()
+{
+    SetAsyncLogInner(false, 0);
+}
+
+void AlibabaCloud::OSS::FlushLog()
+{
+    FlushLogInner();
+}
+
+uint64_t AlibabaCloud::OSS::GetDroppedLogCount()
+{
+    return GetDroppedLogCountInner();
+}
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 uint64_t AlibabaCloud::OSS::ComputeCRC64(uint64_t crc, void *buf, size_t len)
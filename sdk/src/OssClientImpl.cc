@@ -15,12 +15,17 @@
 */
 
 #include <ctime>
+#include <cstdlib>
 #include <algorithm>
 #include <sstream>
 #include <set>
 #include <tinyxml2/tinyxml2.h>
 #include <alibabacloud/oss/http/HttpType.h>
 #include <alibabacloud/oss/Const.h>
+#include <alibabacloud/oss/client/Metrics.h>
+#include <alibabacloud/oss/client/ObjectContentCache.h>
+#include <alibabacloud/oss/client/ObjectMetaCache.h>
+#include <alibabacloud/oss/client/ObjectBlockCache.h>
 #include <fstream>
 #include "utils/Utils.h"
 #include "utils/SignUtils.h"
@@ -29,7 +34,10 @@
 #include "signer/HmacSha1Signer.h"
 #include "OssClientImpl.h"
 #include "utils/LogUtils.h"
+#include "utils/CpuAccounting.h"
+#include "utils/SharedBufferStream.h"
 #include "utils/FileSystemUtils.h"
+#include "model/ListObjectsXmlParser.h"
 #if !defined(OSS_DISABLE_RESUAMABLE)
 #include "resumable/ResumableUploader.h"
 #include "resumable/ResumableDownloader.h"
@@ -45,6 +53,69 @@ const char *TAG = "OssClientImpl";
 
 const std::string DEFAULT_PRODUCT_NAME = "oss";
 const std::string CLOUDBOX_PRODUCT_NAME = "oss-cloudbox";
+
+/* the largest body a coalesced GetObject copies from the stream of the caller for the others */
+const size_t COALESCING_COPY_LIMIT = 4 * 1024 * 1024;
+
+/* the version and the range of a plain read, false when the read is conditional, processed or reports progress */
+bool ContentCacheVariant(const GetObjectRequest &request, std::string &variant)
+{
+    if (request.TransferProgress().Handler) {
+        return false;
+    }
+    auto parameters = request.Parameters();
+    for (const auto &param : parameters) {
+        if (param.first != "versionId") {
+            return false;
+        }
+    }
+    auto headers = request.Headers();
+    if (headers.count("If-Modified-Since") || headers.count("If-Unmodified-Since") ||
+        headers.count("If-Match") || headers.count("If-None-Match")) {
+        return false;
+    }
+    auto it = parameters.find("versionId");
+    variant = it != parameters.end() ? it->second : "";
+    variant.append(1, '\0');
+    auto header = headers.find(Http::RANGE);
+    if (header != headers.end()) {
+        variant.append(header->second);
+        header = headers.find("x-oss-range-behavior");
+        if (header != headers.end()) {
+            variant.append(1, '\0').append(header->second);
+        }
+    }
+    return true;
+}
+
+/* the version of an object request, empty for the current one */
+std::string ObjectVersion(const OssObjectRequest &request)
+{
+    auto parameters = request.Parameters();
+    auto it = parameters.find("versionId");
+    return it != parameters.end() ? it->second : "";
+}
+
+/* the operation, object, headers, parameters and flags of a read, equal for the reads which can share an answer */
+std::string CoalescingKey(const char *operation, const OssObjectRequest &request)
+{
+    std::string key(operation);
+    key.append(1, '\0').append(request.Bucket()).append(1, '\0').append(request.Key());
+    for (const auto &header : request.Headers()) {
+        key.append(1, '\0').append(header.first).append(1, ':').append(header.second);
+    }
+    for (const auto &param : request.Parameters()) {
+        key.append(1, '\0').append(param.first).append(1, '=').append(param.second);
+    }
+    key.append(1, '\0').append(std::to_string(request.Flags()));
+    return key;
+}
+
+/* the answer of HeadObject to a missing object has no body */
+bool IsMissingObject(const OssError &error)
+{
+    return error.Code() == "NoSuchKey" || error.Code() == "ServerError:404";
+}
 }
 
 OssClientImpl::OssClientImpl(const std::string &endpoint, const std::shared_ptr<CredentialsProvider>& credentialsProvider, const ClientConfiguration & configuration) :
@@ -65,28 +136,47 @@ int OssClientImpl::asyncExecute(Runnable * r) const
 {
     if (executor_ == nullptr)
         return 1;
-    
+
+    auto metrics = configuration().metrics;
+    if (metrics != nullptr) {
+        metrics->adjustExecutorQueueDepth(1);
+        auto task = r;
+        r = new Runnable([task, metrics]() {
+            metrics->adjustExecutorQueueDepth(-1);
+            task->run();
+            delete task;
+        });
+    }
+
     executor_->execute(r);
     return 0;
 }
 
-std::shared_ptr<HttpRequest> OssClientImpl::buildHttpRequest(const std::string & endpoint, const ServiceRequest & msg, Http::Method method) const
+void OssClientImpl::buildHttpRequest(const std::string & endpoint, const ServiceRequest & msg, const std::shared_ptr<HttpRequest> &httpRequest) const
 {
-    auto httpRequest = std::make_shared<HttpRequest>(method);
+    CpuStageScope buildStage(CpuStage::Build);
     auto calcContentMD5 = !!(msg.Flags()&REQUEST_FLAG_CONTENTMD5);
     auto paramInPath = !!(msg.Flags()&REQUEST_FLAG_PARAM_IN_PATH);
     httpRequest->setResponseStreamFactory(msg.ResponseStreamFactory());
     addHeaders(httpRequest, msg.Headers());
     addBody(httpRequest, msg.Body(), calcContentMD5);
+    if (httpRequest->hasObserver()) {
+        auto event = httpRequest->makeEvent(RequestEventType::Built);
+        event.setOperation(msg.OperationName());
+        httpRequest->notifyObserver(event);
+    }
     if (paramInPath) {
         httpRequest->setUrl(Url(msg.Path()));
     }
     else {
         addSignInfo(httpRequest, msg);
+        if (httpRequest->hasObserver()) {
+            auto event = httpRequest->makeEvent(RequestEventType::Signed);
+            httpRequest->notifyObserver(event);
+        }
         addUrl(httpRequest, endpoint, msg);
     }
     addOther(httpRequest, msg);
-    return httpRequest;
 }
 
 bool OssClientImpl::hasResponseError(const std::shared_ptr<HttpResponse>&response) const
@@ -102,6 +192,9 @@ bool OssClientImpl::hasResponseError(const std::shared_ptr<HttpResponse>&respons
         uint64_t clientCrc64 = response->request().Crc64Result();
         uint64_t serverCrc64 = std::strtoull(response->Header("x-oss-hash-crc64ecma").c_str(), nullptr, 10);
         if (clientCrc64 != serverCrc64) {
+            if (configuration().metrics != nullptr) {
+                configuration().metrics->recordCrcFailure();
+            }
             response->setStatusCode(ERROR_CRC_INCONSISTENT);
             std::stringstream ss;
             ss << "Crc64 validation failed. Expected hash:" << serverCrc64
@@ -150,6 +243,7 @@ void OssClientImpl::addBody(const std::shared_ptr<HttpRequest> &httpRequest, con
     }
 
     if (contentMd5 && body && !httpRequest->hasHeader(Http::CONTENT_MD5)) {
+        CpuStageScope checksumStage(CpuStage::Checksum);
         auto md5 = ComputeContentMD5(*body);
         httpRequest->setHeader(Http::CONTENT_MD5, md5);
     }
@@ -159,9 +253,10 @@ void OssClientImpl::addBody(const std::shared_ptr<HttpRequest> &httpRequest, con
 
 void OssClientImpl::addSignInfo(const std::shared_ptr<HttpRequest> &httpRequest, const ServiceRequest &request) const
 {
-    auto credentials = credentialsProvider_->getCredentials();
+    CpuStageScope signStage(CpuStage::Sign);
+    auto credentials = credentialsProvider_->getCredentialsSnapshot();
     auto parameters = request.Parameters();
-    auto ossRequest = static_cast<const OssRequest&>(request);
+    const auto& ossRequest = static_cast<const OssRequest&>(request);
     auto bucket = ossRequest.bucket();
     auto key = ossRequest.key();
     auto region = region_;
@@ -230,10 +325,16 @@ void OssClientImpl::addOther(const std::shared_ptr<HttpRequest> &httpRequest, co
     if (request.Flags() & REQUEST_FLAG_CHUNKED_ENCODING) {
         httpRequest->setChunkedEncoding(true);
     }
+
+    // the response body is compressed by the server and inflated by the http client
+    if (request.Flags() & REQUEST_FLAG_ACCEPT_GZIP) {
+        httpRequest->setAcceptEncoding("gzip");
+    }
 }
 
 OssError OssClientImpl::buildError(const Error &error) const
 {
+    CpuStageScope parseStage(CpuStage::Parse);
     OssError err;
     if (((error.Status() == 203) || (error.Status() > 299 && error.Status() < 600)) && 
         !error.Message().empty()) {
@@ -295,6 +396,7 @@ ServiceResult OssClientImpl::buildResult(const OssRequest &request, const std::s
 
 OssOutcome OssClientImpl::MakeRequest(const OssRequest &request, Http::Method method) const
 {
+    CpuOperationScope cpuScope(configuration().metrics, request.OperationName());
     int ret = request.validate();
     if (ret != 0) {
         return OssOutcome(OssError("ValidateError", request.validateMessage(ret)));
@@ -304,12 +406,35 @@ OssOutcome OssClientImpl::MakeRequest(const OssRequest &request, Http::Method me
         return OssOutcome(OssError("ValidateError", "The endpoint is invalid."));
     }
 
-    auto outcome = BASE::AttemptRequest(endpoint_, request, method);
-    if (outcome.isSuccess()) {
-        return OssOutcome(buildResult(request, outcome.result()));
-    } else {
-        return OssOutcome(buildError(outcome.error()));
+    auto observer = configuration().requestObserver;
+    if (observer == nullptr) {
+        auto outcome = BASE::AttemptRequest(endpoint_, request, method);
+        if (outcome.isSuccess()) {
+            return OssOutcome(buildResult(request, outcome.result()));
+        } else {
+            return OssOutcome(buildError(outcome.error()));
+        }
+    }
+
+    auto requestId = nextRequestId();
+    auto outcome = BASE::AttemptRequest(endpoint_, request, method, requestId);
+    auto ossOutcome = outcome.isSuccess() ? OssOutcome(buildResult(request, outcome.result())) :
+        OssOutcome(buildError(outcome.error()));
+
+    RequestEvent event(RequestEventType::OutcomeParsed, requestId, 0);
+    event.setOperation(request.OperationName());
+    event.setSuccess(ossOutcome.isSuccess());
+    if (ossOutcome.isSuccess()) {
+        event.setServerRequestId(ossOutcome.result().RequestId());
+        event.setStatusCode(ossOutcome.result().responseCode());
     }
+    else {
+        event.setServerRequestId(ossOutcome.error().RequestId());
+        event.setStatusCode(outcome.error().Status());
+        event.setErrorCode(ossOutcome.error().Code());
+    }
+    observer->onRequestEvent(event);
+    return ossOutcome;
 }
 
 #if !defined(OSS_DISABLE_BUCKET)
@@ -979,9 +1104,18 @@ GetBucketWormOutcome OssClientImpl::GetBucketWorm(const GetBucketWormRequest& re
 
 ListObjectOutcome OssClientImpl::ListObjects(const ListObjectsRequest &request) const
 {
-    auto outcome = MakeRequest(request, Http::Method::Get);
+    //parse the response while it is received
+    ListObjectsResult result;
+    ListObjectsXmlParser parser(&result, request.ObjectSummaryHandler(), request.EncodingType());
+    ListObjectsRequest listRequest = request;
+    listRequest.setResponseStreamFactory([&parser]() {
+        parser.reset();
+        return parser.createStream();
+    });
+
+    auto outcome = MakeRequest(listRequest, Http::Method::Get);
     if (outcome.isSuccess()) {
-        ListObjectsResult result(outcome.result().payload());
+        parser.finish();
         result.requestId_ = outcome.result().RequestId();
         return result.ParseDone() ? ListObjectOutcome(std::move(result)) :
             ListObjectOutcome(OssError("ParseXMLError", "Parsing ListObject result fail."));
@@ -993,10 +1127,23 @@ ListObjectOutcome OssClientImpl::ListObjects(const ListObjectsRequest &request)
 
 ListObjectsV2Outcome OssClientImpl::ListObjectsV2(const ListObjectsV2Request &request) const
 {
-    auto outcome = MakeRequest(request, Http::Method::Get);
+    ListObjectsV2Result result;
+    ListObjectsV2XmlParser parser(&result, request.ObjectSummaryHandler(), request.EncodingType());
+    ListObjectsV2Request listRequest = request;
+    listRequest.setResponseStreamFactory([&parser]() {
+        parser.reset();
+        return parser.createStream();
+    });
+
+    const auto &metaCache = configuration().metaCache;
+    auto metaEpochs = metaCache != nullptr ? metaCache->Epochs() : std::vector<uint64_t>();
+    auto outcome = MakeRequest(listRequest, Http::Method::Get);
     if (outcome.isSuccess()) {
-        ListObjectsV2Result result(outcome.result().payload());
+        parser.finish();
         result.requestId_ = outcome.result().RequestId();
+        if (metaCache != nullptr && result.ParseDone()) {
+            cacheListedObjects(request.Bucket(), result.ObjectSummarys(), metaEpochs);
+        }
         return result.ParseDone() ? ListObjectsV2Outcome(std::move(result)) :
             ListObjectsV2Outcome(OssError("ParseXMLError", "Parsing ListObjectV2 result fail."));
     }
@@ -1007,9 +1154,18 @@ ListObjectsV2Outcome OssClientImpl::ListObjectsV2(const ListObjectsV2Request &re
 
 ListObjectVersionsOutcome OssClientImpl::ListObjectVersions(const ListObjectVersionsRequest &request) const
 {
-    auto outcome = MakeRequest(request, Http::Method::Get);
+    ListObjectVersionsResult result;
+    ListObjectVersionsXmlParser parser(&result,
+        request.ObjectVersionSummaryHandler(), request.DeleteMarkerSummaryHandler(), request.EncodingType());
+    ListObjectVersionsRequest listRequest = request;
+    listRequest.setResponseStreamFactory([&parser]() {
+        parser.reset();
+        return parser.createStream();
+    });
+
+    auto outcome = MakeRequest(listRequest, Http::Method::Get);
     if (outcome.isSuccess()) {
-        ListObjectVersionsResult result(outcome.result().payload());
+        parser.finish();
         result.requestId_ = outcome.result().RequestId();
         return result.ParseDone() ? ListObjectVersionsOutcome(std::move(result)) :
             ListObjectVersionsOutcome(OssError("ParseXMLError", "Parsing ListObjectVersions result fail."));
@@ -1022,19 +1178,354 @@ ListObjectVersionsOutcome OssClientImpl::ListObjectVersions(const ListObjectVers
 #undef GetObject
 GetObjectOutcome OssClientImpl::GetObject(const GetObjectRequest &request) const
 {
-    auto outcome = MakeRequest(request, Http::Method::Get);
-    if (outcome.isSuccess()) {
-        return GetObjectOutcome(GetObjectResult(request.Bucket(), request.Key(),
-            outcome.result().payload(),outcome.result().headerCollection()));
+    if (!configuration().enableReadCoalescing || request.TransferProgress().Handler) {
+        return readObject(request);
+    }
+
+    /* the first caller reads the body into a buffer which the concurrent callers share, a body
+       larger than COALESCING_COPY_LIMIT that goes to the stream of the first caller is not kept */
+    bool first = false;
+    GetObjectOutcome own;
+    auto outcome = objectFlight_.run(CoalescingKey("GetObject", request), [this, &request, &first, &own]() {
+        first = true;
+        std::shared_ptr<const std::string> body;
+        own = readIntoBuffer(request, COALESCING_COPY_LIMIT,
+            [this](const GetObjectRequest &bufferRequest) { return readObject(bufferRequest); }, body);
+        if (!own.isSuccess()) {
+            return own;
+        }
+        GetObjectOutcome shared(own);
+        shared.result().setContent(body != nullptr ? std::make_shared<SharedBufferStream>(body) : nullptr);
+        return shared;
+    });
+    if (first) {
+        return own;
+    }
+    if (!outcome.isSuccess()) {
+        return outcome;
+    }
+    if (outcome.result().Content() == nullptr) {
+        return readObject(request);
+    }
+
+    /* a default string stream is replaced by a view of the buffer, other streams get a copy */
+    const auto &body = std::static_pointer_cast<SharedBufferStream>(outcome.result().Content())->data();
+    std::shared_ptr<std::iostream> content;
+    if (request.hasDefaultResponseStreamFactory()) {
+        content = std::make_shared<SharedBufferStream>(body);
     }
     else {
-        return GetObjectOutcome(outcome.error());
+        content = request.ResponseStreamFactory()();
+        if (content == nullptr) {
+            return readObject(request);
+        }
+        content->write(body->data(), static_cast<std::streamsize>(body->size()));
     }
+    outcome.result().setContent(content);
+    return outcome;
+}
+
+GetObjectOutcome OssClientImpl::readIntoBuffer(const GetObjectRequest &request, size_t limit,
+    const std::function<GetObjectOutcome(const GetObjectRequest &)> &read, std::shared_ptr<const std::string> &body) const
+{
+    /* a default string stream is replaced by the buffer, any other stream gets the body
+       while the buffer keeps a copy of at most limit bytes */
+    bool plain = request.hasDefaultResponseStreamFactory();
+    std::shared_ptr<SharedBufferSink> sink;
+    GetObjectRequest bufferRequest(request);
+    bufferRequest.setResponseStreamFactory([&request, &sink, plain, limit]() -> std::shared_ptr<std::iostream> {
+        auto target = plain ? nullptr : request.ResponseStreamFactory()();
+        if (!plain && target == nullptr) {
+            return nullptr;
+        }
+        sink = std::make_shared<SharedBufferSink>(target, plain ? SIZE_MAX : limit);
+        return sink;
+    });
+    auto outcome = read(bufferRequest);
+    body = nullptr;
+    if (!outcome.isSuccess()) {
+        return outcome;
+    }
+    /* without a body the stream of the http client is kept */
+    if (sink == nullptr) {
+        body = std::make_shared<const std::string>();
+        return outcome;
+    }
+    body = sink->data();
+    outcome.result().setContent(plain ? std::make_shared<SharedBufferStream>(body) : sink->target());
+    return outcome;
+}
+
+GetObjectOutcome OssClientImpl::readObject(const GetObjectRequest &request) const
+{
+    /* an invalid request, e.g. a range ending before its start, never reaches the caches */
+    const OssRequest &base = request;
+    if (base.validate() != 0) {
+        return GetObjectOutcome(MakeRequest(request, Http::Method::Get).error());
+    }
+
+    std::string variant;
+    bool plain = ContentCacheVariant(request, variant);
+    const auto &metaCache = configuration().metaCache;
+    uint64_t metaEpoch = metaCache != nullptr ? metaCache->Epoch(request.Bucket(), request.Key()) : 0;
+
+    GetObjectOutcome getOutcome;
+    const auto &blockCache = configuration().blockCache;
+    if (blockCache != nullptr && blockCache->IsOpen() && plain && request.Range().first >= 0) {
+        getOutcome = getBlockCachedObject(request);
+    }
+    else if (configuration().contentCache != nullptr && plain) {
+        getOutcome = getCachedObject(request, variant);
+    }
+    else {
+        auto outcome = MakeRequest(request, Http::Method::Get);
+        if (outcome.isSuccess()) {
+            getOutcome = GetObjectOutcome(GetObjectResult(request.Bucket(), request.Key(),
+                outcome.result().payload(),outcome.result().headerCollection()));
+        }
+        else {
+            getOutcome = GetObjectOutcome(outcome.error());
+        }
+    }
+
+    /* the headers of a full read are the ones of HeadObject */
+    if (metaCache != nullptr && plain && request.Range().first < 0 &&
+        !(request.Flags() & REQUEST_FLAG_ACCEPT_GZIP)) {
+        auto version = ObjectVersion(request);
+        if (getOutcome.isSuccess()) {
+            metaCache->put(request.Bucket(), request.Key(), version,
+                getOutcome.result().Metadata().toHeaderCollection(), true, metaEpoch);
+        }
+        else if (IsMissingObject(getOutcome.error())) {
+            metaCache->putMissing(request.Bucket(), request.Key(), version,
+                getOutcome.error().Code(), getOutcome.error().Message(), metaEpoch);
+        }
+    }
+    return getOutcome;
+}
+
+GetObjectOutcome OssClientImpl::getCachedObject(const GetObjectRequest &request, const std::string &variant) const
+{
+    auto &cache = *configuration().contentCache;
+    ObjectContentCache::Entry entry;
+    bool found = cache.find(request.Bucket(), request.Key(), variant, entry);
+    bool requested = false;
+    OssOutcome outcome;
+    GetObjectOutcome getOutcome;
+    std::shared_ptr<const std::string> body;
+    auto read = [this, &outcome](const GetObjectRequest &bufferRequest) {
+        outcome = MakeRequest(bufferRequest, Http::Method::Get);
+        return outcome.isSuccess() ? GetObjectOutcome(GetObjectResult(bufferRequest.Bucket(), bufferRequest.Key(),
+            outcome.result().payload(), outcome.result().headerCollection())) : GetObjectOutcome(outcome.error());
+    };
+    if (found && !entry.fresh) {
+        GetObjectRequest revalidation(request);
+        revalidation.addNonmatchingETagConstraint(entry.eTag);
+        getOutcome = readIntoBuffer(revalidation, cache.MaxObjectBytes(), read, body);
+        bool unchanged = !outcome.isSuccess() && outcome.error().Code() == "ServerError:304";
+        if (outcome.isSuccess() || unchanged) {
+            cache.revalidated(request.Bucket(), request.Key(), variant, unchanged);
+        }
+        else if (outcome.error().Code() == "NoSuchKey") {
+            invalidateObject(request.Bucket(), request.Key());
+        }
+        requested = !unchanged;
+        found = unchanged;
+    }
+    if (found) {
+        auto content = request.ResponseStreamFactory()();
+        if (content != nullptr) {
+            content->write(entry.content->data(), entry.content->size());
+            return GetObjectOutcome(GetObjectResult(request.Bucket(), request.Key(), content, entry.headers));
+        }
+    }
+    if (!requested) {
+        getOutcome = readIntoBuffer(request, cache.MaxObjectBytes(), read, body);
+    }
+    if (!getOutcome.isSuccess()) {
+        return getOutcome;
+    }
+    /* the body is buffered while it is read, a complete body within the limit is kept */
+    const auto &headers = outcome.result().headerCollection();
+    auto length = headers.find(Http::CONTENT_LENGTH);
+    if (body != nullptr && length != headers.end() &&
+        std::strtoull(length->second.c_str(), nullptr, 10) <= cache.MaxObjectBytes() &&
+        std::to_string(body->size()) == length->second) {
+        cache.put(request.Bucket(), request.Key(), variant, body, headers, entry.epoch);
+    }
+    return getOutcome;
+}
+
+void OssClientImpl::invalidateObject(const std::string &bucket, const std::string &key) const
+{
+    if (configuration().contentCache != nullptr) {
+        configuration().contentCache->invalidate(bucket, key);
+    }
+    if (configuration().metaCache != nullptr) {
+        configuration().metaCache->invalidate(bucket, key);
+    }
+    if (configuration().blockCache != nullptr) {
+        configuration().blockCache->invalidate(bucket, key);
+    }
+}
+
+GetObjectOutcome OssClientImpl::getBlockCachedObject(const GetObjectRequest &request) const
+{
+    auto &cache = *configuration().blockCache;
+    auto fallback = [this, &request]() {
+        auto outcome = MakeRequest(request, Http::Method::Get);
+        return outcome.isSuccess() ? GetObjectOutcome(GetObjectResult(request.Bucket(), request.Key(),
+            outcome.result().payload(), outcome.result().headerCollection())) : GetObjectOutcome(outcome.error());
+    };
+
+    auto version = ObjectVersion(request);
+    ObjectBlockCache::ObjectState state;
+    if (!cache.findObject(request.Bucket(), request.Key(), version, state)) {
+        HeadObjectRequest headRequest(request.Bucket(), request.Key());
+        headRequest.setVersionId(version);
+        headRequest.setRequestPayer(request.RequestPayer());
+        auto headOutcome = HeadObject(headRequest);
+        if (!headOutcome.isSuccess()) {
+            return fallback();
+        }
+        state.eTag = headOutcome.result().ETag();
+        state.size = headOutcome.result().ContentLength();
+        state.headers = headOutcome.result().toHeaderCollection();
+        cache.putObject(request.Bucket(), request.Key(), version, state);
+    }
+
+    /* the server decides about the ranges out of the object, a legacy mode
+       range past the end gets the whole object */
+    auto range = request.Range();
+    bool inside = range.second < 0 || range.second < state.size;
+    if (state.eTag.empty() || range.first >= state.size || (!inside && !request.RangeIsStandardMode())) {
+        return fallback();
+    }
+    const uint64_t blockSize = cache.BlockSize();
+    const uint64_t start = static_cast<uint64_t>(range.first);
+    const uint64_t end = static_cast<uint64_t>(range.second < 0 || range.second >= state.size ? state.size - 1 : range.second);
+    const uint64_t size = static_cast<uint64_t>(state.size);
+    const uint64_t first = start / blockSize;
+    const uint64_t last = end / blockSize;
+    const uint64_t lastBlock = (size - 1) / blockSize;
+
+    std::vector<std::string> blocks(static_cast<size_t>(last - first + 1));
+    uint64_t index = first;
+    while (index <= last) {
+        if (cache.readBlock(request.Bucket(), request.Key(), state.eTag, index, blocks[index - first])) {
+            index++;
+            continue;
+        }
+        /* a run of missing blocks, the one after it is read already */
+        uint64_t next = index + 1;
+        while (next <= last && !cache.readBlock(request.Bucket(), request.Key(), state.eTag, next, blocks[next - first])) {
+            next++;
+        }
+        uint64_t runEnd = next - 1;
+        if (runEnd == last) {
+            runEnd = (std::min)(last + cache.ReadaheadBlocks(), lastBlock);
+        }
+        const uint64_t runStart = index * blockSize;
+        const uint64_t runLength = (std::min)((runEnd + 1) * blockSize, size) - runStart;
+
+        GetObjectRequest fetch(request);
+        fetch.setRange(static_cast<int64_t>(runStart), static_cast<int64_t>(runStart + runLength - 1));
+        fetch.addMatchingETagConstraint("\"" + state.eTag + "\"");
+        fetch.setResponseStreamFactory([]() { return std::make_shared<std::stringstream>(); });
+        auto outcome = MakeRequest(fetch, Http::Method::Get);
+        if (!outcome.isSuccess()) {
+            if (outcome.error().Code() == "PreconditionFailed") {
+                invalidateObject(request.Bucket(), request.Key());
+                return fallback();
+            }
+            return GetObjectOutcome(outcome.error());
+        }
+        auto body = std::static_pointer_cast<std::stringstream>(outcome.result().payload())->str();
+        if (body.size() != runLength) {
+            return fallback();
+        }
+        for (uint64_t block = index; block <= runEnd; block++) {
+            const size_t offset = static_cast<size_t>((block - index) * blockSize);
+            const size_t length = static_cast<size_t>((std::min)(blockSize, runLength - offset));
+            cache.writeBlock(request.Bucket(), request.Key(), state.eTag, block, body.data() + offset, length);
+            if (block <= last) {
+                blocks[block - first].assign(body, offset, length);
+            }
+        }
+        index = next + 1;
+    }
+
+    auto content = request.ResponseStreamFactory()();
+    if (content == nullptr) {
+        return fallback();
+    }
+    for (uint64_t block = first; block <= last; block++) {
+        const auto &data = blocks[block - first];
+        const uint64_t from = block == first ? start - block * blockSize : 0;
+        const uint64_t to = block == last ? end - block * blockSize + 1 : data.size();
+        content->write(data.data() + from, static_cast<std::streamsize>(to - from));
+    }
+    auto headers = state.headers;
+    headers[Http::CONTENT_LENGTH] = std::to_string(end - start + 1);
+    headers[Http::CONTENT_RANGE] = "bytes " + std::to_string(start) + "-" + std::to_string(end) + "/" + std::to_string(size);
+    return GetObjectOutcome(GetObjectResult(request.Bucket(), request.Key(), content, headers));
+}
+
+void OssClientImpl::cacheListedObjects(const std::string &bucket, const ObjectSummaryList &summaries, const std::vector<uint64_t> &epochs) const
+{
+    auto &cache = *configuration().metaCache;
+    for (const auto &summary : summaries) {
+        /* the size of a symlink is not the one of its target */
+        if (summary.Type() == "Symlink") {
+            continue;
+        }
+        HeaderCollection headers;
+        headers[Http::CONTENT_LENGTH] = std::to_string(summary.Size());
+        headers[Http::ETAG] = "\"" + summary.ETag() + "\"";
+        auto lastModified = UtcToUnixTime(summary.LastModified());
+        if (lastModified >= 0) {
+            headers[Http::LAST_MODIFIED] = ToGmtTime(lastModified);
+        }
+        if (!summary.StorageClass().empty()) {
+            headers["x-oss-storage-class"] = summary.StorageClass();
+        }
+        if (!summary.Type().empty()) {
+            headers["x-oss-object-type"] = summary.Type();
+        }
+        cache.put(bucket, summary.Key(), "", headers, false, cache.Epoch(bucket, summary.Key(), epochs));
+    }
+}
+
+ObjectMetaDataOutcome OssClientImpl::getCachedObjectMeta(const OssObjectRequest &request, bool complete) const
+{
+    auto &cache = *configuration().metaCache;
+    auto version = ObjectVersion(request);
+    ObjectMetaCache::Entry entry;
+    if (cache.find(request.Bucket(), request.Key(), version, complete, entry)) {
+        if (!entry.exists) {
+            return ObjectMetaDataOutcome(OssError(entry.errorCode, entry.errorMessage));
+        }
+        ObjectMetaData metaData = entry.headers;
+        return ObjectMetaDataOutcome(std::move(metaData));
+    }
+
+    auto epoch = cache.Epoch(request.Bucket(), request.Key());
+    auto outcome = MakeRequest(request, Http::Method::Head);
+    if (outcome.isSuccess()) {
+        cache.put(request.Bucket(), request.Key(), version, outcome.result().headerCollection(), complete, epoch);
+        ObjectMetaData metaData = outcome.result().headerCollection();
+        return ObjectMetaDataOutcome(std::move(metaData));
+    }
+    if (IsMissingObject(outcome.error())) {
+        cache.putMissing(request.Bucket(), request.Key(), version, outcome.error().Code(), outcome.error().Message(), epoch);
+    }
+    return ObjectMetaDataOutcome(outcome.error());
 }
 
 PutObjectOutcome OssClientImpl::PutObject(const PutObjectRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Put);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return PutObjectOutcome(PutObjectResult(outcome.result().headerCollection(), 
             outcome.result().payload()));
@@ -1047,6 +1538,7 @@ PutObjectOutcome OssClientImpl::PutObject(const PutObjectRequest &request) const
 DeleteObjectOutcome OssClientImpl::DeleteObject(const DeleteObjectRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Delete);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return DeleteObjectOutcome(DeleteObjectResult(outcome.result().headerCollection()));
     }
@@ -1058,6 +1550,9 @@ DeleteObjectOutcome OssClientImpl::DeleteObject(const DeleteObjectRequest &reque
 DeleteObjecstOutcome OssClientImpl::DeleteObjects(const DeleteObjectsRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Post);
+    for (const auto &key : request.KeyList()) {
+        invalidateObject(request.Bucket(), key);
+    }
     if (outcome.isSuccess()) {
         DeleteObjectsResult result(outcome.result().payload());
         result.requestId_ = outcome.result().RequestId();
@@ -1072,6 +1567,9 @@ DeleteObjecstOutcome OssClientImpl::DeleteObjects(const DeleteObjectsRequest &re
 DeleteObjecVersionstOutcome OssClientImpl::DeleteObjectVersions(const DeleteObjectVersionsRequest& request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Post);
+    for (const auto &object : request.Objects()) {
+        invalidateObject(request.Bucket(), object.Key());
+    }
     if (outcome.isSuccess()) {
         DeleteObjectVersionsResult result(outcome.result().payload());
         result.requestId_ = outcome.result().RequestId();
@@ -1085,18 +1583,30 @@ DeleteObjecVersionstOutcome OssClientImpl::DeleteObjectVersions(const DeleteObje
 
 ObjectMetaDataOutcome OssClientImpl::HeadObject(const HeadObjectRequest &request) const
 {
-    auto outcome = MakeRequest(request, Http::Method::Head);
-    if (outcome.isSuccess()) {
-        ObjectMetaData metaData = outcome.result().headerCollection();
-        return ObjectMetaDataOutcome(std::move(metaData));
-    }
-    else {
-        return ObjectMetaDataOutcome(outcome.error());
+    if (configuration().enableReadCoalescing) {
+        return metaFlight_.run(CoalescingKey("HeadObject", request), [this, &request]() {
+            return readObjectMeta(request, true);
+        });
     }
+    return readObjectMeta(request, true);
 }
 
 ObjectMetaDataOutcome OssClientImpl::GetObjectMeta(const GetObjectMetaRequest &request) const
 {
+    if (configuration().enableReadCoalescing) {
+        return metaFlight_.run(CoalescingKey("GetObjectMeta", request), [this, &request]() {
+            return readObjectMeta(request, false);
+        });
+    }
+    return readObjectMeta(request, false);
+}
+
+ObjectMetaDataOutcome OssClientImpl::readObjectMeta(const OssObjectRequest &request, bool complete) const
+{
+    if (configuration().metaCache != nullptr) {
+        return getCachedObjectMeta(request, complete);
+    }
+
     auto outcome = MakeRequest(request, Http::Method::Head);
     if (outcome.isSuccess()) {
         ObjectMetaData metaData = outcome.result().headerCollection();
@@ -1123,6 +1633,7 @@ GetObjectAclOutcome OssClientImpl::GetObjectAcl(const GetObjectAclRequest &reque
 AppendObjectOutcome OssClientImpl::AppendObject(const AppendObjectRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Post);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
 		AppendObjectResult result(outcome.result().headerCollection());
         return result.ParseDone() ? AppendObjectOutcome(std::move(result)) :
@@ -1136,6 +1647,7 @@ AppendObjectOutcome OssClientImpl::AppendObject(const AppendObjectRequest &reque
 CopyObjectOutcome OssClientImpl::CopyObject(const CopyObjectRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Put);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return CopyObjectOutcome(CopyObjectResult(outcome.result().headerCollection(), outcome.result().payload()));
     }
@@ -1158,6 +1670,7 @@ GetSymlinkOutcome OssClientImpl::GetSymlink(const GetSymlinkRequest &request) co
 RestoreObjectOutcome OssClientImpl::RestoreObject(const RestoreObjectRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Post);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return RestoreObjectOutcome(RestoreObjectResult(outcome.result().headerCollection()));
     }
@@ -1169,6 +1682,7 @@ RestoreObjectOutcome OssClientImpl::RestoreObject(const RestoreObjectRequest &re
 CreateSymlinkOutcome OssClientImpl::CreateSymlink(const CreateSymlinkRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Put);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return CreateSymlinkOutcome(CreateSymlinkResult(outcome.result().headerCollection()));
     }
@@ -1233,6 +1747,7 @@ CreateSelectObjectMetaOutcome OssClientImpl::CreateSelectObjectMeta(const Create
 SetObjectTaggingOutcome OssClientImpl::SetObjectTagging(const SetObjectTaggingRequest& request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Put);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return SetObjectTaggingOutcome(SetObjectTaggingResult(outcome.result().headerCollection()));
     }
@@ -1244,6 +1759,7 @@ SetObjectTaggingOutcome OssClientImpl::SetObjectTagging(const SetObjectTaggingRe
 DeleteObjectTaggingOutcome OssClientImpl::DeleteObjectTagging(const DeleteObjectTaggingRequest& request) const
 {
     auto outcome = MakeRequest(request, Http::Method::Delete);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()) {
         return DeleteObjectTaggingOutcome(DeleteObjectTaggingResult(outcome.result().headerCollection()));
     }
@@ -1272,7 +1788,7 @@ StringOutcome OssClientImpl::GeneratePresignedUrl(const GeneratePresignedUrlRequ
         return StringOutcome(OssError("ValidateError", "The Bucket or Key is invalid."));
     }
 
-    auto credentials = credentialsProvider_->getCredentials();
+    auto credentials = credentialsProvider_->getCredentialsSnapshot();
     auto bucket = request.bucket_;
     auto key = request.key_;
     auto region = region_;
@@ -1376,6 +1892,7 @@ UploadPartCopyOutcome OssClientImpl::UploadPartCopy(const UploadPartCopyRequest
 CompleteMultipartUploadOutcome OssClientImpl::CompleteMultipartUpload(const CompleteMultipartUploadRequest &request) const
 {
     auto outcome = MakeRequest(request, Http::Post);
+    invalidateObject(request.Bucket(), request.Key());
     if (outcome.isSuccess()){
         CompleteMultipartUploadResult result(outcome.result().payload(), outcome.result().headerCollection());
         result.requestId_ = outcome.result().RequestId();
@@ -1707,7 +2224,8 @@ StringOutcome OssClientImpl::GenerateRTMPSignedUrl(const GenerateRTMPSignedUrlRe
     }
 
     ParameterCollection parameters;
-    const Credentials credentials = credentialsProvider_->getCredentials();
+    auto credentialsPtr = credentialsProvider_->getCredentialsSnapshot();
+    const Credentials& credentials = *credentialsPtr;
     if (!credentials.SessionToken().empty()) {
         parameters["security-token"] = credentials.SessionToken();
     }
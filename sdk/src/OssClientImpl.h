@@ -25,6 +25,7 @@
 #include <alibabacloud/oss/OssFwd.h>
 #include "signer/Signer.h"
 #include "client/Client.h"
+#include "utils/SingleFlight.h"
 #ifdef GetObject
 #undef GetObject
 #endif
@@ -174,7 +175,7 @@ namespace OSS
         void SetCloudBoxId(const std::string &cloudboxId);
 
     protected:
-        virtual std::shared_ptr<HttpRequest> buildHttpRequest(const std::string & endpoint, const ServiceRequest &msg, Http::Method method) const;
+        virtual void buildHttpRequest(const std::string & endpoint, const ServiceRequest &msg, const std::shared_ptr<HttpRequest> &httpRequest) const;
         virtual bool hasResponseError(const std::shared_ptr<HttpResponse>&response)  const;
         OssOutcome MakeRequest(const OssRequest &request, Http::Method method) const;
 
@@ -188,6 +189,16 @@ namespace OSS
         OssError buildError(const Error &error) const;
         ServiceResult buildResult(const OssRequest &request, const std::shared_ptr<HttpResponse> &httpResponse) const;
 
+        GetObjectOutcome readObject(const GetObjectRequest &request) const;
+        GetObjectOutcome readIntoBuffer(const GetObjectRequest &request, size_t limit,
+            const std::function<GetObjectOutcome(const GetObjectRequest &)> &read, std::shared_ptr<const std::string> &body) const;
+        ObjectMetaDataOutcome readObjectMeta(const OssObjectRequest &request, bool complete) const;
+        GetObjectOutcome getCachedObject(const GetObjectRequest &request, const std::string &variant) const;
+        GetObjectOutcome getBlockCachedObject(const GetObjectRequest &request) const;
+        void invalidateObject(const std::string &bucket, const std::string &key) const;
+        ObjectMetaDataOutcome getCachedObjectMeta(const OssObjectRequest &request, bool complete) const;
+        void cacheListedObjects(const std::string &bucket, const ObjectSummaryList &summaries, const std::vector<uint64_t> &epochs) const;
+
     private:
         std::string endpoint_;
         std::shared_ptr<CredentialsProvider> credentialsProvider_;
@@ -196,6 +207,8 @@ namespace OSS
         bool isValidEndpoint_;
         std::string region_;
         std::string cloudboxId_;
+        mutable SingleFlight<GetObjectOutcome> objectFlight_;
+        mutable SingleFlight<ObjectMetaDataOutcome> metaFlight_;
     };
 }
 }
@@ -22,7 +22,8 @@ using namespace AlibabaCloud::OSS;
 ServiceRequest::ServiceRequest() :
     flags_(0),
     path_("/"),
-    responseStreamFactory_([] { return std::make_shared<std::stringstream>(); })
+    responseStreamFactory_([] { return std::make_shared<std::stringstream>(); }),
+    defaultResponseStreamFactory_(true)
 {
     transferProgress_.Handler = nullptr;
     transferProgress_.UserData = nullptr;
@@ -46,6 +47,12 @@ const IOStreamFactory& ServiceRequest::ResponseStreamFactory() const
 void ServiceRequest::setResponseStreamFactory(const IOStreamFactory& factory) 
 {
     responseStreamFactory_ = factory; 
+    defaultResponseStreamFactory_ = false;
+}
+
+bool ServiceRequest::hasDefaultResponseStreamFactory() const
+{
+    return defaultResponseStreamFactory_;
 }
 
 const AlibabaCloud::OSS::TransferProgress & ServiceRequest::TransferProgress() const 
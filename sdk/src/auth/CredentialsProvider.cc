@@ -22,6 +22,11 @@ CredentialsProvider::~CredentialsProvider()
 {
 }
 
+std::shared_ptr<const Credentials> CredentialsProvider::getCredentialsSnapshot()
+{
+    return std::make_shared<const Credentials>(getCredentials());
+}
+
 Credentials EnvironmentVariableCredentialsProvider::getCredentials()
 {
     auto value = std::getenv("OSS_ACCESS_KEY_ID");
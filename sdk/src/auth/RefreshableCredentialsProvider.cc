@@ -0,0 +1,223 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/auth/CredentialsProvider.h>
+#include <alibabacloud/oss/client/ClientConfiguration.h>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include "../external/json/json.h"
+#include "../http/CurlHttpClient.h"
+#include "../utils/Utils.h"
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "RefreshableCredentialsProvider";
+
+static bool ParseCredentialsJson(std::istream &stream, Credentials &credentials, std::time_t &expiration)
+{
+    Json::Value root;
+    Json::CharReaderBuilder rbuilder;
+    std::string errMsg;
+    if (!Json::parseFromStream(rbuilder, stream, &root, &errMsg)) {
+        OSS_LOG(LogLevel::LogError, TAG, "parse credentials fail, %s", errMsg.c_str());
+        return false;
+    }
+
+    if (!root.isObject() ||
+        (root.isMember("Code") && root["Code"].asString() != "Success") ||
+        root["AccessKeyId"].asString().empty() ||
+        root["AccessKeySecret"].asString().empty()) {
+        OSS_LOG(LogLevel::LogError, TAG, "credentials content is invalid.");
+        return false;
+    }
+
+    credentials.setAccessKeyId(root["AccessKeyId"].asString());
+    credentials.setAccessKeySecret(root["AccessKeySecret"].asString());
+    credentials.setSessionToken(root["SecurityToken"].asString());
+
+    expiration = 0;
+    auto value = root["Expiration"].asString();
+    if (!value.empty()) {
+        expiration = UtcToUnixTime(value);
+        if (expiration == -1) {
+            expiration = ToUnixTime(value, "%Y-%m-%dT%H:%M:%SZ");
+        }
+        if (expiration == -1) {
+            OSS_LOG(LogLevel::LogError, TAG, "credentials Expiration is invalid, %s", value.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+CredentialsFetcher::~CredentialsFetcher()
+{
+}
+
+FileCredentialsFetcher::FileCredentialsFetcher(const std::string &filePath) :
+    CredentialsFetcher(),
+    filePath_(filePath)
+{
+}
+
+FileCredentialsFetcher::~FileCredentialsFetcher()
+{
+}
+
+bool FileCredentialsFetcher::fetch(Credentials &credentials, std::time_t &expiration)
+{
+    std::ifstream in(filePath_, std::ios::in | std::ios::binary);
+    if (!in.good()) {
+        OSS_LOG(LogLevel::LogError, TAG, "open credentials file fail, %s", filePath_.c_str());
+        return false;
+    }
+    return ParseCredentialsJson(in, credentials, expiration);
+}
+
+HttpCredentialsFetcher::HttpCredentialsFetcher(const std::string &url, long timeoutMs) :
+    CredentialsFetcher(),
+    url_(url)
+{
+    ClientConfiguration conf;
+    conf.requestTimeoutMs = timeoutMs;
+    conf.connectTimeoutMs = timeoutMs;
+    conf.maxConnections = 1;
+    httpClient_ = std::make_shared<CurlHttpClient>(conf);
+}
+
+HttpCredentialsFetcher::~HttpCredentialsFetcher()
+{
+}
+
+bool HttpCredentialsFetcher::fetch(Credentials &credentials, std::time_t &expiration)
+{
+    auto request = std::make_shared<HttpRequest>(Http::Method::Get);
+    request->setUrl(Url(url_));
+    request->setResponseStreamFactory([]() { return std::make_shared<std::stringstream>(); });
+    auto response = httpClient_->makeRequest(request);
+    if (response == nullptr || response->statusCode() / 100 != 2 || response->Body() == nullptr) {
+        OSS_LOG(LogLevel::LogError, TAG, "fetch credentials from %s fail, status:%ld",
+            url_.c_str(), response ? response->statusCode() : -1L);
+        return false;
+    }
+    return ParseCredentialsJson(*response->Body(), credentials, expiration);
+}
+
+RefreshableCredentialsProvider::RefreshableCredentialsProvider(const std::shared_ptr<CredentialsFetcher> &fetcher,
+    long refreshAheadSeconds, long retryIntervalMs) :
+    CredentialsProvider(),
+    fetcher_(fetcher),
+    refreshAheadSeconds_(refreshAheadSeconds),
+    retryIntervalMs_(retryIntervalMs),
+    credentials_(std::make_shared<const Credentials>("", "")),
+    expiration_(0),
+    lastRefreshOk_(false),
+    shutdown_(false)
+{
+    //without a fetcher there is nothing to refresh, the empty credentials are kept
+    if (fetcher_ == nullptr) {
+        OSS_LOG(LogLevel::LogError, TAG, "provider(%p) has no credentials fetcher", this);
+        return;
+    }
+
+    //the first fetch is synchronous, so that the first request has credentials to sign with
+    refresh();
+    thread_ = std::thread(&RefreshableCredentialsProvider::refreshLoop, this);
+}
+
+RefreshableCredentialsProvider::~RefreshableCredentialsProvider()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        shutdown_ = true;
+    }
+    signal_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+Credentials RefreshableCredentialsProvider::getCredentials()
+{
+    return *getCredentialsSnapshot();
+}
+
+std::shared_ptr<const Credentials> RefreshableCredentialsProvider::getCredentialsSnapshot()
+{
+    return std::atomic_load(&credentials_);
+}
+
+std::time_t RefreshableCredentialsProvider::Expiration() const
+{
+    return expiration_.load();
+}
+
+bool RefreshableCredentialsProvider::refresh()
+{
+    std::lock_guard<std::mutex> lck(refreshLock_);
+    if (fetcher_ == nullptr) {
+        return false;
+    }
+
+    Credentials credentials("", "");
+    std::time_t expiration = 0;
+    if (!fetcher_->fetch(credentials, expiration)) {
+        OSS_LOG(LogLevel::LogWarn, TAG, "provider(%p) refresh credentials fail", this);
+        lastRefreshOk_ = false;
+        return false;
+    }
+
+    std::shared_ptr<const Credentials> snapshot = std::make_shared<const Credentials>(std::move(credentials));
+    std::atomic_store(&credentials_, snapshot);
+    expiration_ = expiration;
+    lastRefreshOk_ = true;
+    OSS_LOG(LogLevel::LogDebug, TAG, "provider(%p) refresh credentials done, expiration:%lld",
+        this, static_cast<long long>(expiration));
+    return true;
+}
+
+void RefreshableCredentialsProvider::refreshLoop()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    while (!shutdown_) {
+        auto expiration = expiration_.load();
+        if (lastRefreshOk_.load() && expiration == 0) {
+            //never expires
+            signal_.wait(lck, [this]() { return shutdown_; });
+            break;
+        }
+
+        //retry interval also bounds the refresh rate of short-lived credentials
+        auto next = std::chrono::system_clock::now() + std::chrono::milliseconds(retryIntervalMs_);
+        if (lastRefreshOk_.load()) {
+            auto refreshAt = std::chrono::system_clock::from_time_t(expiration - refreshAheadSeconds_);
+            next = (std::max)(next, refreshAt);
+        }
+
+        if (signal_.wait_until(lck, next, [this]() { return shutdown_; })) {
+            break;
+        }
+
+        lck.unlock();
+        refresh();
+        lck.lock();
+    }
+}
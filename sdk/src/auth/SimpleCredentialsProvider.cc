@@ -20,7 +20,7 @@ using namespace AlibabaCloud::OSS;
 
 SimpleCredentialsProvider::SimpleCredentialsProvider(const Credentials &credentials):
     CredentialsProvider(),
-    credentials_(credentials)
+    credentials_(std::make_shared<const Credentials>(credentials))
 {
 }
 
@@ -28,7 +28,7 @@ SimpleCredentialsProvider::SimpleCredentialsProvider(const std::string & accessK
     const std::string & accessKeySecret,
     const std::string &securityToken) :
     CredentialsProvider(),
-    credentials_(accessKeyId, accessKeySecret, securityToken)
+    credentials_(std::make_shared<const Credentials>(accessKeyId, accessKeySecret, securityToken))
 {
 }
 
@@ -37,6 +37,11 @@ SimpleCredentialsProvider::~SimpleCredentialsProvider()
 }
 
 Credentials SimpleCredentialsProvider::getCredentials()
+{
+    return *credentials_;
+}
+
+std::shared_ptr<const Credentials> SimpleCredentialsProvider::getCredentialsSnapshot()
 {
     return credentials_;
 }
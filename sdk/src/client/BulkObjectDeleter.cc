@@ -0,0 +1,253 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/BulkObjectDeleter.h>
+#include <chrono>
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "BulkObjectDeleter";
+const size_t MAX_KEYS_PER_REQUEST = 1000;
+}
+
+BulkObjectDeleter::BulkObjectDeleter(const OssClient& client, const std::string& bucket) :
+    client_(client),
+    bucket_(bucket),
+    concurrency_(8),
+    maxRetries_(3),
+    requestPayer_(RequestPayer::NotSet),
+    closing_(false),
+    deletedCount_(0),
+    failedCount_(0)
+{
+    pending_.versioned = false;
+}
+
+BulkObjectDeleter::~BulkObjectDeleter()
+{
+    flush();
+}
+
+void BulkObjectDeleter::addKey(const std::string& key)
+{
+    addObject(ObjectIdentifier(key));
+}
+
+void BulkObjectDeleter::addObject(const ObjectIdentifier& object)
+{
+    if (pending_.objects.empty()) {
+        pending_.objects.reserve(MAX_KEYS_PER_REQUEST);
+    }
+    pending_.objects.push_back(object);
+    pending_.versioned = pending_.versioned || !object.VersionId().empty();
+    if (pending_.objects.size() >= MAX_KEYS_PER_REQUEST) {
+        dispatch();
+    }
+}
+
+bool BulkObjectDeleter::deletePrefix(const std::string& prefix)
+{
+    auto failed = failedCount_.load();
+    std::vector<std::string> keys;
+    ListObjectsV2Request request(bucket_);
+    request.setPrefix(prefix);
+    request.setMaxKeys(static_cast<int>(MAX_KEYS_PER_REQUEST));
+    request.setRequestPayer(requestPayer_);
+    request.setObjectSummaryHandler([&keys](const ObjectSummary& summary) {
+        keys.push_back(summary.Key());
+    });
+
+    bool listDone = false;
+    while (true) {
+        keys.clear();
+        auto outcome = client_.ListObjectsV2(request);
+        if (!outcome.isSuccess()) {
+            OSS_LOG(LogLevel::LogError, TAG, "deleter(%p) list prefix:%s fail, code:%s",
+                this, prefix.c_str(), outcome.error().Code().c_str());
+            std::lock_guard<std::mutex> lck(lock_);
+            listError_ = outcome.error();
+            break;
+        }
+        for (const auto& key : keys) {
+            addKey(key);
+        }
+        if (!outcome.result().IsTruncated()) {
+            listDone = true;
+            break;
+        }
+        request.setContinuationToken(outcome.result().NextContinuationToken());
+    }
+
+    flush();
+    return listDone && failedCount_ == failed;
+}
+
+bool BulkObjectDeleter::deleteVersions(const std::string& prefix)
+{
+    auto failed = failedCount_.load();
+    ObjectIdentifierList objects;
+    ListObjectVersionsRequest request(bucket_);
+    request.setPrefix(prefix);
+    request.setMaxKeys(static_cast<int>(MAX_KEYS_PER_REQUEST));
+    request.setObjectVersionSummaryHandler([&objects](const ObjectVersionSummary& summary) {
+        objects.push_back(ObjectIdentifier(summary.Key(), summary.VersionId()));
+    });
+    request.setDeleteMarkerSummaryHandler([&objects](const DeleteMarkerSummary& summary) {
+        objects.push_back(ObjectIdentifier(summary.Key(), summary.VersionId()));
+    });
+
+    bool listDone = false;
+    while (true) {
+        objects.clear();
+        auto outcome = client_.ListObjectVersions(request);
+        if (!outcome.isSuccess()) {
+            OSS_LOG(LogLevel::LogError, TAG, "deleter(%p) list versions of prefix:%s fail, code:%s",
+                this, prefix.c_str(), outcome.error().Code().c_str());
+            std::lock_guard<std::mutex> lck(lock_);
+            listError_ = outcome.error();
+            break;
+        }
+        for (const auto& object : objects) {
+            addObject(object);
+        }
+        if (!outcome.result().IsTruncated()) {
+            listDone = true;
+            break;
+        }
+        request.setKeyMarker(outcome.result().NextKeyMarker());
+        request.setVersionIdMarker(outcome.result().NextVersionIdMarker());
+    }
+
+    flush();
+    return listDone && failedCount_ == failed;
+}
+
+void BulkObjectDeleter::flush()
+{
+    dispatch();
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        closing_ = true;
+    }
+    signal_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+    closing_ = false;
+}
+
+BulkDeleteErrorList BulkObjectDeleter::Errors() const
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    return errors_;
+}
+
+void BulkObjectDeleter::dispatch()
+{
+    if (pending_.objects.empty()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lck(lock_);
+    //bounds the memory held by the chunks waiting to be sent
+    signal_.wait(lck, [this]() { return chunks_.size() < 2 * static_cast<size_t>(concurrency_); });
+    chunks_.push_back(std::move(pending_));
+    pending_ = Chunk();
+    pending_.versioned = false;
+    if (workers_.size() < static_cast<size_t>(concurrency_)) {
+        workers_.push_back(std::thread(&BulkObjectDeleter::workLoop, this));
+    }
+    lck.unlock();
+    signal_.notify_all();
+}
+
+void BulkObjectDeleter::workLoop()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    while (true) {
+        signal_.wait(lck, [this]() { return closing_ || !chunks_.empty(); });
+        if (chunks_.empty()) {
+            break;
+        }
+        Chunk chunk = std::move(chunks_.front());
+        chunks_.pop_front();
+        lck.unlock();
+        signal_.notify_all();
+
+        uint64_t count = chunk.objects.size();
+        OssError error = deleteChunk(chunk);
+
+        lck.lock();
+        if (error.Code().empty()) {
+            deletedCount_ += count;
+        }
+        else {
+            failedCount_ += count;
+            errors_.push_back(BulkDeleteError(error, std::move(chunk.objects)));
+        }
+    }
+}
+
+OssError BulkObjectDeleter::deleteChunk(const Chunk& chunk)
+{
+    DeleteObjectVersionsRequest versionsRequest(bucket_);
+    DeleteObjectsRequest request(bucket_);
+    if (chunk.versioned) {
+        versionsRequest.setQuiet(true);
+        versionsRequest.setObjects(chunk.objects);
+        versionsRequest.setRequestPayer(requestPayer_);
+    }
+    else {
+        request.setQuiet(true);
+        request.setRequestPayer(requestPayer_);
+        for (const auto& object : chunk.objects) {
+            request.addKey(object.Key());
+        }
+    }
+
+    for (int attempt = 0; ; attempt++) {
+        OssError error;
+        if (chunk.versioned) {
+            auto outcome = client_.DeleteObjectVersions(versionsRequest);
+            if (outcome.isSuccess()) {
+                return OssError();
+            }
+            error = outcome.error();
+        }
+        else {
+            auto outcome = client_.DeleteObjects(request);
+            if (outcome.isSuccess()) {
+                return OssError();
+            }
+            error = outcome.error();
+        }
+
+        OSS_LOG(LogLevel::LogWarn, TAG, "deleter(%p) delete %d objects fail, attempt:%d, code:%s",
+            this, static_cast<int>(chunk.objects.size()), attempt, error.Code().c_str());
+        if (attempt >= maxRetries_) {
+            return error;
+        }
+        //the shift is clamped, 100ms << 6 is already past the 5s cap
+        auto delay = (std::min)(100LL << (std::min)(attempt, 6), 5000LL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    }
+}
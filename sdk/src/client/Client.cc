@@ -15,6 +15,7 @@
  */
 
 #include <alibabacloud/oss/client/RetryStrategy.h>
+#include <alibabacloud/oss/client/Metrics.h>
 #include <alibabacloud/oss/utils/Executor.h>
 #include <tinyxml2/tinyxml2.h>
 #include "Client.h"
@@ -23,6 +24,8 @@
 #include "../signer/Signer.h"
 #include <sstream>
 #include <ctime>
+#include <chrono>
+#include <atomic>
 
 
 using namespace AlibabaCloud::OSS;
@@ -50,44 +53,71 @@ std::string Client::serviceName()const
     return serviceName_;
 }
 
-Client::ClientOutcome Client::AttemptRequest(const std::string & endpoint, const ServiceRequest & request, Http::Method method) const
+Client::ClientOutcome Client::AttemptRequest(const std::string & endpoint, const ServiceRequest & request, Http::Method method, uint64_t requestId) const
 {
-    for (int retry =0; ;retry++) {
-        auto outcome = AttemptOnceRequest(endpoint, request, method);
-        if (outcome.isSuccess()) {
-            return outcome;
-        } 
-        else if (!httpClient_->isEnable()) {
-            return outcome;
+    MetricsRegistry *metrics = configuration_.metrics.get();
+    RequestObserver *observer = configuration_.requestObserver.get();
+    if (observer != nullptr && requestId == 0) {
+        requestId = nextRequestId();
+    }
+    std::chrono::steady_clock::time_point start;
+    if (metrics != nullptr) {
+        start = std::chrono::steady_clock::now();
+    }
+
+    ClientOutcome outcome;
+    int retry = 0;
+    for (; ; retry++) {
+        outcome = AttemptOnceRequest(endpoint, request, method, requestId, retry);
+        if (outcome.isSuccess() || !httpClient_->isEnable()) {
+            break;
         }
-        else {
-            if (configuration_.enableDateSkewAdjustment &&
-                outcome.error().Status() == 403 &&
-                outcome.error().Message().find("RequestTimeTooSkewed")) {
-                auto serverTimeStr = analyzeServerTime(outcome.error().Message());
-                auto serverTime = UtcToUnixTime(serverTimeStr);
-                if (serverTime != -1) {
-                    std::time_t localTime = std::time(nullptr);
-                    setRequestDateOffset(serverTime - localTime);
-                }
-            }
-            RetryStrategy *retryStrategy = configuration().retryStrategy.get();
-            if (retryStrategy == nullptr || !retryStrategy->shouldRetry(outcome.error(), retry)) {
-                return outcome;
+        if (configuration_.enableDateSkewAdjustment &&
+            outcome.error().Status() == 403 &&
+            outcome.error().Message().find("RequestTimeTooSkewed")) {
+            auto serverTimeStr = analyzeServerTime(outcome.error().Message());
+            auto serverTime = UtcToUnixTime(serverTimeStr);
+            if (serverTime != -1) {
+                std::time_t localTime = std::time(nullptr);
+                setRequestDateOffset(serverTime - localTime);
             }
-            long sleepTmeMs = retryStrategy->calcDelayTimeMs(outcome.error(), retry);
-            httpClient_->waitForRetry(sleepTmeMs);
         }
+        RetryStrategy *retryStrategy = configuration().retryStrategy.get();
+        if (retryStrategy == nullptr || !retryStrategy->shouldRetry(outcome.error(), retry)) {
+            break;
+        }
+        if (metrics != nullptr) {
+            metrics->recordRetry(outcome.error().Code());
+        }
+        long sleepTmeMs = retryStrategy->calcDelayTimeMs(outcome.error(), retry);
+        if (observer != nullptr) {
+            RequestEvent event(RequestEventType::RetryScheduled, requestId, retry);
+            event.setErrorCode(outcome.error().Code());
+            event.setStatusCode(outcome.error().Status());
+            event.setDelayMs(sleepTmeMs);
+            observer->onRequestEvent(event);
+        }
+        httpClient_->waitForRetry(sleepTmeMs);
     }
+
+    if (metrics != nullptr) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        metrics->recordRequest(request.OperationName(), outcome.isSuccess(), retry, static_cast<uint64_t>(elapsed.count()));
+    }
+    return outcome;
 }
 
-Client::ClientOutcome Client::AttemptOnceRequest(const std::string & endpoint, const ServiceRequest & request, Http::Method method) const
+Client::ClientOutcome Client::AttemptOnceRequest(const std::string & endpoint, const ServiceRequest & request, Http::Method method, uint64_t requestId, int attempt) const
 {
     if (!httpClient_->isEnable()) {
         return ClientOutcome(Error("ClientError:100002", "Disable all requests by upper."));
     }
 
-    auto r = buildHttpRequest(endpoint, request, method);
+    auto r = std::make_shared<HttpRequest>(method);
+    if (configuration_.requestObserver != nullptr) {
+        r->setObserver(configuration_.requestObserver, requestId, attempt);
+    }
+    buildHttpRequest(endpoint, request, r);
     auto response = httpClient_->makeRequest(r); 
     
     if(hasResponseError(response)) {
@@ -153,6 +183,12 @@ bool Client::hasResponseError(const std::shared_ptr<HttpResponse>&response)const
     return (response->statusCode()/100 != 2);
 }
 
+uint64_t Client::nextRequestId() const
+{
+    static std::atomic<uint64_t> requestId(0);
+    return ++requestId;
+}
+
 void Client::disableRequest()
 {
     httpClient_->disable();
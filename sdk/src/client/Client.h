@@ -44,9 +44,12 @@ namespace OSS
         bool isEnableRequest() const;
 
     protected:
-        ClientOutcome AttemptRequest(const std::string & endpoint, const ServiceRequest &request, Http::Method method) const;
-        ClientOutcome AttemptOnceRequest(const std::string & endpoint, const ServiceRequest &request, Http::Method method) const;
-        virtual std::shared_ptr<HttpRequest> buildHttpRequest(const std::string & endpoint, const ServiceRequest &msg, Http::Method method) const = 0;
+        /* requestId is the id passed to the request observer, 0 to take a new one */
+        ClientOutcome AttemptRequest(const std::string & endpoint, const ServiceRequest &request, Http::Method method, uint64_t requestId = 0) const;
+        ClientOutcome AttemptOnceRequest(const std::string & endpoint, const ServiceRequest &request, Http::Method method, uint64_t requestId, int attempt) const;
+        /* fills the headers, body, url and signature of the httpRequest */
+        virtual void buildHttpRequest(const std::string & endpoint, const ServiceRequest &msg, const std::shared_ptr<HttpRequest> &httpRequest) const = 0;
+        uint64_t nextRequestId() const;
         virtual bool hasResponseError(const std::shared_ptr<HttpResponse>&response) const;
         
         void setRequestDateOffset(uint64_t offset) const;
@@ -119,7 +119,12 @@ ClientConfiguration::ClientConfiguration() :
     isPathStyle(false),
     isVerifyObjectStrict(true),
     signatureVersion(SignatureVersionType::V1),
-    httpInterceptor(nullptr)
+    httpInterceptor(nullptr),
+    requestObserver(nullptr),
+    contentCache(nullptr),
+    metaCache(nullptr),
+    blockCache(nullptr),
+    enableReadCoalescing(false)
 {
 
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ListObjectsV2Paginator.h>
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "ListObjectsV2Paginator";
+}
+
+ListObjectsV2Paginator::Iterator::Iterator(ListObjectsV2Paginator* paginator) :
+    paginator_(paginator),
+    outcome_()
+{
+    ++(*this);
+}
+
+ListObjectsV2Paginator::Iterator& ListObjectsV2Paginator::Iterator::operator++()
+{
+    if (paginator_ != nullptr) {
+        if (paginator_->hasNext()) {
+            outcome_ = paginator_->next();
+        }
+        else {
+            paginator_ = nullptr;
+            outcome_ = ListObjectsV2Outcome();
+        }
+    }
+    return *this;
+}
+
+ListObjectsV2Paginator::ListObjectsV2Paginator(const OssClient& client, const ListObjectsV2Request& request,
+    size_t prefetchDepth, size_t maxBufferedBytes) :
+    client_(client),
+    request_(request),
+    prefetchDepth_(prefetchDepth > 0 ? prefetchDepth : 1),
+    maxBufferedBytes_(maxBufferedBytes),
+    bufferedBytes_(0),
+    finished_(false),
+    shutdown_(false)
+{
+    thread_ = std::thread(&ListObjectsV2Paginator::prefetchLoop, this);
+}
+
+ListObjectsV2Paginator::~ListObjectsV2Paginator()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        shutdown_ = true;
+    }
+    signal_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool ListObjectsV2Paginator::hasNext()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    signal_.wait(lck, [this]() { return !pages_.empty() || finished_; });
+    return !pages_.empty();
+}
+
+ListObjectsV2Outcome ListObjectsV2Paginator::next()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    signal_.wait(lck, [this]() { return !pages_.empty() || finished_; });
+    if (pages_.empty()) {
+        return ListObjectsV2Outcome(OssError("ValidateError", "There are no more pages."));
+    }
+
+    ListObjectsV2Outcome outcome = std::move(pages_.front().outcome);
+    bufferedBytes_ -= pages_.front().size;
+    pages_.pop_front();
+    lck.unlock();
+    signal_.notify_all();
+    return outcome;
+}
+
+ListObjectsV2Paginator::Iterator ListObjectsV2Paginator::begin()
+{
+    return Iterator(this);
+}
+
+bool ListObjectsV2Paginator::canPrefetch() const
+{
+    //one page is always allowed, even if it alone exceeds the memory limit
+    if (pages_.empty()) {
+        return true;
+    }
+    return pages_.size() < prefetchDepth_ &&
+        (maxBufferedBytes_ == 0 || bufferedBytes_ < maxBufferedBytes_);
+}
+
+void ListObjectsV2Paginator::prefetchLoop()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    while (!shutdown_ && !finished_) {
+        signal_.wait(lck, [this]() { return shutdown_ || canPrefetch(); });
+        if (shutdown_) {
+            break;
+        }
+
+        lck.unlock();
+        auto outcome = client_.ListObjectsV2(request_);
+        lck.lock();
+
+        bool truncated = outcome.isSuccess() && outcome.result().IsTruncated();
+        //a truncated page without a token would list the same page again forever
+        bool missingToken = truncated && outcome.result().NextContinuationToken().empty();
+        if (truncated) {
+            request_.setContinuationToken(outcome.result().NextContinuationToken());
+        }
+        else if (!outcome.isSuccess()) {
+            OSS_LOG(LogLevel::LogError, TAG, "paginator(%p) list page fail, code:%s",
+                this, outcome.error().Code().c_str());
+        }
+
+        Page page;
+        page.size = outcome.isSuccess() ? EstimateSize(outcome.result()) : 0;
+        page.outcome = std::move(outcome);
+        bufferedBytes_ += page.size;
+        pages_.push_back(std::move(page));
+        if (missingToken) {
+            OSS_LOG(LogLevel::LogError, TAG, "paginator(%p) truncated page without continuation token", this);
+            Page error;
+            error.size = 0;
+            error.outcome = ListObjectsV2Outcome(OssError("ListObjectsV2Error",
+                "The listing is truncated but has no NextContinuationToken."));
+            pages_.push_back(std::move(error));
+        }
+        finished_ = !truncated || missingToken;
+        signal_.notify_all();
+    }
+}
+
+size_t ListObjectsV2Paginator::EstimateSize(const ListObjectsV2Result& result)
+{
+    size_t size = sizeof(ListObjectsV2Result);
+    for (const auto& summary : result.ObjectSummarys()) {
+        size += sizeof(ObjectSummary) + summary.Key().size() + summary.ETag().size() +
+            summary.LastModified().size() + summary.StorageClass().size() + summary.Type().size() +
+            summary.Owner().Id().size() + summary.Owner().DisplayName().size() + summary.RestoreInfo().size();
+    }
+    for (const auto& prefix : result.CommonPrefixes()) {
+        size += sizeof(std::string) + prefix.size();
+    }
+    return size;
+}
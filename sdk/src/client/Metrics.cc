@@ -0,0 +1,568 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/Metrics.h>
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+    const size_t SUB_BUCKET_BITS = 5;
+    const size_t MAX_EXPONENT = 40;
+
+    /* written by the owning thread only, so a relaxed load and store is enough */
+    struct Counter
+    {
+        Counter() : value(0) {}
+        void add(uint64_t n) { value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+        uint64_t get() const { return value.load(std::memory_order_relaxed); }
+        std::atomic<uint64_t> value;
+    };
+
+    struct HistogramCounter
+    {
+        HistogramCounter() : buckets(LatencyHistogram::BUCKET_COUNT) {}
+        void record(uint64_t micros)
+        {
+            buckets[LatencyHistogram::BucketIndex(micros)].add(1);
+            count.add(1);
+            sum.add(micros);
+        }
+        std::vector<Counter> buckets;
+        Counter count;
+        Counter sum;
+    };
+
+    struct OperationCounter
+    {
+        Counter requests;
+        Counter errors;
+        Counter retries;
+        HistogramCounter latency;
+        Counter cpu;
+        Counter stageCpu[static_cast<int>(CpuStage::Count)];
+    };
+
+    const char* StageNames[static_cast<int>(CpuStage::Count)] = {
+        "build", "sign", "checksum", "encryption", "parse", "log"
+    };
+
+    std::atomic<uint64_t> NextRegistryId(1);
+
+    int MostSignificantBit(uint64_t value)
+    {
+        int bit = 0;
+        while (value >>= 1) {
+            bit++;
+        }
+        return bit;
+    }
+
+    std::string EscapeLabel(const std::string& value)
+    {
+        std::string out;
+        for (char c : value) {
+            if (c == '\\' || c == '"') {
+                out.push_back('\\');
+                out.push_back(c);
+            }
+            else if (c == '\n') {
+                out.append("\\n");
+            }
+            else {
+                out.push_back(c);
+            }
+        }
+        return out;
+    }
+
+    const double PROMETHEUS_BUCKETS[] = {
+        0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0, 60.0
+    };
+
+    void WriteHistogram(std::stringstream& ss, const std::string& name, const std::string& labels,
+        const LatencyHistogram& histogram)
+    {
+        std::string sep = labels.empty() ? "" : ",";
+        for (double le : PROMETHEUS_BUCKETS) {
+            ss << name << "_bucket{" << labels << sep << "le=\"" << le << "\"} "
+               << histogram.CountAtOrBelow(static_cast<uint64_t>(le * 1000000)) << "\n";
+        }
+        ss << name << "_bucket{" << labels << sep << "le=\"+Inf\"} " << histogram.Count() << "\n";
+        ss << name << "_sum";
+        if (!labels.empty()) {
+            ss << "{" << labels << "}";
+        }
+        ss << " " << (histogram.Sum() / 1000000.0) << "\n";
+        ss << name << "_count";
+        if (!labels.empty()) {
+            ss << "{" << labels << "}";
+        }
+        ss << " " << histogram.Count() << "\n";
+    }
+}
+
+struct MetricsRegistry::Shard
+{
+    /* guards the insertion into the maps, the counters are read without it */
+    std::mutex lock;
+    /* keyed by the address of the operation name, the names are merged by value in collect */
+    std::unordered_map<const char*, std::unique_ptr<OperationCounter>> operations;
+    std::unordered_map<std::string, std::unique_ptr<Counter>> retries;
+    Counter bytesSent;
+    Counter bytesReceived;
+    Counter crcFailures;
+    HistogramCounter curlAcquireWait;
+};
+
+struct MetricsRegistry::ShardList
+{
+    /* the shards of the live threads, and the counters of the threads which have exited */
+    std::mutex lock;
+    std::vector<std::shared_ptr<Shard>> shards;
+    MetricsSnapshot retired;
+};
+
+/* the shards of the calling thread, they are retired when the thread exits */
+struct MetricsRegistry::LocalShardList
+{
+    struct Entry
+    {
+        uint64_t id;
+        std::weak_ptr<ShardList> list;
+        std::shared_ptr<Shard> shard;
+    };
+
+    ~LocalShardList()
+    {
+        for (const auto& entry : entries) {
+            auto list = entry.list.lock();
+            if (list != nullptr) {
+                retireShard(*list, entry.shard);
+            }
+        }
+    }
+
+    std::vector<Entry> entries;
+};
+
+const size_t LatencyHistogram::SUB_BUCKET_COUNT;
+const size_t LatencyHistogram::BUCKET_COUNT;
+
+LatencyHistogram::LatencyHistogram() :
+    buckets_(BUCKET_COUNT, 0),
+    count_(0),
+    sum_(0)
+{
+}
+
+size_t LatencyHistogram::BucketIndex(uint64_t micros)
+{
+    if (micros < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(micros);
+    }
+    size_t exponent = static_cast<size_t>(MostSignificantBit(micros));
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    size_t mantissa = static_cast<size_t>(micros >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKET_COUNT;
+    return SUB_BUCKET_COUNT + (exponent - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT + mantissa;
+}
+
+uint64_t LatencyHistogram::BucketLowerBound(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    uint64_t mantissa = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + mantissa) << shift;
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    return BucketLowerBound(index) + (static_cast<uint64_t>(1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t micros, uint64_t count)
+{
+    buckets_[BucketIndex(micros)] += count;
+    count_ += count;
+    sum_ += micros * count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+}
+
+void LatencyHistogram::subtract(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        buckets_[i] -= (std::min)(buckets_[i], other.buckets_[i]);
+    }
+    count_ -= (std::min)(count_, other.count_);
+    sum_ -= (std::min)(sum_, other.sum_);
+}
+
+uint64_t LatencyHistogram::Min() const
+{
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        if (buckets_[i] > 0) {
+            return BucketLowerBound(i);
+        }
+    }
+    return 0;
+}
+
+uint64_t LatencyHistogram::Max() const
+{
+    for (size_t i = BUCKET_COUNT; i > 0; i--) {
+        if (buckets_[i - 1] > 0) {
+            return BucketUpperBound(i - 1);
+        }
+    }
+    return 0;
+}
+
+double LatencyHistogram::Mean() const
+{
+    return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(double p) const
+{
+    if (count_ == 0) {
+        return 0;
+    }
+    p = (std::max)(0.0, (std::min)(p, 100.0));
+    uint64_t target = static_cast<uint64_t>(p / 100.0 * static_cast<double>(count_) + 0.5);
+    target = (std::max)(target, static_cast<uint64_t>(1));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets_[i];
+        if (seen >= target) {
+            return BucketUpperBound(i);
+        }
+    }
+    return Max();
+}
+
+uint64_t LatencyHistogram::CountAtOrBelow(uint64_t micros) const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT && BucketUpperBound(i) <= micros; i++) {
+        total += buckets_[i];
+    }
+    return total;
+}
+
+OperationMetrics::OperationMetrics() :
+    requests_(0),
+    errors_(0),
+    retries_(0),
+    cpuNanos_(0)
+{
+    for (auto& nanos : stageCpuNanos_) {
+        nanos = 0;
+    }
+}
+
+MetricsSnapshot::MetricsSnapshot() :
+    bytesSent_(0),
+    bytesReceived_(0),
+    crcFailures_(0),
+    curlPoolSize_(0),
+    executorQueueDepth_(0)
+{
+}
+
+std::string MetricsSnapshot::PrometheusText(const std::string& prefix) const
+{
+    std::stringstream ss;
+    ss << "# TYPE " << prefix << "_requests_total counter\n";
+    for (const auto& op : operations_) {
+        ss << prefix << "_requests_total{operation=\"" << EscapeLabel(op.first) << "\"} "
+           << op.second.Requests() << "\n";
+    }
+    ss << "# TYPE " << prefix << "_request_errors_total counter\n";
+    for (const auto& op : operations_) {
+        ss << prefix << "_request_errors_total{operation=\"" << EscapeLabel(op.first) << "\"} "
+           << op.second.Errors() << "\n";
+    }
+    ss << "# TYPE " << prefix << "_request_retries_total counter\n";
+    for (const auto& op : operations_) {
+        ss << prefix << "_request_retries_total{operation=\"" << EscapeLabel(op.first) << "\"} "
+           << op.second.Retries() << "\n";
+    }
+    ss << "# TYPE " << prefix << "_request_duration_seconds histogram\n";
+    for (const auto& op : operations_) {
+        WriteHistogram(ss, prefix + "_request_duration_seconds",
+            "operation=\"" + EscapeLabel(op.first) + "\"", op.second.Latency());
+    }
+    ss << "# TYPE " << prefix << "_operation_cpu_seconds_total counter\n";
+    for (const auto& op : operations_) {
+        if (op.second.CpuNanos() == 0) {
+            continue;
+        }
+        uint64_t other = op.second.CpuNanos();
+        for (int i = 0; i < static_cast<int>(CpuStage::Count); i++) {
+            uint64_t nanos = op.second.StageCpuNanos(static_cast<CpuStage>(i));
+            other -= (std::min)(other, nanos);
+            ss << prefix << "_operation_cpu_seconds_total{operation=\"" << EscapeLabel(op.first) << "\",stage=\""
+               << StageNames[i] << "\"} " << (nanos / 1e9) << "\n";
+        }
+        ss << prefix << "_operation_cpu_seconds_total{operation=\"" << EscapeLabel(op.first) << "\",stage=\"other\"} "
+           << (other / 1e9) << "\n";
+    }
+    ss << "# TYPE " << prefix << "_retries_total counter\n";
+    for (const auto& retry : retriesByErrorCode_) {
+        ss << prefix << "_retries_total{code=\"" << EscapeLabel(retry.first) << "\"} " << retry.second << "\n";
+    }
+    ss << "# TYPE " << prefix << "_bytes_sent_total counter\n";
+    ss << prefix << "_bytes_sent_total " << bytesSent_ << "\n";
+    ss << "# TYPE " << prefix << "_bytes_received_total counter\n";
+    ss << prefix << "_bytes_received_total " << bytesReceived_ << "\n";
+    ss << "# TYPE " << prefix << "_crc_failures_total counter\n";
+    ss << prefix << "_crc_failures_total " << crcFailures_ << "\n";
+    ss << "# TYPE " << prefix << "_curl_pool_size gauge\n";
+    ss << prefix << "_curl_pool_size " << curlPoolSize_ << "\n";
+    ss << "# TYPE " << prefix << "_curl_acquire_wait_seconds histogram\n";
+    WriteHistogram(ss, prefix + "_curl_acquire_wait_seconds", "", curlAcquireWait_);
+    ss << "# TYPE " << prefix << "_executor_queue_depth gauge\n";
+    ss << prefix << "_executor_queue_depth " << executorQueueDepth_ << "\n";
+    return ss.str();
+}
+
+MetricsRegistry::MetricsRegistry() :
+    id_(NextRegistryId++),
+    shards_(std::make_shared<ShardList>()),
+    curlPoolSize_(0),
+    executorQueueDepth_(0),
+    stageCpu_(false)
+{
+}
+
+MetricsRegistry::~MetricsRegistry()
+{
+}
+
+MetricsRegistry::LocalShardList& MetricsRegistry::localShards()
+{
+    static thread_local LocalShardList list;
+    return list;
+}
+
+MetricsRegistry::Shard& MetricsRegistry::localShard()
+{
+    auto& local = localShards();
+    for (const auto& entry : local.entries) {
+        if (entry.id == id_) {
+            return *entry.shard;
+        }
+    }
+    // drop the shards of the registries which are gone
+    local.entries.erase(std::remove_if(local.entries.begin(), local.entries.end(),
+        [](const LocalShardList::Entry& entry) { return entry.list.expired(); }),
+        local.entries.end());
+
+    auto shard = std::make_shared<Shard>();
+    {
+        std::lock_guard<std::mutex> lck(shards_->lock);
+        shards_->shards.push_back(shard);
+    }
+    local.entries.push_back(LocalShardList::Entry{ id_, shards_, shard });
+    return *shard;
+}
+
+void MetricsRegistry::retireShard(ShardList& list, const std::shared_ptr<Shard>& shard)
+{
+    std::lock_guard<std::mutex> lck(list.lock);
+    collectShard(*shard, list.retired);
+    list.shards.erase(std::remove(list.shards.begin(), list.shards.end(), shard), list.shards.end());
+}
+
+void MetricsRegistry::recordRequest(const char* operation, bool success, int retries, uint64_t latencyMicros)
+{
+    Shard& shard = localShard();
+    auto it = shard.operations.find(operation);
+    if (it == shard.operations.end()) {
+        std::lock_guard<std::mutex> lck(shard.lock);
+        it = shard.operations.emplace(operation, std::unique_ptr<OperationCounter>(new OperationCounter())).first;
+    }
+    OperationCounter& op = *it->second;
+    op.requests.add(1);
+    if (!success) {
+        op.errors.add(1);
+    }
+    if (retries > 0) {
+        op.retries.add(static_cast<uint64_t>(retries));
+    }
+    op.latency.record(latencyMicros);
+}
+
+void MetricsRegistry::recordRetry(const std::string& errorCode)
+{
+    Shard& shard = localShard();
+    auto it = shard.retries.find(errorCode);
+    if (it == shard.retries.end()) {
+        std::lock_guard<std::mutex> lck(shard.lock);
+        it = shard.retries.emplace(errorCode, std::unique_ptr<Counter>(new Counter())).first;
+    }
+    it->second->add(1);
+}
+
+void MetricsRegistry::recordTransfer(uint64_t sent, uint64_t received)
+{
+    Shard& shard = localShard();
+    shard.bytesSent.add(sent);
+    shard.bytesReceived.add(received);
+}
+
+void MetricsRegistry::recordCrcFailure()
+{
+    localShard().crcFailures.add(1);
+}
+
+void MetricsRegistry::recordCurlAcquireWait(uint64_t micros)
+{
+    localShard().curlAcquireWait.record(micros);
+}
+
+void MetricsRegistry::recordCpu(const char* operation, uint64_t cpuNanos, const uint64_t* stageNanos)
+{
+    Shard& shard = localShard();
+    auto it = shard.operations.find(operation);
+    if (it == shard.operations.end()) {
+        std::lock_guard<std::mutex> lck(shard.lock);
+        it = shard.operations.emplace(operation, std::unique_ptr<OperationCounter>(new OperationCounter())).first;
+    }
+    OperationCounter& op = *it->second;
+    op.cpu.add(cpuNanos);
+    for (int i = 0; i < static_cast<int>(CpuStage::Count); i++) {
+        if (stageNanos[i] > 0) {
+            op.stageCpu[i].add(stageNanos[i]);
+        }
+    }
+}
+
+void MetricsRegistry::collectShard(Shard& shard, MetricsSnapshot& snapshot)
+{
+    auto collectHistogram = [](const HistogramCounter& counter, LatencyHistogram& histogram) {
+        for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+            histogram.buckets_[i] += counter.buckets[i].get();
+        }
+        histogram.count_ += counter.count.get();
+        histogram.sum_ += counter.sum.get();
+    };
+
+    std::lock_guard<std::mutex> lck(shard.lock);
+    for (const auto& entry : shard.operations) {
+        OperationMetrics& op = snapshot.operations_[entry.first];
+        op.requests_ += entry.second->requests.get();
+        op.errors_ += entry.second->errors.get();
+        op.retries_ += entry.second->retries.get();
+        collectHistogram(entry.second->latency, op.latency_);
+        op.cpuNanos_ += entry.second->cpu.get();
+        for (int i = 0; i < static_cast<int>(CpuStage::Count); i++) {
+            op.stageCpuNanos_[i] += entry.second->stageCpu[i].get();
+        }
+    }
+    for (const auto& entry : shard.retries) {
+        snapshot.retriesByErrorCode_[entry.first] += entry.second->get();
+    }
+    snapshot.bytesSent_ += shard.bytesSent.get();
+    snapshot.bytesReceived_ += shard.bytesReceived.get();
+    snapshot.crcFailures_ += shard.crcFailures.get();
+    collectHistogram(shard.curlAcquireWait, snapshot.curlAcquireWait_);
+}
+
+MetricsSnapshot MetricsRegistry::collect() const
+{
+    // under the list lock, so an exiting thread is counted either in its shard or in the retired total
+    MetricsSnapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lck(shards_->lock);
+        snapshot = shards_->retired;
+        for (const auto& shard : shards_->shards) {
+            collectShard(*shard, snapshot);
+        }
+    }
+    snapshot.curlPoolSize_ = curlPoolSize_.load();
+    snapshot.executorQueueDepth_ = executorQueueDepth_.load();
+    return snapshot;
+}
+
+MetricsSnapshot MetricsRegistry::Snapshot() const
+{
+    MetricsSnapshot snapshot = collect();
+    std::lock_guard<std::mutex> lck(lock_);
+    for (auto& op : snapshot.operations_) {
+        auto base = baseline_.operations_.find(op.first);
+        if (base == baseline_.operations_.end()) {
+            continue;
+        }
+        op.second.requests_ -= (std::min)(op.second.requests_, base->second.requests_);
+        op.second.errors_ -= (std::min)(op.second.errors_, base->second.errors_);
+        op.second.retries_ -= (std::min)(op.second.retries_, base->second.retries_);
+        op.second.latency_.subtract(base->second.latency_);
+        op.second.cpuNanos_ -= (std::min)(op.second.cpuNanos_, base->second.cpuNanos_);
+        for (int i = 0; i < static_cast<int>(CpuStage::Count); i++) {
+            op.second.stageCpuNanos_[i] -= (std::min)(op.second.stageCpuNanos_[i], base->second.stageCpuNanos_[i]);
+        }
+    }
+    for (auto& retry : snapshot.retriesByErrorCode_) {
+        auto base = baseline_.retriesByErrorCode_.find(retry.first);
+        if (base != baseline_.retriesByErrorCode_.end()) {
+            retry.second -= (std::min)(retry.second, base->second);
+        }
+    }
+    snapshot.bytesSent_ -= (std::min)(snapshot.bytesSent_, baseline_.bytesSent_);
+    snapshot.bytesReceived_ -= (std::min)(snapshot.bytesReceived_, baseline_.bytesReceived_);
+    snapshot.crcFailures_ -= (std::min)(snapshot.crcFailures_, baseline_.crcFailures_);
+    snapshot.curlAcquireWait_.subtract(baseline_.curlAcquireWait_);
+    return snapshot;
+}
+
+void MetricsRegistry::Reset()
+{
+    // the counters belong to the recording threads, so a reset only moves the baseline
+    MetricsSnapshot snapshot = collect();
+    std::lock_guard<std::mutex> lck(lock_);
+    baseline_ = snapshot;
+}
+
+std::string MetricsRegistry::PrometheusText(const std::string& prefix) const
+{
+    return Snapshot().PrometheusText(prefix);
+}
+
+const char* MetricsRegistry::StageName(CpuStage stage)
+{
+    int index = static_cast<int>(stage);
+    return (index >= 0 && index < static_cast<int>(CpuStage::Count)) ? StageNames[index] : "";
+}
@@ -0,0 +1,539 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ObjectBlockCache.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "../utils/Crc64.h"
+#include "../utils/FileSystemUtils.h"
+#ifdef _WIN32
+#include <windows.h>
+#ifdef CreateDirectory
+#undef CreateDirectory
+#endif
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+    const char INDEX_MAGIC[8] = { 'O', 'S', 'S', 'B', 'L', 'K', 'C', '1' };
+    const uint32_t INDEX_VERSION = 1;
+    const uint32_t SLOT_FREE = 0;
+    const uint32_t SLOT_VALID = 1;
+    const size_t MAX_OBJECT_STATES = 10000;
+
+    struct IndexHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t blockSize;
+        uint64_t slotCount;
+        uint8_t reserved[40];
+    };
+
+    /* one per slot of the data file, the state is written last */
+    struct SlotRecord
+    {
+        uint64_t keyHi;
+        uint64_t keyLo;
+        uint64_t crc;
+        uint64_t lastUse;
+        uint32_t length;
+        uint32_t state;
+        uint8_t reserved[24];
+    };
+
+    static_assert(sizeof(IndexHeader) == 64, "the index header is 64 bytes");
+    static_assert(sizeof(SlotRecord) == 64, "a slot record is 64 bytes");
+
+    struct BlockKey
+    {
+        uint64_t hi;
+        uint64_t lo;
+        bool operator==(const BlockKey& other) const { return hi == other.hi && lo == other.lo; }
+    };
+
+    struct BlockKeyHash
+    {
+        size_t operator()(const BlockKey& key) const
+        {
+            return static_cast<size_t>(key.hi ^ (key.lo * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+    /* stable across processes, the crc64 and the fnv-1a of the name make 128 bits */
+    BlockKey MakeBlockKey(const std::string& bucket, const std::string& key, const std::string& eTag, uint64_t index)
+    {
+        std::string name;
+        name.reserve(bucket.size() + key.size() + eTag.size() + 24);
+        name.append(bucket).append(1, '\0').append(key).append(1, '\0').append(eTag).append(1, '\0');
+        name.append(std::to_string(index));
+        BlockKey blockKey;
+        blockKey.hi = CRC64::CalcCRC(0, const_cast<char*>(name.data()), name.size());
+        uint64_t fnv = 0xCBF29CE484222325ULL;
+        for (auto c : name) {
+            fnv ^= static_cast<uint8_t>(c);
+            fnv *= 0x100000001B3ULL;
+        }
+        blockKey.lo = fnv;
+        return blockKey;
+    }
+
+    std::string ObjectId(const std::string& bucket, const std::string& key)
+    {
+        std::string id;
+        id.reserve(bucket.size() + key.size() + 2);
+        id.append(bucket).append(1, '\0').append(key).append(1, '\0');
+        return id;
+    }
+
+    class BlockFile
+    {
+    public:
+#ifdef _WIN32
+        BlockFile() : file_(INVALID_HANDLE_VALUE), mapping_(NULL), view_(nullptr) {}
+        ~BlockFile()
+        {
+            unmap();
+            if (file_ != INVALID_HANDLE_VALUE) {
+                CloseHandle(file_);
+            }
+        }
+        /* not shared, a second cache on the directory fails to open it */
+        bool open(const std::string& path, bool exclusive)
+        {
+            (void)exclusive;
+            file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+            return file_ != INVALID_HANDLE_VALUE;
+        }
+        uint64_t size() const
+        {
+            LARGE_INTEGER size;
+            return GetFileSizeEx(file_, &size) ? static_cast<uint64_t>(size.QuadPart) : 0;
+        }
+        bool resize(uint64_t size)
+        {
+            LARGE_INTEGER offset;
+            offset.QuadPart = static_cast<LONGLONG>(size);
+            return SetFilePointerEx(file_, offset, NULL, FILE_BEGIN) && SetEndOfFile(file_);
+        }
+        bool read(uint64_t offset, char* buf, size_t len) const
+        {
+            OVERLAPPED ov;
+            std::memset(&ov, 0, sizeof(ov));
+            ov.Offset = static_cast<DWORD>(offset);
+            ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD done = 0;
+            return ReadFile(file_, buf, static_cast<DWORD>(len), &done, &ov) && done == len;
+        }
+        bool write(uint64_t offset, const char* buf, size_t len)
+        {
+            OVERLAPPED ov;
+            std::memset(&ov, 0, sizeof(ov));
+            ov.Offset = static_cast<DWORD>(offset);
+            ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD done = 0;
+            return WriteFile(file_, buf, static_cast<DWORD>(len), &done, &ov) && done == len;
+        }
+        void* map(size_t len)
+        {
+            mapping_ = CreateFileMappingA(file_, NULL, PAGE_READWRITE, 0, 0, NULL);
+            if (mapping_ == NULL) {
+                return nullptr;
+            }
+            view_ = MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, len);
+            return view_;
+        }
+        void unmap()
+        {
+            if (view_ != nullptr) {
+                UnmapViewOfFile(view_);
+                view_ = nullptr;
+            }
+            if (mapping_ != NULL) {
+                CloseHandle(mapping_);
+                mapping_ = NULL;
+            }
+        }
+    private:
+        HANDLE file_;
+        HANDLE mapping_;
+        void* view_;
+#else
+        BlockFile() : fd_(-1), view_(nullptr), viewSize_(0) {}
+        ~BlockFile()
+        {
+            unmap();
+            if (fd_ >= 0) {
+                ::close(fd_);
+            }
+        }
+        /* an exclusive file lock, a second cache on the directory fails to open it */
+        bool open(const std::string& path, bool exclusive)
+        {
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd_ < 0) {
+                return false;
+            }
+            return !exclusive || ::flock(fd_, LOCK_EX | LOCK_NB) == 0;
+        }
+        uint64_t size() const
+        {
+            struct stat st;
+            return ::fstat(fd_, &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+        }
+        bool resize(uint64_t size)
+        {
+            return ::ftruncate(fd_, static_cast<off_t>(size)) == 0;
+        }
+        bool read(uint64_t offset, char* buf, size_t len) const
+        {
+            while (len > 0) {
+                auto n = ::pread(fd_, buf, len, static_cast<off_t>(offset));
+                if (n <= 0) {
+                    return false;
+                }
+                buf += n;
+                len -= static_cast<size_t>(n);
+                offset += static_cast<uint64_t>(n);
+            }
+            return true;
+        }
+        bool write(uint64_t offset, const char* buf, size_t len)
+        {
+            while (len > 0) {
+                auto n = ::pwrite(fd_, buf, len, static_cast<off_t>(offset));
+                if (n <= 0) {
+                    return false;
+                }
+                buf += n;
+                len -= static_cast<size_t>(n);
+                offset += static_cast<uint64_t>(n);
+            }
+            return true;
+        }
+        void* map(size_t len)
+        {
+            void* view = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            if (view == MAP_FAILED) {
+                return nullptr;
+            }
+            view_ = view;
+            viewSize_ = len;
+            return view_;
+        }
+        void unmap()
+        {
+            if (view_ != nullptr) {
+                ::munmap(view_, viewSize_);
+                view_ = nullptr;
+            }
+        }
+    private:
+        int fd_;
+        void* view_;
+        size_t viewSize_;
+#endif
+    };
+}
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    class ObjectBlockCache::Store
+    {
+    public:
+        struct ObjectEntry
+        {
+            ObjectState state;
+            std::chrono::steady_clock::time_point validated;
+        };
+
+        Store() : records(nullptr), slotCount(0), blockSize(0), tick(0), opened(false) {}
+
+        bool open(const std::string& directory, uint64_t capacityBytes, uint32_t size)
+        {
+            blockSize = size;
+            slotCount = blockSize > 0 ? capacityBytes / blockSize : 0;
+            if (slotCount == 0 || (!IsDirectoryExist(directory) && !CreateDirectory(directory))) {
+                return false;
+            }
+            const uint64_t indexSize = sizeof(IndexHeader) + slotCount * sizeof(SlotRecord);
+            if (!indexFile.open(directory + "/blocks.idx", true) || !dataFile.open(directory + "/blocks.dat", false)) {
+                return false;
+            }
+            if (indexFile.size() != indexSize && !indexFile.resize(indexSize)) {
+                return false;
+            }
+            auto view = static_cast<char*>(indexFile.map(static_cast<size_t>(indexSize)));
+            if (view == nullptr) {
+                return false;
+            }
+            auto header = reinterpret_cast<IndexHeader*>(view);
+            records = reinterpret_cast<SlotRecord*>(view + sizeof(IndexHeader));
+            if (std::memcmp(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || header->version != INDEX_VERSION ||
+                header->blockSize != blockSize || header->slotCount != slotCount) {
+                /* a new cache, or one of another geometry */
+                std::memset(view, 0, static_cast<size_t>(indexSize));
+                header->version = INDEX_VERSION;
+                header->blockSize = blockSize;
+                header->slotCount = slotCount;
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+                std::memcpy(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+            }
+            if (dataFile.size() != slotCount * blockSize && !dataFile.resize(slotCount * blockSize)) {
+                return false;
+            }
+            load();
+            opened = true;
+            return true;
+        }
+
+        void load()
+        {
+            lruPos.resize(static_cast<size_t>(slotCount));
+            std::vector<uint64_t> valid;
+            for (uint64_t slot = 0; slot < slotCount; slot++) {
+                const auto& record = records[slot];
+                if (record.state == SLOT_VALID && record.length <= blockSize) {
+                    valid.push_back(slot);
+                }
+                else {
+                    records[slot].state = SLOT_FREE;
+                    freeSlots.push_back(slot);
+                }
+            }
+            std::sort(valid.begin(), valid.end(), [this](uint64_t a, uint64_t b) {
+                return records[a].lastUse > records[b].lastUse;
+            });
+            for (auto slot : valid) {
+                BlockKey key = { records[slot].keyHi, records[slot].keyLo };
+                if (slots.count(key) > 0) {
+                    records[slot].state = SLOT_FREE;
+                    freeSlots.push_back(slot);
+                    continue;
+                }
+                slots[key] = slot;
+                lru.push_back(slot);
+                lruPos[static_cast<size_t>(slot)] = std::prev(lru.end());
+                tick = (std::max)(tick, records[slot].lastUse);
+            }
+        }
+
+        void drop(uint64_t slot)
+        {
+            BlockKey key = { records[slot].keyHi, records[slot].keyLo };
+            slots.erase(key);
+            lru.erase(lruPos[static_cast<size_t>(slot)]);
+            records[slot].state = SLOT_FREE;
+        }
+
+        std::mutex lock;
+        BlockFile indexFile;
+        BlockFile dataFile;
+        SlotRecord* records;
+        uint64_t slotCount;
+        uint32_t blockSize;
+        uint64_t tick;
+        bool opened;
+        std::unordered_map<BlockKey, uint64_t, BlockKeyHash> slots;
+        /* the most recently used first */
+        std::list<uint64_t> lru;
+        std::vector<std::list<uint64_t>::iterator> lruPos;
+        std::vector<uint64_t> freeSlots;
+        /* ordered, the versions of an object are next to each other */
+        std::map<std::string, ObjectEntry> objects;
+    };
+}
+}
+
+ObjectBlockCache::ObjectBlockCache(const std::string& directory, uint64_t capacityBytes, uint32_t blockSize,
+    uint32_t readaheadBlocks, int64_t freshSeconds) :
+    store_(new Store()),
+    blockSize_(blockSize),
+    readaheadBlocks_(readaheadBlocks),
+    freshSeconds_((std::max)(freshSeconds, static_cast<int64_t>(0))),
+    hits_(0),
+    misses_(0),
+    evictions_(0),
+    corruptBlocks_(0),
+    bytesFromCache_(0)
+{
+    if (!store_->open(directory, capacityBytes, blockSize)) {
+        store_.reset(new Store());
+    }
+}
+
+ObjectBlockCache::~ObjectBlockCache()
+{
+}
+
+bool ObjectBlockCache::IsOpen() const
+{
+    return store_->opened;
+}
+
+bool ObjectBlockCache::readBlock(const std::string& bucket, const std::string& key, const std::string& eTag,
+    uint64_t index, std::string& data)
+{
+    if (!IsOpen()) {
+        return false;
+    }
+    auto blockKey = MakeBlockKey(bucket, key, eTag, index);
+    uint64_t slot;
+    uint64_t crc;
+    uint32_t length;
+    {
+        std::lock_guard<std::mutex> lck(store_->lock);
+        auto it = store_->slots.find(blockKey);
+        if (it == store_->slots.end()) {
+            misses_++;
+            return false;
+        }
+        slot = it->second;
+        auto& lru = store_->lru;
+        lru.splice(lru.begin(), lru, store_->lruPos[static_cast<size_t>(slot)]);
+        store_->records[slot].lastUse = ++store_->tick;
+        crc = store_->records[slot].crc;
+        length = store_->records[slot].length;
+    }
+
+    /* read without the lock, a slot reused meanwhile fails the crc64 */
+    data.resize(length);
+    bool ok = length == 0 || store_->dataFile.read(slot * blockSize_, &data[0], length);
+    if (!ok || CRC64::CalcCRC(0, &data[0], length) != crc) {
+        std::lock_guard<std::mutex> lck(store_->lock);
+        auto it = store_->slots.find(blockKey);
+        if (it != store_->slots.end() && it->second == slot && store_->records[slot].crc == crc) {
+            store_->drop(slot);
+            store_->freeSlots.push_back(slot);
+            corruptBlocks_++;
+        }
+        misses_++;
+        return false;
+    }
+    hits_++;
+    bytesFromCache_ += length;
+    return true;
+}
+
+void ObjectBlockCache::writeBlock(const std::string& bucket, const std::string& key, const std::string& eTag,
+    uint64_t index, const char* data, size_t length)
+{
+    if (!IsOpen() || length > blockSize_) {
+        return;
+    }
+    auto blockKey = MakeBlockKey(bucket, key, eTag, index);
+    uint64_t slot;
+    {
+        std::lock_guard<std::mutex> lck(store_->lock);
+        if (store_->slots.count(blockKey) > 0) {
+            return;
+        }
+        if (!store_->freeSlots.empty()) {
+            slot = store_->freeSlots.back();
+            store_->freeSlots.pop_back();
+        }
+        else if (!store_->lru.empty()) {
+            slot = store_->lru.back();
+            store_->drop(slot);
+            evictions_++;
+        }
+        else {
+            return;
+        }
+    }
+
+    bool ok = store_->dataFile.write(slot * blockSize_, data, length);
+    auto crc = CRC64::CalcCRC(0, const_cast<char*>(data), length);
+
+    std::lock_guard<std::mutex> lck(store_->lock);
+    if (!ok || store_->slots.count(blockKey) > 0) {
+        store_->freeSlots.push_back(slot);
+        return;
+    }
+    auto& record = store_->records[slot];
+    record.keyHi = blockKey.hi;
+    record.keyLo = blockKey.lo;
+    record.crc = crc;
+    record.length = static_cast<uint32_t>(length);
+    record.lastUse = ++store_->tick;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    record.state = SLOT_VALID;
+    store_->slots[blockKey] = slot;
+    store_->lru.push_front(slot);
+    store_->lruPos[static_cast<size_t>(slot)] = store_->lru.begin();
+}
+
+bool ObjectBlockCache::findObject(const std::string& bucket, const std::string& key, const std::string& versionId, ObjectState& state)
+{
+    std::lock_guard<std::mutex> lck(store_->lock);
+    auto it = store_->objects.find(ObjectId(bucket, key) + versionId);
+    if (it == store_->objects.end()) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - it->second.validated >= std::chrono::seconds(freshSeconds_)) {
+        store_->objects.erase(it);
+        return false;
+    }
+    state = it->second.state;
+    return true;
+}
+
+void ObjectBlockCache::putObject(const std::string& bucket, const std::string& key, const std::string& versionId, const ObjectState& state)
+{
+    std::lock_guard<std::mutex> lck(store_->lock);
+    auto& objects = store_->objects;
+    if (objects.size() >= MAX_OBJECT_STATES) {
+        objects.erase(objects.begin());
+    }
+    auto& entry = objects[ObjectId(bucket, key) + versionId];
+    entry.state = state;
+    entry.validated = std::chrono::steady_clock::now();
+}
+
+void ObjectBlockCache::invalidate(const std::string& bucket, const std::string& key)
+{
+    auto objectId = ObjectId(bucket, key);
+    std::lock_guard<std::mutex> lck(store_->lock);
+    auto& objects = store_->objects;
+    auto it = objects.lower_bound(objectId);
+    while (it != objects.end() && it->first.compare(0, objectId.size(), objectId) == 0) {
+        objects.erase(it++);
+    }
+}
+
+size_t ObjectBlockCache::Blocks() const
+{
+    std::lock_guard<std::mutex> lck(store_->lock);
+    return store_->slots.size();
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ObjectContentCache.h>
+#include <alibabacloud/oss/http/HttpType.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+
+using namespace AlibabaCloud::OSS;
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    class ObjectContentCache::Shard
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        struct Node
+        {
+            std::string id;
+            std::shared_ptr<const std::string> content;
+            HeaderCollection headers;
+            std::string eTag;
+            Clock::time_point validated;
+            uint64_t cost;
+        };
+
+        explicit Shard(uint64_t capacity) : capacity(capacity), bytes(0), epoch(0) {}
+
+        void erase(std::map<std::string, std::list<Node>::iterator>::iterator it)
+        {
+            bytes -= it->second->cost;
+            lru.erase(it->second);
+            index.erase(it);
+        }
+
+        std::mutex lock;
+        /* the most recently used first */
+        std::list<Node> lru;
+        /* ordered, the entries of an object are next to each other */
+        std::map<std::string, std::list<Node>::iterator> index;
+        const uint64_t capacity;
+        uint64_t bytes;
+        /* bumped by every invalidation of the shard */
+        uint64_t epoch;
+    };
+}
+}
+
+ObjectContentCache::ObjectContentCache(uint64_t capacityBytes, int64_t freshSeconds,
+    uint64_t maxObjectBytes, size_t shardCount) :
+    freshSeconds_((std::max)(freshSeconds, static_cast<int64_t>(0))),
+    maxObjectBytes_(maxObjectBytes),
+    hits_(0),
+    misses_(0),
+    revalidations_(0),
+    hitBytes_(0),
+    evictions_(0),
+    invalidations_(0)
+{
+    shardCount = (std::max)(shardCount, static_cast<size_t>(1));
+    for (size_t i = 0; i < shardCount; i++) {
+        shards_.emplace_back(new Shard(capacityBytes / shardCount));
+    }
+}
+
+ObjectContentCache::~ObjectContentCache()
+{
+}
+
+std::string ObjectContentCache::ObjectId(const std::string& bucket, const std::string& key)
+{
+    std::string id;
+    id.reserve(bucket.size() + key.size() + 2);
+    id.append(bucket).append(1, '\0').append(key).append(1, '\0');
+    return id;
+}
+
+ObjectContentCache::Shard& ObjectContentCache::shardOf(const std::string& objectId) const
+{
+    return *shards_[std::hash<std::string>()(objectId) % shards_.size()];
+}
+
+bool ObjectContentCache::find(const std::string& bucket, const std::string& key, const std::string& variant, Entry& entry)
+{
+    auto objectId = ObjectId(bucket, key);
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    entry.epoch = shard.epoch;
+    auto it = shard.index.find(objectId + variant);
+    if (it == shard.index.end()) {
+        misses_++;
+        return false;
+    }
+    auto node = it->second;
+    bool fresh = Shard::Clock::now() - node->validated < std::chrono::seconds(freshSeconds_);
+    if (!fresh && node->eTag.empty()) {
+        shard.erase(it);
+        misses_++;
+        return false;
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, node);
+    entry.content = node->content;
+    entry.headers = node->headers;
+    entry.eTag = node->eTag;
+    entry.fresh = fresh;
+    if (fresh) {
+        hits_++;
+        hitBytes_ += node->content->size();
+    }
+    return true;
+}
+
+void ObjectContentCache::put(const std::string& bucket, const std::string& key, const std::string& variant,
+    const std::shared_ptr<const std::string>& content, const HeaderCollection& headers, uint64_t epoch)
+{
+    if (content == nullptr || content->size() > maxObjectBytes_) {
+        return;
+    }
+    auto objectId = ObjectId(bucket, key);
+    auto id = objectId + variant;
+    Shard::Node node;
+    node.cost = content->size() + id.size();
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    if (shard.epoch != epoch || node.cost > shard.capacity) {
+        return;
+    }
+    auto it = shard.index.find(id);
+    if (it != shard.index.end()) {
+        shard.erase(it);
+    }
+    while (shard.bytes + node.cost > shard.capacity && !shard.lru.empty()) {
+        shard.erase(shard.index.find(shard.lru.back().id));
+        evictions_++;
+    }
+    node.id = id;
+    node.content = content;
+    node.headers = headers;
+    auto etag = headers.find(Http::ETAG);
+    if (etag != headers.end()) {
+        node.eTag = etag->second;
+    }
+    node.validated = Shard::Clock::now();
+    shard.lru.push_front(std::move(node));
+    shard.index[id] = shard.lru.begin();
+    shard.bytes += shard.lru.front().cost;
+}
+
+void ObjectContentCache::revalidated(const std::string& bucket, const std::string& key, const std::string& variant, bool unchanged)
+{
+    if (!unchanged) {
+        misses_++;
+        return;
+    }
+    auto objectId = ObjectId(bucket, key);
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    auto it = shard.index.find(objectId + variant);
+    if (it != shard.index.end()) {
+        it->second->validated = Shard::Clock::now();
+        hitBytes_ += it->second->content->size();
+    }
+    hits_++;
+    revalidations_++;
+}
+
+void ObjectContentCache::invalidate(const std::string& bucket, const std::string& key)
+{
+    auto objectId = ObjectId(bucket, key);
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    shard.epoch++;
+    auto it = shard.index.lower_bound(objectId);
+    while (it != shard.index.end() && it->first.compare(0, objectId.size(), objectId) == 0) {
+        shard.erase(it++);
+        invalidations_++;
+    }
+}
+
+void ObjectContentCache::clear()
+{
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        shard->epoch++;
+        shard->index.clear();
+        shard->lru.clear();
+        shard->bytes = 0;
+    }
+}
+
+size_t ObjectContentCache::Size() const
+{
+    size_t size = 0;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        size += shard->index.size();
+    }
+    return size;
+}
+
+uint64_t ObjectContentCache::Bytes() const
+{
+    uint64_t bytes = 0;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        bytes += shard->bytes;
+    }
+    return bytes;
+}
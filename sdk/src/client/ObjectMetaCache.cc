@@ -0,0 +1,241 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ObjectMetaCache.h>
+#include <alibabacloud/oss/http/HttpType.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include "../utils/Utils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    struct ObjectMetaCache::Node
+    {
+        std::string id;
+        Entry entry;
+        bool complete;
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    class ObjectMetaCache::Shard
+    {
+    public:
+        explicit Shard(size_t capacity) : capacity(capacity), epoch(0) {}
+
+        void erase(std::map<std::string, std::list<Node>::iterator>::iterator it)
+        {
+            lru.erase(it->second);
+            index.erase(it);
+        }
+
+        std::mutex lock;
+        /* the most recently used first */
+        std::list<Node> lru;
+        /* ordered, the versions of an object are next to each other */
+        std::map<std::string, std::list<Node>::iterator> index;
+        const size_t capacity;
+        /* bumped by every invalidation of the shard */
+        uint64_t epoch;
+    };
+}
+}
+
+ObjectMetaCache::ObjectMetaCache(size_t maxEntries, int64_t ttlSeconds, int64_t negativeTtlSeconds, size_t shardCount) :
+    ttlSeconds_((std::max)(ttlSeconds, static_cast<int64_t>(0))),
+    negativeTtlSeconds_((std::max)(negativeTtlSeconds, static_cast<int64_t>(0))),
+    hits_(0),
+    negativeHits_(0),
+    misses_(0),
+    evictions_(0),
+    invalidations_(0)
+{
+    shardCount = (std::max)(shardCount, static_cast<size_t>(1));
+    for (size_t i = 0; i < shardCount; i++) {
+        shards_.emplace_back(new Shard((std::max)(maxEntries / shardCount, static_cast<size_t>(1))));
+    }
+}
+
+ObjectMetaCache::~ObjectMetaCache()
+{
+}
+
+std::string ObjectMetaCache::ObjectId(const std::string& bucket, const std::string& key)
+{
+    std::string id;
+    id.reserve(bucket.size() + key.size() + 2);
+    id.append(bucket).append(1, '\0').append(key).append(1, '\0');
+    return id;
+}
+
+size_t ObjectMetaCache::shardIndex(const std::string& objectId) const
+{
+    return std::hash<std::string>()(objectId) % shards_.size();
+}
+
+ObjectMetaCache::Shard& ObjectMetaCache::shardOf(const std::string& objectId) const
+{
+    return *shards_[shardIndex(objectId)];
+}
+
+uint64_t ObjectMetaCache::Epoch(const std::string& bucket, const std::string& key) const
+{
+    auto& shard = shardOf(ObjectId(bucket, key));
+    std::lock_guard<std::mutex> lck(shard.lock);
+    return shard.epoch;
+}
+
+std::vector<uint64_t> ObjectMetaCache::Epochs() const
+{
+    std::vector<uint64_t> epochs;
+    epochs.reserve(shards_.size());
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        epochs.push_back(shard->epoch);
+    }
+    return epochs;
+}
+
+uint64_t ObjectMetaCache::Epoch(const std::string& bucket, const std::string& key, const std::vector<uint64_t>& epochs) const
+{
+    auto index = shardIndex(ObjectId(bucket, key));
+    return index < epochs.size() ? epochs[index] : UINT64_MAX;
+}
+
+bool ObjectMetaCache::find(const std::string& bucket, const std::string& key, const std::string& versionId, bool complete, Entry& entry)
+{
+    auto objectId = ObjectId(bucket, key);
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    auto it = shard.index.find(objectId + versionId);
+    if (it == shard.index.end()) {
+        misses_++;
+        return false;
+    }
+    auto node = it->second;
+    if (std::chrono::steady_clock::now() >= node->expires) {
+        shard.erase(it);
+        misses_++;
+        return false;
+    }
+    if (complete && node->entry.exists && !node->complete) {
+        misses_++;
+        return false;
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, node);
+    entry = node->entry;
+    hits_++;
+    if (!entry.exists) {
+        negativeHits_++;
+    }
+    return true;
+}
+
+void ObjectMetaCache::insert(const std::string& bucket, const std::string& key, const std::string& versionId, Node&& node, uint64_t epoch)
+{
+    auto objectId = ObjectId(bucket, key);
+    node.id = objectId + versionId;
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    if (shard.epoch != epoch) {
+        return;
+    }
+    auto it = shard.index.find(node.id);
+    if (it != shard.index.end()) {
+        /* a listing does not replace the complete headers of the same content */
+        const auto& old = it->second;
+        if (old->complete && !node.complete && old->entry.exists && node.entry.exists &&
+            std::chrono::steady_clock::now() < old->expires) {
+            auto oldETag = old->entry.headers.find(Http::ETAG);
+            auto newETag = node.entry.headers.find(Http::ETAG);
+            if (oldETag != old->entry.headers.end() && newETag != node.entry.headers.end() &&
+                TrimQuotes(oldETag->second.c_str()) == TrimQuotes(newETag->second.c_str())) {
+                return;
+            }
+        }
+        shard.erase(it);
+    }
+    while (shard.lru.size() >= shard.capacity) {
+        shard.erase(shard.index.find(shard.lru.back().id));
+        evictions_++;
+    }
+    shard.lru.push_front(std::move(node));
+    shard.index[shard.lru.front().id] = shard.lru.begin();
+}
+
+void ObjectMetaCache::put(const std::string& bucket, const std::string& key, const std::string& versionId,
+    const HeaderCollection& headers, bool complete, uint64_t epoch)
+{
+    Node node;
+    node.entry.headers = headers;
+    node.entry.exists = true;
+    node.complete = complete;
+    node.expires = std::chrono::steady_clock::now() + std::chrono::seconds(ttlSeconds_);
+    insert(bucket, key, versionId, std::move(node), epoch);
+}
+
+void ObjectMetaCache::putMissing(const std::string& bucket, const std::string& key, const std::string& versionId,
+    const std::string& errorCode, const std::string& errorMessage, uint64_t epoch)
+{
+    Node node;
+    node.entry.exists = false;
+    node.entry.errorCode = errorCode;
+    node.entry.errorMessage = errorMessage;
+    node.complete = true;
+    node.expires = std::chrono::steady_clock::now() + std::chrono::seconds(negativeTtlSeconds_);
+    insert(bucket, key, versionId, std::move(node), epoch);
+}
+
+void ObjectMetaCache::invalidate(const std::string& bucket, const std::string& key)
+{
+    auto objectId = ObjectId(bucket, key);
+    auto& shard = shardOf(objectId);
+    std::lock_guard<std::mutex> lck(shard.lock);
+    shard.epoch++;
+    auto it = shard.index.lower_bound(objectId);
+    while (it != shard.index.end() && it->first.compare(0, objectId.size(), objectId) == 0) {
+        shard.erase(it++);
+        invalidations_++;
+    }
+}
+
+void ObjectMetaCache::clear()
+{
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        shard->epoch++;
+        shard->index.clear();
+        shard->lru.clear();
+    }
+}
+
+size_t ObjectMetaCache::Size() const
+{
+    size_t size = 0;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lck(shard->lock);
+        size += shard->index.size();
+    }
+    return size;
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ParallelObjectLister.h>
+#include <algorithm>
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "ParallelObjectLister";
+const size_t MAX_PAGES_PER_SHARD = 2;
+}
+
+ParallelObjectLister::ParallelObjectLister(const OssClient& client, const std::string& bucket, const std::string& prefix) :
+    client_(client),
+    bucket_(bucket),
+    prefix_(prefix),
+    delimiter_("/"),
+    concurrency_(4),
+    maxKeys_(1000),
+    ordered_(false),
+    nextShard_(0),
+    doneShards_(0),
+    readShard_(0),
+    started_(false),
+    failed_(false),
+    shutdown_(false),
+    currentPos_(0)
+{
+}
+
+ParallelObjectLister::~ParallelObjectLister()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        shutdown_ = true;
+    }
+    signal_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+bool ParallelObjectLister::next(ObjectSummary& summary)
+{
+    if (!started_) {
+        start();
+    }
+
+    while (currentPos_ >= current_.size()) {
+        if (!popPage()) {
+            return false;
+        }
+    }
+    summary = std::move(current_[currentPos_++]);
+    return true;
+}
+
+void ParallelObjectLister::start()
+{
+    started_ = true;
+    if (splitKeys_.empty()) {
+        discover();
+    }
+    else {
+        std::sort(splitKeys_.begin(), splitKeys_.end());
+        splitKeys_.erase(std::unique(splitKeys_.begin(), splitKeys_.end()), splitKeys_.end());
+        for (size_t i = 0; i <= splitKeys_.size(); i++) {
+            addShard(prefix_, i > 0 ? splitKeys_[i - 1] : "", i < splitKeys_.size() ? splitKeys_[i] : "");
+        }
+    }
+
+    if (failed_) {
+        return;
+    }
+
+    OSS_LOG(LogLevel::LogDebug, TAG, "lister(%p) start, bucket:%s, prefix:%s, shards:%d, concurrency:%d",
+        this, bucket_.c_str(), prefix_.c_str(), static_cast<int>(shards_.size()), concurrency_);
+
+    size_t count = (std::min)(shards_.size(), static_cast<size_t>(concurrency_));
+    for (size_t i = 0; i < count; i++) {
+        workers_.push_back(std::thread(&ParallelObjectLister::workLoop, this));
+    }
+}
+
+void ParallelObjectLister::discover()
+{
+    ListObjectsV2Request request(bucket_);
+    request.setPrefix(prefix_);
+    request.setDelimiter(delimiter_);
+    request.setMaxKeys(maxKeys_);
+
+    while (true) {
+        auto outcome = client_.ListObjectsV2(request);
+        if (!outcome.isSuccess()) {
+            setFailed(outcome.error());
+            return;
+        }
+
+        //both lists are sorted, merge them to keep the shards in key order
+        const auto& summaries = outcome.result().ObjectSummarys();
+        const auto& prefixes = outcome.result().CommonPrefixes();
+        size_t i = 0, j = 0;
+        while (i < summaries.size() || j < prefixes.size()) {
+            if (j >= prefixes.size() || (i < summaries.size() && summaries[i].Key() < prefixes[j])) {
+                addListedShard(summaries[i++]);
+            }
+            else {
+                addShard(prefixes[j++], "", "");
+            }
+        }
+
+        if (!outcome.result().IsTruncated()) {
+            break;
+        }
+        request.setContinuationToken(outcome.result().NextContinuationToken());
+    }
+}
+
+void ParallelObjectLister::addListedShard(const ObjectSummary& summary)
+{
+    if (shards_.empty() || !shards_.back().preListed) {
+        addShard("", "", "");
+        shards_.back().preListed = true;
+    }
+    shards_.back().listed.push_back(summary);
+}
+
+void ParallelObjectLister::addShard(const std::string& prefix, const std::string& startAfter, const std::string& endKey)
+{
+    Shard shard;
+    shard.prefix = prefix;
+    shard.startAfter = startAfter;
+    shard.endKey = endKey;
+    shard.preListed = false;
+    shard.done = false;
+    shards_.push_back(std::move(shard));
+}
+
+void ParallelObjectLister::workLoop()
+{
+    while (true) {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lck(lock_);
+            //shards are taken in key order, so in ordered mode the shard being read is always in progress
+            if (shutdown_ || failed_ || nextShard_ >= shards_.size()) {
+                break;
+            }
+            index = nextShard_++;
+        }
+        listShard(index);
+    }
+}
+
+void ParallelObjectLister::listShard(size_t index)
+{
+    Shard& shard = shards_[index];
+    if (shard.preListed) {
+        if (!pushPage(index, std::move(shard.listed))) {
+            return;
+        }
+    }
+    else {
+        ListObjectsV2Request request(bucket_);
+        request.setPrefix(shard.prefix);
+        request.setMaxKeys(maxKeys_);
+        if (!shard.startAfter.empty()) {
+            request.setStartAfter(shard.startAfter);
+        }
+
+        bool more = true;
+        while (more) {
+            auto outcome = client_.ListObjectsV2(request);
+            if (!outcome.isSuccess()) {
+                setFailed(outcome.error());
+                return;
+            }
+
+            ObjectSummaryList page = outcome.result().ObjectSummarys();
+            more = outcome.result().IsTruncated();
+            if (!shard.endKey.empty()) {
+                auto it = std::find_if(page.begin(), page.end(),
+                    [&shard](const ObjectSummary& summary) { return summary.Key() > shard.endKey; });
+                if (it != page.end()) {
+                    page.erase(it, page.end());
+                    more = false;
+                }
+            }
+            if (more) {
+                request.setContinuationToken(outcome.result().NextContinuationToken());
+            }
+            if (!page.empty() && !pushPage(index, std::move(page))) {
+                return;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        shard.done = true;
+        doneShards_++;
+    }
+    signal_.notify_all();
+}
+
+bool ParallelObjectLister::pushPage(size_t index, ObjectSummaryList&& page)
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    signal_.wait(lck, [this, index]() {
+        return shutdown_ || failed_ ||
+            (ordered_ ? shards_[index].pages.size() < MAX_PAGES_PER_SHARD :
+                ready_.size() < MAX_PAGES_PER_SHARD * concurrency_);
+    });
+    if (shutdown_ || failed_) {
+        return false;
+    }
+
+    if (ordered_) {
+        shards_[index].pages.push_back(std::move(page));
+    }
+    else {
+        ready_.push_back(std::move(page));
+    }
+    lck.unlock();
+    signal_.notify_all();
+    return true;
+}
+
+bool ParallelObjectLister::popPage()
+{
+    std::unique_lock<std::mutex> lck(lock_);
+    current_.clear();
+    currentPos_ = 0;
+    if (ordered_) {
+        while (readShard_ < shards_.size()) {
+            auto& shard = shards_[readShard_];
+            signal_.wait(lck, [this, &shard]() { return failed_ || !shard.pages.empty() || shard.done; });
+            if (failed_) {
+                return false;
+            }
+            if (!shard.pages.empty()) {
+                current_ = std::move(shard.pages.front());
+                shard.pages.pop_front();
+                break;
+            }
+            readShard_++;
+        }
+        if (readShard_ >= shards_.size()) {
+            return false;
+        }
+    }
+    else {
+        signal_.wait(lck, [this]() { return failed_ || !ready_.empty() || doneShards_ >= shards_.size(); });
+        if (failed_ || ready_.empty()) {
+            return false;
+        }
+        current_ = std::move(ready_.front());
+        ready_.pop_front();
+    }
+    lck.unlock();
+    signal_.notify_all();
+    return true;
+}
+
+void ParallelObjectLister::setFailed(const OssError& error)
+{
+    OSS_LOG(LogLevel::LogError, TAG, "lister(%p) list fail, code:%s, message:%s",
+        this, error.Code().c_str(), error.Message().c_str());
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        if (!failed_) {
+            error_ = error;
+            failed_ = true;
+        }
+    }
+    signal_.notify_all();
+}
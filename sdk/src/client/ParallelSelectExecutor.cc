@@ -0,0 +1,252 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/ParallelSelectExecutor.h>
+#include <thread>
+#include "../utils/Crc64.h"
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "ParallelSelectExecutor";
+const int RANGES_PER_REQUEST = 4;
+}
+
+ParallelSelectExecutor::ParallelSelectExecutor(const OssClient& client, const std::string& bucket,
+    const std::string& key, const std::string& expression,
+    const CSVInputFormat& inputFormat, const CSVOutputFormat& outputFormat) :
+    client_(client),
+    bucket_(bucket),
+    key_(key),
+    expression_(expression),
+    makeInput_([inputFormat]() { return std::make_shared<CSVInputFormat>(inputFormat); }),
+    outputFormat_(std::make_shared<CSVOutputFormat>(outputFormat)),
+    concurrency_(4),
+    rangeCount_(0),
+    ordered_(true),
+    requestPayer_(RequestPayer::NotSet),
+    splitsCount_(0),
+    nextRange_(0),
+    current_(0),
+    failed_(false)
+{
+    outputFormat_->setEnablePayloadCrc(true);
+}
+
+ParallelSelectExecutor::ParallelSelectExecutor(const OssClient& client, const std::string& bucket,
+    const std::string& key, const std::string& expression,
+    const JSONInputFormat& inputFormat, const JSONOutputFormat& outputFormat) :
+    client_(client),
+    bucket_(bucket),
+    key_(key),
+    expression_(expression),
+    makeInput_([inputFormat]() { return std::make_shared<JSONInputFormat>(inputFormat); }),
+    outputFormat_(std::make_shared<JSONOutputFormat>(outputFormat)),
+    concurrency_(4),
+    rangeCount_(0),
+    ordered_(true),
+    requestPayer_(RequestPayer::NotSet),
+    splitsCount_(0),
+    nextRange_(0),
+    current_(0),
+    failed_(false)
+{
+    outputFormat_->setEnablePayloadCrc(true);
+}
+
+bool ParallelSelectExecutor::execute()
+{
+    ranges_.clear();
+    outputs_.clear();
+    nextRange_ = 0;
+    current_ = 0;
+    failed_ = false;
+    error_ = OssError();
+
+    if (!fetchMeta()) {
+        return false;
+    }
+
+    //splits [0, splitsCount_) are divided into ranges of nearly the same number of splits
+    int64_t splits = splitsCount_;
+    int64_t count = rangeCount_ > 0 ? rangeCount_ : static_cast<int64_t>(concurrency_) * RANGES_PER_REQUEST;
+    count = (std::max)(static_cast<int64_t>(1), (std::min)(count, splits));
+    int64_t start = 0;
+    for (int64_t i = 0; i < count; i++) {
+        int64_t end = start + splits / count + (i < splits % count ? 1 : 0);
+        ranges_.push_back(SelectRangeResult(start, end - 1));
+        outputs_.push_back(RangeOutput{ std::string(), 0, false });
+        start = end;
+    }
+
+    std::vector<std::thread> workers;
+    size_t workerCount = (std::min)(ranges_.size(), static_cast<size_t>(concurrency_));
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.push_back(std::thread(&ParallelSelectExecutor::workLoop, this));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return !failed_;
+}
+
+uint64_t ParallelSelectExecutor::RecordCount() const
+{
+    uint64_t count = 0;
+    for (const auto& range : ranges_) {
+        count += range.RecordCount();
+    }
+    return count;
+}
+
+uint64_t ParallelSelectExecutor::ScannedBytes() const
+{
+    uint64_t bytes = 0;
+    for (const auto& range : ranges_) {
+        bytes += range.ScannedBytes();
+    }
+    return bytes;
+}
+
+bool ParallelSelectExecutor::fetchMeta()
+{
+    auto inputFormat = makeInput_();
+    CreateSelectObjectMetaRequest request(bucket_, key_);
+    request.setInputFormat(*inputFormat);
+    request.setRequestPayer(requestPayer_);
+    auto outcome = client_.CreateSelectObjectMeta(request);
+    if (!outcome.isSuccess()) {
+        setFailed(outcome.error());
+        return false;
+    }
+    if (outcome.result().Status() / 100 != 2) {
+        setFailed(OssError("SelectObjectMetaError", outcome.result().ErrorMessage()));
+        return false;
+    }
+    splitsCount_ = outcome.result().SplitsCount();
+    if (splitsCount_ == 0) {
+        setFailed(OssError("SelectObjectMetaError", "The object has no splits."));
+        return false;
+    }
+    return true;
+}
+
+void ParallelSelectExecutor::workLoop()
+{
+    while (true) {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lck(lock_);
+            //ranges are taken in order, so the front range of ordered mode is always running
+            if (failed_ || nextRange_ >= ranges_.size()) {
+                return;
+            }
+            index = nextRange_++;
+        }
+        if (!selectRange(index)) {
+            return;
+        }
+        complete(index);
+    }
+}
+
+bool ParallelSelectExecutor::selectRange(size_t index)
+{
+    auto inputFormat = makeInput_();
+    inputFormat->setSplitRange(ranges_[index].SplitStart(), ranges_[index].SplitEnd());
+
+    SelectObjectRequest request(bucket_, key_);
+    request.setExpression(expression_);
+    request.setInputFormat(*inputFormat);
+    request.setOutputFormat(*outputFormat_);
+    request.setRequestPayer(requestPayer_);
+    //a retried attempt skips the records delivered before, so these cover the output once
+    uint64_t crc64 = 0;
+    uint64_t size = 0;
+    request.setRecordHandler([this, index, &crc64, &size](const char* data, size_t len, size_t records) {
+        crc64 = CRC64::CalcCRC(crc64, const_cast<char*>(data), len);
+        size += len;
+        deliver(index, data, len, records);
+    });
+
+    auto outcome = client_.SelectObject(request);
+    if (!outcome.isSuccess()) {
+        OSS_LOG(LogLevel::LogError, TAG, "executor(%p) range [%lld, %lld] fail, code:%s",
+            this, static_cast<long long>(ranges_[index].SplitStart()),
+            static_cast<long long>(ranges_[index].SplitEnd()), outcome.error().Code().c_str());
+        setFailed(outcome.error());
+        return false;
+    }
+    const auto& endFrame = request.EndFrame();
+    if (!endFrame.Received() || endFrame.Status() / 100 != 2) {
+        setFailed(OssError("SelectObjectError", endFrame.Received() ? endFrame.ErrorMessage() :
+            "The end frame of the select response is missing."));
+        return false;
+    }
+    std::lock_guard<std::mutex> lck(lock_);
+    auto& range = ranges_[index];
+    range.recordCount_ = request.RecordCount();
+    range.size_ = size;
+    range.crc64_ = crc64;
+    range.scannedBytes_ = endFrame.ScannedBytes();
+    range.done_ = true;
+    return true;
+}
+
+void ParallelSelectExecutor::deliver(size_t index, const char* data, size_t size, size_t records)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (!ordered_ || index == current_) {
+        if (handler_) {
+            handler_(data, size, records);
+        }
+        return;
+    }
+    outputs_[index].buffer.append(data, size);
+    outputs_[index].records += records;
+}
+
+void ParallelSelectExecutor::complete(size_t index)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    outputs_[index].done = true;
+    if (!ordered_ || failed_) {
+        return;
+    }
+    //hand over to the next range, with the output it kept so far
+    while (current_ < outputs_.size() && outputs_[current_].done) {
+        current_++;
+        if (current_ < outputs_.size()) {
+            auto& output = outputs_[current_];
+            if (!output.buffer.empty() && handler_) {
+                handler_(output.buffer.data(), output.buffer.size(), output.records);
+            }
+            std::string().swap(output.buffer);
+            output.records = 0;
+        }
+    }
+}
+
+void ParallelSelectExecutor::setFailed(const OssError& error)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (!failed_) {
+        failed_ = true;
+        error_ = error;
+    }
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/client/VectoredObjectReader.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include "../utils/LogUtils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char *TAG = "VectoredObjectReader";
+const int64_t DEFAULT_MAX_MERGE_GAP = 64 * 1024;
+const int64_t DEFAULT_MAX_REQUEST_SIZE = 8 * 1024 * 1024;
+
+/* the part of a range within a merged request, offsets are from the start of the request */
+struct ScatterTarget
+{
+    int64_t begin;
+    int64_t end;
+    char* buffer;
+    size_t range;
+};
+
+/* writes the body of a merged request into the buffers of its ranges, the bytes of the gaps are dropped */
+class ScatterStreamBuf : public std::streambuf
+{
+public:
+    explicit ScatterStreamBuf(const std::vector<ScatterTarget>& targets) :
+        targets_(targets), first_(0), pos_(0) {}
+    int64_t Position() const { return pos_; }
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        int64_t begin = pos_;
+        int64_t end = pos_ + n;
+        //targets are sorted by begin, the ones before first_ are complete
+        while (first_ < targets_.size() && targets_[first_].end <= begin) {
+            first_++;
+        }
+        for (size_t i = first_; i < targets_.size() && targets_[i].begin < end; i++) {
+            const auto& target = targets_[i];
+            int64_t from = (std::max)(begin, target.begin);
+            int64_t to = (std::min)(end, target.end);
+            if (from < to) {
+                std::memcpy(target.buffer + (from - target.begin), s + (from - begin), static_cast<size_t>(to - from));
+            }
+        }
+        pos_ = end;
+        return n;
+    }
+    int_type overflow(int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        if (dir == std::ios_base::cur) {
+            off += static_cast<off_type>(pos_);
+        }
+        else if (dir != std::ios_base::beg) {
+            return pos_type(off_type(-1));
+        }
+        return seekpos(pos_type(off), which);
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        off_type off = static_cast<off_type>(pos);
+        if (!(which & std::ios_base::out) || off < 0) {
+            return pos_type(off_type(-1));
+        }
+        //the http client rewinds the body to retry a broken transfer
+        pos_ = static_cast<int64_t>(off);
+        first_ = 0;
+        return pos;
+    }
+
+private:
+    const std::vector<ScatterTarget>& targets_;
+    size_t first_;
+    int64_t pos_;
+};
+
+class ScatterStream : public std::iostream
+{
+public:
+    explicit ScatterStream(const std::vector<ScatterTarget>& targets) :
+        std::iostream(nullptr),
+        buf_(targets)
+    {
+        rdbuf(&buf_);
+    }
+    int64_t Position() const { return buf_.Position(); }
+
+private:
+    ScatterStreamBuf buf_;
+};
+}
+
+VectoredObjectReader::VectoredObjectReader(const OssClient& client, const std::string& bucket, const std::string& key) :
+    client_(client),
+    bucket_(bucket),
+    key_(key),
+    concurrency_(4),
+    maxMergeGap_(DEFAULT_MAX_MERGE_GAP),
+    maxRequestSize_(DEFAULT_MAX_REQUEST_SIZE),
+    requestPayer_(RequestPayer::NotSet),
+    nextRequest_(0),
+    failed_(false)
+{
+}
+
+void VectoredObjectReader::setMaxRequestSize(int64_t value)
+{
+    maxRequestSize_ = value > 0 ? value : DEFAULT_MAX_REQUEST_SIZE;
+}
+
+bool VectoredObjectReader::read(ReadRangeList& ranges)
+{
+    requests_.clear();
+    nextRequest_ = 0;
+    failed_ = false;
+    error_ = OssError();
+
+    for (auto& range : ranges) {
+        if (range.Offset() < 0 || range.Length() < 0 || (range.Length() > 0 && range.Buffer() == nullptr)) {
+            setFailed(OssError("ValidateError", "The offset or the length of a range is negative, or its buffer is null."));
+            return false;
+        }
+        range.bytesRead_ = 0;
+    }
+
+    plan(ranges);
+    size_t workerCount = (std::min)(requests_.size(), static_cast<size_t>(concurrency_));
+    if (workerCount <= 1) {
+        workLoop(ranges);
+        return !failed_;
+    }
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.push_back(std::thread(&VectoredObjectReader::workLoop, this, std::ref(ranges)));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return !failed_;
+}
+
+int64_t VectoredObjectReader::RequestedBytes() const
+{
+    int64_t bytes = 0;
+    for (const auto& request : requests_) {
+        bytes += request.end - request.start;
+    }
+    return bytes;
+}
+
+void VectoredObjectReader::plan(const ReadRangeList& ranges)
+{
+    std::vector<size_t> order;
+    for (size_t i = 0; i < ranges.size(); i++) {
+        if (ranges[i].Length() > 0) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&ranges](size_t a, size_t b) {
+        return ranges[a].Offset() < ranges[b].Offset() ||
+            (ranges[a].Offset() == ranges[b].Offset() && ranges[a].Length() < ranges[b].Length());
+    });
+
+    std::vector<MergedRequest> spans;
+    for (auto index : order) {
+        int64_t start = ranges[index].Offset();
+        int64_t end = start + ranges[index].Length();
+        if (!spans.empty() && maxMergeGap_ >= 0) {
+            //overlapping ranges cost no extra bytes, a gap is read only within the max request size
+            auto& last = spans.back();
+            int64_t mergedEnd = (std::max)(last.end, end);
+            if (start <= last.end ||
+                (start - last.end <= maxMergeGap_ && mergedEnd - last.start <= maxRequestSize_)) {
+                last.end = mergedEnd;
+                last.ranges.push_back(index);
+                continue;
+            }
+        }
+        spans.push_back(MergedRequest{ start, end, std::vector<size_t>(1, index) });
+    }
+
+    //a span larger than the max request size is read as pieces of nearly the same size
+    for (auto& span : spans) {
+        int64_t size = span.end - span.start;
+        int64_t pieces = (size + maxRequestSize_ - 1) / maxRequestSize_;
+        if (pieces <= 1) {
+            requests_.push_back(std::move(span));
+            continue;
+        }
+        for (int64_t i = 0; i < pieces; i++) {
+            MergedRequest piece{ span.start + size * i / pieces, span.start + size * (i + 1) / pieces, std::vector<size_t>() };
+            for (auto index : span.ranges) {
+                if (ranges[index].Offset() < piece.end && ranges[index].Offset() + ranges[index].Length() > piece.start) {
+                    piece.ranges.push_back(index);
+                }
+            }
+            requests_.push_back(std::move(piece));
+        }
+    }
+}
+
+void VectoredObjectReader::workLoop(ReadRangeList& ranges)
+{
+    while (true) {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lck(lock_);
+            if (failed_ || nextRequest_ >= requests_.size()) {
+                return;
+            }
+            index = nextRequest_++;
+        }
+        if (!readRequest(requests_[index], ranges)) {
+            return;
+        }
+    }
+}
+
+bool VectoredObjectReader::readRequest(const MergedRequest& merged, ReadRangeList& ranges)
+{
+    std::vector<ScatterTarget> targets;
+    for (auto index : merged.ranges) {
+        const auto& range = ranges[index];
+        int64_t from = (std::max)(range.Offset(), merged.start);
+        int64_t to = (std::min)(range.Offset() + range.Length(), merged.end);
+        targets.push_back(ScatterTarget{ from - merged.start, to - merged.start,
+            range.Buffer() + (from - range.Offset()), index });
+    }
+
+    GetObjectRequest request(bucket_, key_);
+    request.setRange(merged.start, merged.end - 1, true);
+    if (!versionId_.empty()) {
+        request.setVersionId(versionId_);
+    }
+    if (!eTag_.empty()) {
+        request.addMatchingETagConstraint(eTag_);
+    }
+    request.setRequestPayer(requestPayer_);
+    /* each attempt gets a new stream, the response holds the last one */
+    std::shared_ptr<ScatterStream> stream;
+    request.setResponseStreamFactory([&targets, &stream]() {
+        stream = std::make_shared<ScatterStream>(targets);
+        return stream; });
+
+    auto outcome = client_.GetObject(request);
+    if (!outcome.isSuccess()) {
+        OSS_LOG(LogLevel::LogError, TAG, "reader(%p) range [%lld, %lld) fail, code:%s",
+            this, static_cast<long long>(merged.start), static_cast<long long>(merged.end),
+            outcome.error().Code().c_str());
+        setFailed(outcome.error());
+        return false;
+    }
+    bool scattered = stream != nullptr && outcome.result().Content() == stream;
+    int64_t received = scattered ? stream->Position() : 0;
+    if (!scattered || received > merged.end - merged.start) {
+        setFailed(OssError("ValidateError", "The response of a ranged read does not match the range."));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lck(lock_);
+    for (const auto& target : targets) {
+        ranges[target.range].bytesRead_ += (std::max)(static_cast<int64_t>(0), (std::min)(target.end, received) - target.begin);
+    }
+    return true;
+}
+
+void VectoredObjectReader::setFailed(const OssError& error)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (!failed_) {
+        failed_ = true;
+        error_ = error;
+    }
+}
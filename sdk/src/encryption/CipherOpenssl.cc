@@ -15,6 +15,7 @@
  */
 
 #include "CipherOpenssl.h"
+#include "../utils/CpuAccounting.h"
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <openssl/engine.h>
@@ -62,6 +63,7 @@ void SymmetricCipherOpenssl::EncryptInit(const ByteBuffer& key, const ByteBuffer
 
 ByteBuffer SymmetricCipherOpenssl::Encrypt(const ByteBuffer& data)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
     if (data.empty()) {
         return ByteBuffer();
     }
@@ -78,6 +80,7 @@ ByteBuffer SymmetricCipherOpenssl::Encrypt(const ByteBuffer& data)
 
 int SymmetricCipherOpenssl::Encrypt(unsigned char* dst, int dstLen, const unsigned char* src, int srcLen)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
     if (!dst || !src) {
         return -1;
     }
@@ -112,6 +115,7 @@ void SymmetricCipherOpenssl::DecryptInit(const ByteBuffer& key, const ByteBuffer
 
 ByteBuffer SymmetricCipherOpenssl::Decrypt(const ByteBuffer& data)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
     if (data.empty()) {
         return ByteBuffer();
     }
@@ -128,6 +132,7 @@ ByteBuffer SymmetricCipherOpenssl::Decrypt(const ByteBuffer& data)
 
 int SymmetricCipherOpenssl::Decrypt(unsigned char * dst, int dstLen, const unsigned char* src, int srcLen)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
     if (!dst || !src) {
         return -1;
     }
@@ -163,6 +168,7 @@ AsymmetricCipherOpenssl::~AsymmetricCipherOpenssl()
 
 ByteBuffer AsymmetricCipherOpenssl::Encrypt(const ByteBuffer& data)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
 #if defined(OPENSSL_API_LEVEL) && OPENSSL_API_LEVEL >= 30000
     BIO* bio = NULL;
     OSSL_DECODER_CTX* dctx = NULL;
@@ -284,6 +290,7 @@ ByteBuffer AsymmetricCipherOpenssl::Encrypt(const ByteBuffer& data)
 
 ByteBuffer AsymmetricCipherOpenssl::Decrypt(const ByteBuffer& data)
 {
+    CpuStageScope encryptionStage(CpuStage::Encryption);
 #if defined(OPENSSL_API_LEVEL) && OPENSSL_API_LEVEL >= 30000
     BIO* bio = NULL;
     EVP_PKEY* pkey = NULL;
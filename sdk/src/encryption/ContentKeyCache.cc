@@ -0,0 +1,166 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ContentKeyCache.h"
+#include "../utils/Utils.h"
+
+using namespace AlibabaCloud::OSS;
+
+std::shared_ptr<ContentKeyCache> ContentKeyCache::CreateContentKeyCache(const CryptoConfiguration& cryptoConfig)
+{
+    if (cryptoConfig.cekReuseMaxObjects == 0 && cryptoConfig.cekCacheMaxEntries == 0) {
+        return nullptr;
+    }
+    return std::make_shared<ContentKeyCache>(cryptoConfig.cekReuseMaxObjects, cryptoConfig.cekReuseMaxSeconds,
+        cryptoConfig.cekCacheMaxEntries, cryptoConfig.cekCacheMaxSeconds);
+}
+
+ContentKeyCache::ContentKeyCache(uint32_t reuseMaxObjects, int64_t reuseMaxSeconds,
+    uint32_t cacheMaxEntries, int64_t cacheMaxSeconds) :
+    reuseMaxObjects_(reuseMaxObjects),
+    reuseMaxAge_(std::chrono::seconds(reuseMaxSeconds > 0 ? reuseMaxSeconds : 0)),
+    cacheMaxEntries_(cacheMaxEntries),
+    cacheMaxAge_(std::chrono::seconds(cacheMaxSeconds > 0 ? cacheMaxSeconds : 0))
+{
+}
+
+ContentKeyCache::~ContentKeyCache()
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    dropDataKey();
+    for (auto& item : lruList_) {
+        SecureZero(item.key);
+    }
+}
+
+void ContentKeyCache::SecureZero(ByteBuffer& buffer)
+{
+    //writes through a volatile pointer are not removed as dead stores
+    volatile unsigned char* p = buffer.data();
+    for (size_t i = 0; i < buffer.size(); i++) {
+        p[i] = 0;
+    }
+    buffer.clear();
+}
+
+std::string ContentKeyCache::KeyId(const ContentCryptoMaterial& material)
+{
+    //the description selects the key pair which unwraps the key
+    std::string id = material.KeyWrapAlgorithm();
+    id.append("\n").append(MapToJsonString(material.Description())).append("\n");
+    id.append(reinterpret_cast<const char*>(material.EncryptedContentKey().data()), material.EncryptedContentKey().size());
+    return id;
+}
+
+bool ContentKeyCache::acquireDataKey(ContentCryptoMaterial& material)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (!dataKey_) {
+        return false;
+    }
+    if (dataKey_->uses >= reuseMaxObjects_ || Clock::now() - dataKey_->created >= reuseMaxAge_) {
+        dropDataKey();
+        return false;
+    }
+    dataKey_->uses++;
+    material.setContentKey(dataKey_->key);
+    material.setEncryptedContentKey(dataKey_->encryptedKey);
+    material.setKeyWrapAlgorithm(dataKey_->wrapAlgorithm);
+    material.setDescription(dataKey_->description);
+    return true;
+}
+
+void ContentKeyCache::putDataKey(const ContentCryptoMaterial& material)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (reuseMaxObjects_ <= 1 || reuseMaxAge_ == Clock::duration::zero()) {
+        return;
+    }
+    dropDataKey();
+    dataKey_.reset(new DataKey());
+    dataKey_->key = material.ContentKey();
+    dataKey_->encryptedKey = material.EncryptedContentKey();
+    dataKey_->wrapAlgorithm = material.KeyWrapAlgorithm();
+    dataKey_->description = material.Description();
+    dataKey_->uses = 1;
+    dataKey_->created = Clock::now();
+}
+
+void ContentKeyCache::invalidateDataKey()
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    dropDataKey();
+}
+
+bool ContentKeyCache::findContentKey(ContentCryptoMaterial& material)
+{
+    if (cacheMaxEntries_ == 0 || material.EncryptedContentKey().empty()) {
+        return false;
+    }
+    auto id = KeyId(material);
+    std::lock_guard<std::mutex> lck(lock_);
+    auto found = keys_.find(id);
+    if (found == keys_.end()) {
+        return false;
+    }
+    if (Clock::now() - found->second->created >= cacheMaxAge_) {
+        evict(found->second);
+        return false;
+    }
+    lruList_.splice(lruList_.begin(), lruList_, found->second);
+    material.setContentKey(found->second->key);
+    return true;
+}
+
+void ContentKeyCache::putContentKey(const ContentCryptoMaterial& material)
+{
+    if (cacheMaxEntries_ == 0 || cacheMaxAge_ == Clock::duration::zero() ||
+        material.EncryptedContentKey().empty() || material.ContentKey().empty()) {
+        return;
+    }
+    auto id = KeyId(material);
+    std::lock_guard<std::mutex> lck(lock_);
+    auto found = keys_.find(id);
+    if (found != keys_.end()) {
+        evict(found->second);
+    }
+    while (lruList_.size() >= cacheMaxEntries_) {
+        evict(std::prev(lruList_.end()));
+    }
+    lruList_.push_front(CachedKey{ id, material.ContentKey(), Clock::now() });
+    keys_[id] = lruList_.begin();
+}
+
+size_t ContentKeyCache::Size() const
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    return lruList_.size();
+}
+
+void ContentKeyCache::dropDataKey()
+{
+    if (dataKey_) {
+        SecureZero(dataKey_->key);
+        dataKey_ = nullptr;
+    }
+}
+
+void ContentKeyCache::evict(std::list<CachedKey>::iterator it)
+{
+    SecureZero(it->key);
+    keys_.erase(it->id);
+    lruList_.erase(it);
+}
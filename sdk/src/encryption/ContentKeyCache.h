@@ -0,0 +1,91 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/encryption/CryptoConfiguration.h>
+#include <alibabacloud/oss/encryption/ContentCryptoMaterial.h>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * Content key reuse for OssEncryptionClient. On writes a wrapped content key is handed
+    * out for a bounded number of objects and time, the caller gives every object a fresh iv.
+    * On reads unwrapped content keys are kept by their wrapped bytes in a bounded lru list.
+    * The keys held by the cache are zeroed when they are dropped.
+    */
+    class ContentKeyCache
+    {
+    public:
+        /* nullptr when the configuration disables both sides */
+        static std::shared_ptr<ContentKeyCache> CreateContentKeyCache(const CryptoConfiguration& cryptoConfig);
+
+        ContentKeyCache(uint32_t reuseMaxObjects, int64_t reuseMaxSeconds, uint32_t cacheMaxEntries, int64_t cacheMaxSeconds);
+        ~ContentKeyCache();
+
+        /* fills the content key, wrapped key, wrap algorithm and description, false when a new key is needed */
+        bool acquireDataKey(ContentCryptoMaterial& material);
+        /* the material of a new wrapped content key, for the next objects */
+        void putDataKey(const ContentCryptoMaterial& material);
+        /* fills the content key of a material read from the object meta */
+        bool findContentKey(ContentCryptoMaterial& material);
+        void putContentKey(const ContentCryptoMaterial& material);
+        /* drops the data key, it is not handed out again */
+        void invalidateDataKey();
+
+        size_t Size() const;
+
+        static void SecureZero(ByteBuffer& buffer);
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        struct DataKey
+        {
+            ByteBuffer key;
+            ByteBuffer encryptedKey;
+            std::string wrapAlgorithm;
+            std::map<std::string, std::string> description;
+            uint32_t uses;
+            Clock::time_point created;
+        };
+        struct CachedKey
+        {
+            std::string id;
+            ByteBuffer key;
+            Clock::time_point created;
+        };
+        static std::string KeyId(const ContentCryptoMaterial& material);
+        void dropDataKey();
+        void evict(std::list<CachedKey>::iterator it);
+
+        const uint32_t reuseMaxObjects_;
+        const Clock::duration reuseMaxAge_;
+        const uint32_t cacheMaxEntries_;
+        const Clock::duration cacheMaxAge_;
+
+        mutable std::mutex lock_;
+        std::unique_ptr<DataKey> dataKey_;
+        std::list<CachedKey> lruList_;
+        std::unordered_map<std::string, std::list<CachedKey>::iterator> keys_;
+    };
+}
+}
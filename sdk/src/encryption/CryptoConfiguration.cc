@@ -19,7 +19,11 @@ using namespace AlibabaCloud::OSS;
 
 CryptoConfiguration::CryptoConfiguration():
     cryptoMode(CryptoMode::ENCRYPTION_AESCTR),
-    cryptoStorageMethod(CryptoStorageMethod::METADATA)
+    cryptoStorageMethod(CryptoStorageMethod::METADATA),
+    cekReuseMaxObjects(0),
+    cekReuseMaxSeconds(300),
+    cekCacheMaxEntries(0),
+    cekCacheMaxSeconds(300)
 {
 }
 
@@ -39,18 +39,20 @@ static std::string getUserAgent(const std::string& prefix)
 }
 
 std::shared_ptr<CryptoModule> CryptoModule::CreateCryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials,
-    const CryptoConfiguration& cryptoConfig)
+    const CryptoConfiguration& cryptoConfig, const std::shared_ptr<ContentKeyCache>& keyCache)
 {
     switch(cryptoConfig.cryptoMode) {
     case CryptoMode::ENCRYPTION_AESCTR:
     default:
-        return std::make_shared<CryptoModuleAESCTR>(encryptionMaterials, cryptoConfig);
+        return std::make_shared<CryptoModuleAESCTR>(encryptionMaterials, cryptoConfig, keyCache);
     };
 }
 
-CryptoModule::CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig):
+CryptoModule::CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig,
+    const std::shared_ptr<ContentKeyCache>& keyCache):
     encryptionMaterials_(encryptionMaterials),
-    cryptoConfig_(cryptoConfig)
+    cryptoConfig_(cryptoConfig),
+    keyCache_(keyCache)
 {
 }
 
@@ -64,8 +66,7 @@ PutObjectOutcome CryptoModule::PutObjectSecurely(const std::shared_ptr<OssClient
     ContentCryptoMaterial material;
 
     initEncryptionCipher(material);
-    generateKeyIV(material);
-    auto ret = encryptionMaterials_->EncryptCEK(material);
+    auto ret = encryptContentKey(material);
     CHECK_FUNC_RET(PutObjectOutcome, EncryptCEK, ret);
     addMetaData(material, putRequest.MetaData());
     addUserAgent(putRequest.MetaData(), client->configuration().userAgent);
@@ -90,7 +91,7 @@ GetObjectOutcome CryptoModule::GetObjectSecurely(const std::shared_ptr<OssClient
         return GetObjectOutcome(OssError("EncryptionClientError", ss.str()));
     }
 
-    auto ret = encryptionMaterials_->DecryptCEK(material);
+    auto ret = decryptContentKey(material);
     CHECK_FUNC_RET(GetObjectOutcome, DecryptCEK, ret);
 
     //range
@@ -144,8 +145,7 @@ InitiateMultipartUploadOutcome CryptoModule::InitiateMultipartUploadSecurely(con
     ContentCryptoMaterial material;
 
     initEncryptionCipher(material);
-    generateKeyIV(material);
-    auto ret = encryptionMaterials_->EncryptCEK(material);
+    auto ret = encryptContentKey(material);
     CHECK_FUNC_RET(InitiateMultipartUploadOutcome, EncryptCEK, ret);
     addMetaData(material, initRequest.MetaData());
     addMetaDataMultipart(ctx, initRequest.MetaData());
@@ -192,6 +192,43 @@ PutObjectOutcome CryptoModule::UploadPartSecurely(const std::shared_ptr<OssClien
     return client->UploadPart(uRequest);
 }
 
+int CryptoModule::encryptContentKey(ContentCryptoMaterial& content)
+{
+    if (keyCache_ != nullptr && keyCache_->acquireDataKey(content)) {
+        //the content key is reused, the iv never is
+        ContentCryptoMaterial fresh;
+        generateKeyIV(fresh);
+        content.setContentIV(fresh.ContentIV());
+        if (encryptionMaterials_->EncryptIV(content) == 0) {
+            return 0;
+        }
+        keyCache_->invalidateDataKey();
+    }
+
+    generateKeyIV(content);
+    auto ret = encryptionMaterials_->EncryptCEK(content);
+    if (ret == 0 && keyCache_ != nullptr) {
+        keyCache_->putDataKey(content);
+        keyCache_->putContentKey(content);
+    }
+    return ret;
+}
+
+int CryptoModule::decryptContentKey(ContentCryptoMaterial& content)
+{
+    if (keyCache_ != nullptr && keyCache_->findContentKey(content)) {
+        if (encryptionMaterials_->DecryptIV(content) == 0) {
+            return 0;
+        }
+    }
+
+    auto ret = encryptionMaterials_->DecryptCEK(content);
+    if (ret == 0 && keyCache_ != nullptr) {
+        keyCache_->putContentKey(content);
+    }
+    return ret;
+}
+
 void CryptoModule::addMetaData(const ContentCryptoMaterial& content, ObjectMetaData& meta)
 {
     //x-oss-meta-client-side-encryption-key
@@ -278,8 +315,8 @@ void CryptoModule::addUserAgent(ObjectMetaData& meta, const std::string& prefix)
 //CryptoModuleAES265_CTR
 
 CryptoModuleAESCTR::CryptoModuleAESCTR(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, 
-    const CryptoConfiguration& cryptoConfig):
-    CryptoModule(encryptionMaterials, cryptoConfig)
+    const CryptoConfiguration& cryptoConfig, const std::shared_ptr<ContentKeyCache>& keyCache):
+    CryptoModule(encryptionMaterials, cryptoConfig, keyCache)
 {
 }
 
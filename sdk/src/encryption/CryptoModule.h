@@ -21,6 +21,7 @@
 #include <alibabacloud/oss/OssFwd.h>
 #include <alibabacloud/oss/model/MultipartUploadCryptoContext.h>
 #include "../OssClientImpl.h"
+#include "ContentKeyCache.h"
 
 namespace AlibabaCloud
 {
@@ -40,10 +41,13 @@ namespace OSS
             const MultipartUploadCryptoContext& ctx);
     public:
         static std::shared_ptr<CryptoModule> CreateCryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials,
-            const CryptoConfiguration& cryptoConfig);
+            const CryptoConfiguration& cryptoConfig, const std::shared_ptr<ContentKeyCache>& keyCache = nullptr);
 
     protected:
-        CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig);
+        CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig,
+            const std::shared_ptr<ContentKeyCache>& keyCache);
+        int encryptContentKey(ContentCryptoMaterial& content);
+        int decryptContentKey(ContentCryptoMaterial& content);
         void addMetaData(const ContentCryptoMaterial& content, ObjectMetaData& meta);
         void addMetaDataMultipart(const MultipartUploadCryptoContext& ctx, ObjectMetaData& meta);
         void readMetaData(ContentCryptoMaterial& content, const ObjectMetaData& meta);
@@ -57,13 +61,15 @@ namespace OSS
     protected:
         std::shared_ptr<EncryptionMaterials> encryptionMaterials_;
         CryptoConfiguration cryptoConfig_;
+        std::shared_ptr<ContentKeyCache> keyCache_;
         std::shared_ptr<SymmetricCipher> cipher_;
     };
 
     class CryptoModuleAESCTR :public CryptoModule
     {
     public:
-        CryptoModuleAESCTR(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig);
+        CryptoModuleAESCTR(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig,
+            const std::shared_ptr<ContentKeyCache>& keyCache);
         ~CryptoModuleAESCTR();
     protected:
         virtual void initEncryptionCipher(ContentCryptoMaterial& content);
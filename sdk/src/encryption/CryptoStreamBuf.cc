@@ -20,6 +20,8 @@
 
 using namespace AlibabaCloud::OSS;
 
+const std::streamsize CryptoStreamBuf::BATCH_SIZE;
+
 
 CryptoStreamBuf::CryptoStreamBuf(std::iostream& stream, 
     const std::shared_ptr<SymmetricCipher>& cipher,
@@ -90,28 +92,38 @@ std::streamsize CryptoStreamBuf::xsgetn(char * _Ptr, std::streamsize _Count)
         _Ptr += readCnt;
     }
 
-    //read from streambuf by BLK_SIZE
-    while (_Count > 0) {
-        readCnt = StreamBufProxy::xsgetn(reinterpret_cast<char *>(block), BLK_SIZE);
-        if (readCnt <= 0)
+    //read from streambuf by batches of whole blocks, and encrypt in place
+    bool eof = false;
+    while (_Count >= BLK_SIZE) {
+        auto wanted = std::min(_Count - _Count % BLK_SIZE, BATCH_SIZE);
+        readCnt = StreamBufProxy::xsgetn(_Ptr, wanted);
+        if (readCnt <= 0) {
+            eof = true;
             break;
+        }
+        auto ret = cipher_->Encrypt(reinterpret_cast<unsigned char *>(_Ptr), static_cast<int>(readCnt),
+            reinterpret_cast<const unsigned char *>(_Ptr), static_cast<int>(readCnt));
+        if (ret < 0) {
+            return -1;
+        }
+        _Count -= ret;
+        _Ptr += ret;
+        if (readCnt < wanted) {
+            eof = true;
+            break;
+        }
+    }
 
-        if (_Count < readCnt) {
+    //less than one block is wanted, keep the rest of the block in encBuffer_
+    if (_Count > 0 && !eof) {
+        readCnt = StreamBufProxy::xsgetn(reinterpret_cast<char *>(block), BLK_SIZE);
+        if (readCnt > 0) {
             auto ret = cipher_->Encrypt(encBuffer_, static_cast<int>(readCnt), block, static_cast<int>(readCnt));
             if (ret < 0) {
                 return -1;
             }
             encBufferCnt_ = ret;
             encBufferOff_ = 0;
-            break;
-        }
-        else {
-            auto ret = cipher_->Encrypt(reinterpret_cast<unsigned char *>(_Ptr), static_cast<int>(readCnt), block, static_cast<int>(readCnt));
-            if (ret < 0) {
-                return -1;
-            }
-            _Count -= ret;
-            _Ptr += ret;
         }
     }
 
@@ -202,16 +214,22 @@ std::streamsize CryptoStreamBuf::xsputn(const char *_Ptr, std::streamsize _Count
     auto blkOff = _Count / BLK_SIZE;
     auto blkIdx = _Count % BLK_SIZE;
 
-    //decrypt by BLK_SIZE
-    for (auto i = std::streamsize(0); i < blkOff; i++) {
-        auto ret = cipher_->Decrypt(block, static_cast<int>(BLK_SIZE), reinterpret_cast<const unsigned char *>(_Ptr), static_cast<int>(BLK_SIZE));
+    //decrypt by batches of whole blocks
+    auto blkBytes = blkOff * BLK_SIZE;
+    if (blkBytes > 0 && decBatch_.empty()) {
+        decBatch_.resize(static_cast<size_t>(BATCH_SIZE));
+    }
+    while (blkBytes > 0) {
+        auto batch = std::min(blkBytes, BATCH_SIZE);
+        auto ret = cipher_->Decrypt(decBatch_.data(), static_cast<int>(batch), reinterpret_cast<const unsigned char *>(_Ptr), static_cast<int>(batch));
         if (ret < 0) {
             return -1;
         }
-        _Ptr += BLK_SIZE;
-        _Count -= BLK_SIZE;
-        writeCnt = xsputn_with_skip(reinterpret_cast<char *>(block), BLK_SIZE);
-        if (writeCnt != BLK_SIZE) {
+        _Ptr += batch;
+        _Count -= batch;
+        blkBytes -= batch;
+        writeCnt = xsputn_with_skip(reinterpret_cast<char *>(decBatch_.data()), batch);
+        if (writeCnt != batch) {
             //Todo Save decrypted data
             return startCount - _Count;
         }
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <alibabacloud/oss/encryption/Cipher.h>
+#include <vector>
 #include "../utils/StreamBuf.h"
 
 namespace AlibabaCloud
@@ -26,6 +27,8 @@ namespace OSS
     {
     public:
         static const std::streamsize BLK_SIZE = 16;
+        /* data is passed to the cipher in batches of whole blocks up to this size */
+        static const std::streamsize BATCH_SIZE = 64 * 1024;
 
         CryptoStreamBuf(std::iostream& stream,
             const std::shared_ptr<SymmetricCipher>& cipher,
@@ -47,6 +50,7 @@ namespace OSS
         unsigned char decBuffer_[BLK_SIZE * 2];
         std::streamsize decBufferCnt_;
         std::streamsize decBufferOff_;
+        std::vector<unsigned char> decBatch_;
         ByteBuffer key_;
         ByteBuffer iv_;
         bool initEncrypt;
@@ -26,6 +26,18 @@ EncryptionMaterials::~EncryptionMaterials()
 {
 }
 
+int EncryptionMaterials::EncryptIV(ContentCryptoMaterial& contentCryptoMaterial)
+{
+    UNUSED_PARAM(contentCryptoMaterial);
+    return -1;
+}
+
+int EncryptionMaterials::DecryptIV(ContentCryptoMaterial& contentCryptoMaterial)
+{
+    UNUSED_PARAM(contentCryptoMaterial);
+    return -1;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////
 SimpleRSAEncryptionMaterials::SimpleRSAEncryptionMaterials(const std::string& publicKey, const std::string& privateKey):
     SimpleRSAEncryptionMaterials(publicKey, privateKey, std::map< std::string, std::string>())
@@ -102,6 +114,43 @@ int SimpleRSAEncryptionMaterials::DecryptCEK(ContentCryptoMaterial& contentCrypt
     return 0;
 }
 
+int SimpleRSAEncryptionMaterials::EncryptIV(ContentCryptoMaterial& contentCryptoMaterial)
+{
+    auto cipher = AsymmetricCipher::CreateRSA_NONEImpl();
+    cipher->setPublicKey(publicKey_);
+
+    auto encrptedKeyIV = cipher->Encrypt(contentCryptoMaterial.ContentIV());
+    if (encrptedKeyIV.empty()) {
+        return -1;
+    }
+    contentCryptoMaterial.setEncryptedContentIV(encrptedKeyIV);
+    return 0;
+}
+
+int SimpleRSAEncryptionMaterials::DecryptIV(ContentCryptoMaterial& contentCryptoMaterial)
+{
+    auto cipher = AsymmetricCipher::CreateRSA_NONEImpl();
+
+    auto keyWarpAlgo = ToLower(contentCryptoMaterial.KeyWrapAlgorithm().c_str());
+    auto cipherName  = ToLower(cipher->Name().c_str());
+    if (keyWarpAlgo != cipherName) {
+        return -1;
+    }
+
+    int index = findIndexByDescription(contentCryptoMaterial.Description());
+    if (index < 0) {
+        return -1;
+    }
+    cipher->setPrivateKey(encryptionMaterials_[index].first.second);
+
+    auto iv = cipher->Decrypt(contentCryptoMaterial.EncryptedContentIV());
+    if (iv.empty()) {
+        return -1;
+    }
+    contentCryptoMaterial.setContentIV(iv);
+    return 0;
+}
+
 int SimpleRSAEncryptionMaterials::findIndexByDescription(const std::map<std::string, std::string>& description)
 {
     bool found = false;
@@ -17,7 +17,9 @@
 #include <fstream>
 #include <alibabacloud/oss/OssEncryptionClient.h>
 #include "../encryption/CryptoModule.h"
+#include "../encryption/ContentKeyCache.h"
 #include "../utils/Utils.h"
+#include "../utils/CpuAccounting.h"
 #include "../utils/FileSystemUtils.h"
 #include "../resumable/ResumableDownloader.h"
 #include "../resumable/ResumableUploader.h"
@@ -205,7 +207,8 @@ OssEncryptionClient::OssEncryptionClient(const std::string& endpoint, const std:
     const ClientConfiguration& configuration, const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig):
     OssClient(endpoint, std::make_shared<SimpleCredentialsProvider>(accessKeyId, accessKeySecret, securityToken), configuration),
     encryptionMaterials_(encryptionMaterials),
-    cryptoConfig_(cryptoConfig)
+    cryptoConfig_(cryptoConfig),
+    keyCache_(ContentKeyCache::CreateContentKeyCache(cryptoConfig))
 {
 }
 
@@ -214,7 +217,8 @@ OssEncryptionClient::OssEncryptionClient(const std::string &endpoint,
     const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration& cryptoConfig) :
     OssClient(endpoint, credentialsProvider, configuration),
     encryptionMaterials_(encryptionMaterials),
-    cryptoConfig_(cryptoConfig)
+    cryptoConfig_(cryptoConfig),
+    keyCache_(ContentKeyCache::CreateContentKeyCache(cryptoConfig))
 {
 }
 
@@ -225,7 +229,7 @@ OssEncryptionClient::~OssEncryptionClient()
 GetObjectOutcome OssEncryptionClient::GetObjectInternal(const GetObjectRequest& request, const ObjectMetaData& meta) const
 {
     if (meta.hasUserHeader("client-side-encryption-key")) {
-        auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_);
+        auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_, keyCache_);
         return module->GetObjectSecurely(client_, request, meta);
     }
     else {
@@ -235,6 +239,8 @@ GetObjectOutcome OssEncryptionClient::GetObjectInternal(const GetObjectRequest&
 
 GetObjectOutcome OssEncryptionClient::GetObject(const GetObjectRequest& request) const
 {
+    // the HeadObject and the key unwrapping are part of the GetObject
+    CpuOperationScope cpuScope(client_->configuration().metrics, request.OperationName());
     const auto& reqeustBase = static_cast<const OssRequest &>(request);
     int ret = reqeustBase.validate();
     if (ret != 0) {
@@ -272,12 +278,13 @@ GetObjectOutcome OssEncryptionClient::GetObject(const std::string &bucket, const
 
 PutObjectOutcome OssEncryptionClient::PutObject(const PutObjectRequest& request) const
 {
+    CpuOperationScope cpuScope(client_->configuration().metrics, request.OperationName());
     const auto& reqeustBase = static_cast<const OssRequest &>(request);
     int ret = reqeustBase.validate();
     if (ret != 0) {
         return PutObjectOutcome(OssError("ValidateError", request.validateMessage(ret)));
     }
-    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_);
+    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_, keyCache_);
     return module->PutObjectSecurely(client_, request);
 }
 
@@ -301,18 +308,20 @@ AppendObjectOutcome OssEncryptionClient::AppendObject(const AppendObjectRequest&
 /*MultipartUpload*/
 InitiateMultipartUploadOutcome OssEncryptionClient::InitiateMultipartUpload(const InitiateMultipartUploadRequest& request, MultipartUploadCryptoContext& ctx) const
 {
-    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_);
+    CpuOperationScope cpuScope(client_->configuration().metrics, request.OperationName());
+    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_, keyCache_);
     return module->InitiateMultipartUploadSecurely(client_, request, ctx);
 }
 
 PutObjectOutcome OssEncryptionClient::UploadPart(const UploadPartRequest& request, const MultipartUploadCryptoContext& ctx) const
 {
+    CpuOperationScope cpuScope(client_->configuration().metrics, request.OperationName());
     const auto& reqeustBase = static_cast<const OssRequest &>(request);
     int ret = reqeustBase.validate();
     if (ret != 0) {
         return PutObjectOutcome(OssError("ValidateError", request.validateMessage(ret)));
     }
-    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_);
+    auto module = CryptoModule::CreateCryptoModule(encryptionMaterials_, cryptoConfig_, keyCache_);
     return module->UploadPartSecurely(client_, request, ctx);
 }
 
@@ -2289,9 +2289,23 @@ XMLError XMLDocument::Parse( const char* p, size_t len )
     if ( len == (size_t)(-1) ) {
         len = strlen( p );
     }
+    char* buffer = new char[ len+1 ];
+    memcpy( buffer, p, len );
+    return ParseInSitu( buffer, len );
+}
+
+
+XMLError XMLDocument::ParseInSitu( char* p, size_t len )
+{
+    Clear();
+
+    if ( len == 0 || !p || !*p ) {
+        delete [] p;
+        SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
+        return _errorID;
+    }
     TIXMLASSERT( _charBuffer == 0 );
-    _charBuffer = new char[ len+1 ];
-    memcpy( _charBuffer, p, len );
+    _charBuffer = p;
     _charBuffer[len] = 0;
 
     Parse();
@@ -1694,6 +1694,15 @@ public:
     */
     XMLError Parse( const char* xml, size_t nBytes=(size_t)(-1) );
 
+    /**
+    	Parse an XML document in place, without copying it.
+    	The document takes ownership of 'xml', which must be
+    	allocated with new[] and hold nBytes+1 characters.
+    	Returns XML_SUCCESS (0) on success, or
+    	an errorID.
+    */
+    XMLError ParseInSitu( char* xml, size_t nBytes );
+
     /**
     	Load an XML file from disk.
     	Returns XML_SUCCESS (0) on success, or
@@ -23,9 +23,13 @@
 #include <condition_variable>
 #include <atomic>
 #include <algorithm>
+#include <chrono>
 #include <../utils/Crc64.h>
 #include <alibabacloud/oss/client/Error.h>
 #include <alibabacloud/oss/client/RateLimiter.h>
+#include <alibabacloud/oss/client/Metrics.h>
+#include "../utils/CpuAccounting.h"
+#include "../utils/LockProfiler.h"
 #include "../utils/LogUtils.h"
 #include "../utils/Utils.h"
 
@@ -44,10 +48,13 @@ namespace OSS
         ResourceManager_() : m_shutdown(false) {}
         RESOURCE_TYPE Acquire()
         {
-            std::unique_lock<std::mutex> locker(m_queueLock);
-            while(!m_shutdown.load() && m_resources.size() == 0)
+            std::unique_lock<std::mutex> locker(m_queueLock, std::defer_lock);
+            ProfiledLock(locker, LockSite::CurlHandlePool);
+            if (!m_shutdown.load() && m_resources.size() == 0)
             {
-                m_semaphore.wait(locker, [&](){ return m_shutdown.load() || m_resources.size() > 0; });                    
+                uint64_t start = LockProfiler::NowNanos();
+                m_semaphore.wait(locker, [&](){ return m_shutdown.load() || m_resources.size() > 0; });
+                LockProfiler::record(LockSite::CurlHandleWait, LockProfiler::NowNanos() - start);
             }
     
             assert(!m_shutdown.load());
@@ -60,13 +67,15 @@ namespace OSS
     
         bool HasResourcesAvailable()
         {
-            std::lock_guard<std::mutex> locker(m_queueLock);
+            std::unique_lock<std::mutex> locker(m_queueLock, std::defer_lock);
+            ProfiledLock(locker, LockSite::CurlHandlePool);
             return m_resources.size() > 0 && !m_shutdown.load();
         }
     
         void Release(RESOURCE_TYPE resource)
         {
-            std::unique_lock<std::mutex> locker(m_queueLock);
+            std::unique_lock<std::mutex> locker(m_queueLock, std::defer_lock);
+            ProfiledLock(locker, LockSite::CurlHandlePool);
             m_resources.push_back(resource);
             locker.unlock();
             m_semaphore.notify_one();
@@ -102,11 +111,13 @@ namespace OSS
     class CurlContainer
     {
     public:
-        CurlContainer(unsigned maxSize = 16, long requestTimeout = 10000, long connectTimeout = 5000):
+        CurlContainer(unsigned maxSize = 16, long requestTimeout = 10000, long connectTimeout = 5000,
+            const std::shared_ptr<MetricsRegistry>& metrics = nullptr):
               maxPoolSize_(maxSize), 
               requestTimeout_(requestTimeout), 
               connectTimeout_(connectTimeout),
-              poolSize_(0)
+              poolSize_(0),
+              metrics_(metrics)
         {
         }
     
@@ -115,6 +126,9 @@ namespace OSS
             for (CURL* handle : handleContainer_.ShutdownAndWait(poolSize_)) {
                 curl_easy_cleanup(handle);
             }
+            if (metrics_ != nullptr) {
+                metrics_->adjustCurlPoolSize(-static_cast<int64_t>(poolSize_));
+            }
         }
     
         CURL* Acquire()
@@ -150,7 +164,8 @@ namespace OSS
     
         bool growPool()
         {
-            std::lock_guard<std::mutex> locker(containerLock_);
+            std::unique_lock<std::mutex> locker(containerLock_, std::defer_lock);
+            ProfiledLock(locker, LockSite::CurlPoolGrow);
             if (poolSize_ < maxPoolSize_) {
                 unsigned multiplier = poolSize_ > 0 ? poolSize_ : 1;
                 unsigned amountToAdd = (std::min)(multiplier * 2, maxPoolSize_ - poolSize_);
@@ -167,6 +182,9 @@ namespace OSS
                     }
                 }
                 poolSize_ += actuallyAdded;
+                if (metrics_ != nullptr) {
+                    metrics_->adjustCurlPoolSize(actuallyAdded);
+                }
                 return actuallyAdded > 0;
             }
             return false;
@@ -194,6 +212,7 @@ namespace OSS
         unsigned long connectTimeout_;
         unsigned poolSize_;
         std::mutex containerLock_;
+        std::shared_ptr<MetricsRegistry> metrics_;
     };
     
     /////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,8 +232,27 @@ namespace OSS
         uint64_t recvCrc64Value;
         int sendSpeed;
         int recvSpeed;
+        int64_t sent;
+        int64_t received;
+        std::chrono::steady_clock::time_point performStart;
+        bool firstByteNotified;
+        bool headersNotified;
     };
 
+    static void notifyFirstByteSent(TransferState *state)
+    {
+        state->firstByteNotified = true;
+        double pretransfer = 0;
+        curl_easy_getinfo(state->curl, CURLINFO_PRETRANSFER_TIME, &pretransfer);
+        if (pretransfer <= 0) {
+            return;
+        }
+        auto event = state->request->makeEvent(RequestEventType::FirstByteSent);
+        event.setTimestamp(state->performStart +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(pretransfer)));
+        state->request->notifyObserver(event);
+    }
+
     static size_t sendBody(char *ptr, size_t size, size_t nmemb, void *userdata)
     {
         TransferState *state = static_cast<TransferState*>(userdata);
@@ -240,11 +278,13 @@ namespace OSS
         }
 
         state->transferred += got;
+        state->sent += got;
         if (state->progress) {
             state->progress(got, state->transferred, state->total, state->userData);
         }
 
         if (state->enableCrc64) {
+            CpuStageScope checksumStage(CpuStage::Checksum);
             state->sendCrc64Value = CRC64::CalcCRC(state->sendCrc64Value, (void *)ptr, got);
         }
 
@@ -290,11 +330,13 @@ namespace OSS
         }
 
         state->transferred += wanted;
+        state->received += wanted;
         if (state->progress) {
             state->progress(wanted, state->transferred, state->total, state->userData);
         }
 
         if (state->enableCrc64) {
+            CpuStageScope checksumStage(CpuStage::Checksum);
             state->recvCrc64Value = CRC64::CalcCRC(state->recvCrc64Value, (void *)ptr, wanted);
         }
 
@@ -325,6 +367,20 @@ namespace OSS
                 curl_easy_getinfo(state->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &dval);
                 state->total = (int64_t)dval;
             }
+            if (state->request->hasObserver() && !state->headersNotified) {
+                long response_code = 0;
+                curl_easy_getinfo(state->curl, CURLINFO_RESPONSE_CODE, &response_code);
+                if (response_code >= 200) {
+                    if (!state->firstByteNotified) {
+                        notifyFirstByteSent(state);
+                    }
+                    state->headersNotified = true;
+                    auto event = state->request->makeEvent(RequestEventType::HeadersReceived);
+                    event.setStatusCode(response_code);
+                    event.setServerRequestId(state->response->Header("x-oss-request-id"));
+                    state->request->notifyObserver(event);
+                }
+            }
         }
         return length;
     }
@@ -416,7 +472,8 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration &configuration) :
     HttpClient(),
     curlContainer_(new CurlContainer(configuration.maxConnections, 
                                                        configuration.requestTimeoutMs,
-                                                       configuration.connectTimeoutMs)),
+                                                       configuration.connectTimeoutMs,
+                                                       configuration.metrics)),
     userAgent_(configuration.userAgent),
     proxyScheme_(configuration.proxyScheme),
     proxyHost_(configuration.proxyHost),
@@ -429,7 +486,8 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration &configuration) :
     networkInterface_(configuration.networkInterface),
     sendRateLimiter_(configuration.sendRateLimiter),
     recvRateLimiter_(configuration.recvRateLimiter),
-    httpInterceptor_(configuration.httpInterceptor)
+    httpInterceptor_(configuration.httpInterceptor),
+    metrics_(configuration.metrics)
 {
 }
 
@@ -466,9 +524,21 @@ std::shared_ptr<HttpResponse> CurlHttpClient::makeRequest(const std::shared_ptr<
         requestBodyPos = request->Body()->tellg();
     }
 
+    std::chrono::steady_clock::time_point acquireStart;
+    if (metrics_ != nullptr) {
+        acquireStart = std::chrono::steady_clock::now();
+    }
     CURL * curl = curlContainer_->Acquire();
+    if (metrics_ != nullptr) {
+        auto wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - acquireStart);
+        metrics_->recordCurlAcquireWait(static_cast<uint64_t>(wait.count()));
+    }
 
     OSS_LOG(LogLevel::LogDebug, TAG, "request(%p) acquire curl handle:%p", request.get(), curl);
+    if (request->hasObserver()) {
+        auto event = request->makeEvent(RequestEventType::PoolAcquired);
+        request->notifyObserver(event);
+    }
 
     uint64_t initCRC64 = 0;
 #ifdef ENABLE_OSS_TEST
@@ -486,7 +556,9 @@ std::shared_ptr<HttpResponse> CurlHttpClient::makeRequest(const std::shared_ptr<
         request->TransferProgress().Handler,
         request->TransferProgress().UserData,
         request->hasCheckCrc64(), initCRC64, initCRC64, 
-        0, 0
+        0, 0,
+        0, 0,
+        std::chrono::steady_clock::time_point(), false, false
     };
 
     int64_t contentlength = -1;
@@ -544,6 +616,10 @@ std::shared_ptr<HttpResponse> CurlHttpClient::makeRequest(const std::shared_ptr<
     
     curl_easy_setopt(curl, CURLOPT_USERAGENT,userAgent_.c_str());
 
+    if (!request->acceptEncoding().empty()) {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, request->acceptEncoding().c_str());
+    }
+
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
     curl_easy_setopt(curl, CURLOPT_HEADERDATA, &transferState);
     curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, recvHeaders);
@@ -614,6 +690,9 @@ std::shared_ptr<HttpResponse> CurlHttpClient::makeRequest(const std::shared_ptr<
         httpInterceptor_->preSendRequest(curl, request);
     }
 
+    if (request->hasObserver()) {
+        transferState.performStart = std::chrono::steady_clock::now();
+    }
     CURLcode res = curl_easy_perform(curl);
     long response_code= 0;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
@@ -659,6 +738,24 @@ std::shared_ptr<HttpResponse> CurlHttpClient::makeRequest(const std::shared_ptr<
         break;
     }
     request->setTransferedBytes(transferState.transferred);
+    if (metrics_ != nullptr) {
+        metrics_->recordTransfer(static_cast<uint64_t>(transferState.sent), static_cast<uint64_t>(transferState.received));
+    }
+    if (request->hasObserver()) {
+        if (!transferState.firstByteNotified) {
+            notifyFirstByteSent(&transferState);
+        }
+        auto event = request->makeEvent(RequestEventType::Completed);
+        event.setStatusCode(response->statusCode());
+        event.setServerRequestId(response->Header("x-oss-request-id"));
+        event.setBytesSent(transferState.sent);
+        event.setBytesReceived(transferState.received);
+        event.setSuccess(res == CURLE_OK);
+        if (res != CURLE_OK) {
+            event.setErrorCode(curl_easy_strerror(res));
+        }
+        request->notifyObserver(event);
+    }
 
     curlContainer_->Release(curl, (res != CURLE_OK));
 
@@ -26,6 +26,7 @@ namespace OSS
 
     class CurlContainer;
     class RateLimiter;
+    class MetricsRegistry;
 
     class CurlHttpClient : public HttpClient
     {
@@ -53,6 +54,7 @@ namespace OSS
         std::shared_ptr<RateLimiter> sendRateLimiter_;
         std::shared_ptr<RateLimiter> recvRateLimiter_;
         std::shared_ptr<HttpInterceptor> httpInterceptor_;
+        std::shared_ptr<MetricsRegistry> metrics_;
     };
 }
 }
@@ -15,6 +15,7 @@
  */
 
 #include <alibabacloud/oss/http/HttpClient.h>
+#include "../utils/LockProfiler.h"
 
 
 using namespace AlibabaCloud::OSS;
@@ -48,7 +49,8 @@ void HttpClient::waitForRetry(long milliseconds)
 {
     if (milliseconds == 0)
         return;
-    std::unique_lock<std::mutex> lck(requestLock_);
+    std::unique_lock<std::mutex> lck(requestLock_, std::defer_lock);
+    ProfiledLock(lck, LockSite::HttpClientRetry);
     requestSignal_.wait_for(lck, std::chrono::milliseconds(milliseconds), [this] ()-> bool { return disable_.load() == true; });
 }
 
@@ -60,7 +60,11 @@ HttpRequest::HttpRequest(Http::Method method) :
     hasCheckCrc64_(false),
     crc64Result_(0),
     transferedBytes_(0),
-    chunkedEncoding_(false)
+    chunkedEncoding_(false),
+    acceptEncoding_(),
+    observer_(nullptr),
+    requestId_(0),
+    attempt_(0)
 {
 }
 
@@ -68,6 +72,21 @@ HttpRequest::~HttpRequest()
 {
 }
 
+void HttpRequest::setObserver(const std::shared_ptr<RequestObserver>& observer, uint64_t requestId, int attempt)
+{
+    observer_ = observer;
+    requestId_ = requestId;
+    attempt_ = attempt;
+}
+
+void HttpRequest::notifyObserver(RequestEvent& event) const
+{
+    if (observer_ != nullptr) {
+        event.setRequest(this);
+        observer_->onRequestEvent(event);
+    }
+}
+
 Http::Method HttpRequest::method() const
 {
     return method_;
@@ -0,0 +1,363 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/model/CompactObjectList.h>
+#include <cstdlib>
+#include "../utils/Utils.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const uint16_t IN_EXTRA = 0xFFFF;
+const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+void PutVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+const char* GetVarint(const char* ptr, uint64_t& value)
+{
+    value = 0;
+    for (int shift = 0; ; shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(*ptr++);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            break;
+        }
+    }
+    return ptr;
+}
+
+/* decodes the key entry at ptr on top of the previous key */
+void DecodeKeyEntry(const char* ptr, std::string& key)
+{
+    uint64_t shared, length;
+    ptr = GetVarint(ptr, shared);
+    ptr = GetVarint(ptr, length);
+    key.resize(static_cast<size_t>(shared));
+    key.append(ptr, static_cast<size_t>(length));
+}
+
+int HexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/* "32 hex digits" or "32 hex digits-parts", upper case only so that it reads back unchanged */
+bool EncodeETag(const std::string& eTag, uint8_t* bytes, uint16_t& parts)
+{
+    if (eTag.size() < 32) {
+        return false;
+    }
+    for (size_t i = 0; i < 16; i++) {
+        int high = HexValue(eTag[2 * i]);
+        int low = HexValue(eTag[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    parts = 0;
+    if (eTag.size() == 32) {
+        return true;
+    }
+    if (eTag[32] != '-' || eTag.size() > 38 || eTag.size() == 33 || eTag[33] == '0') {
+        return false;
+    }
+    unsigned long value = 0;
+    for (size_t i = 33; i < eTag.size(); i++) {
+        if (eTag[i] < '0' || eTag[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (eTag[i] - '0');
+    }
+    if (value == 0 || value >= IN_EXTRA) {
+        return false;
+    }
+    parts = static_cast<uint16_t>(value);
+    return true;
+}
+
+std::string FormatLastModified(int64_t time)
+{
+    std::time_t t = static_cast<std::time_t>(time / 1000);
+    std::string value = ToUtcTime(t);
+    int ms = static_cast<int>(time % 1000);
+    value[value.size() - 4] = static_cast<char>('0' + ms / 100);
+    value[value.size() - 3] = static_cast<char>('0' + ms / 10 % 10);
+    value[value.size() - 2] = static_cast<char>('0' + ms % 10);
+    return value;
+}
+
+int64_t ParseLastModified(const std::string& value)
+{
+    std::time_t t = UtcToUnixTime(value);
+    auto pos = value.find('.');
+    if (t < 0 || pos == std::string::npos || value.size() != pos + 5) {
+        return -1;
+    }
+    return static_cast<int64_t>(t) * 1000 + std::atoi(value.c_str() + pos + 1);
+}
+}
+
+const std::string& CompactObjectList::View::StorageClass() const
+{
+    return record_->storageClass == IN_EXTRA ?
+        list_->extra(*record_)->storageClass : list_->strings_[record_->storageClass];
+}
+
+const std::string& CompactObjectList::View::Type() const
+{
+    return record_->type == IN_EXTRA ?
+        list_->extra(*record_)->type : list_->strings_[record_->type];
+}
+
+std::string CompactObjectList::View::ETag() const
+{
+    if (record_->eTagParts == IN_EXTRA) {
+        return list_->extra(*record_)->eTag;
+    }
+    std::string value(32, '0');
+    for (size_t i = 0; i < 16; i++) {
+        value[2 * i] = HEX_DIGITS[record_->eTag[i] >> 4];
+        value[2 * i + 1] = HEX_DIGITS[record_->eTag[i] & 0x0F];
+    }
+    if (record_->eTagParts > 0) {
+        value.append("-").append(std::to_string(record_->eTagParts));
+    }
+    return value;
+}
+
+std::string CompactObjectList::View::LastModified() const
+{
+    const Extra* extra = list_->extra(*record_);
+    if (extra != nullptr && !extra->lastModified.empty()) {
+        return extra->lastModified;
+    }
+    return record_->lastModified < 0 ? std::string() : FormatLastModified(record_->lastModified);
+}
+
+std::string CompactObjectList::View::RestoreInfo() const
+{
+    const Extra* extra = list_->extra(*record_);
+    return extra != nullptr ? extra->restoreInfo : std::string();
+}
+
+ObjectSummary CompactObjectList::View::Summary() const
+{
+    ObjectSummary summary;
+    summary.key_ = key_;
+    summary.eTag_ = ETag();
+    summary.size_ = Size();
+    summary.lastModified_ = LastModified();
+    summary.storageClass_ = StorageClass();
+    summary.type_ = Type();
+    summary.owner_ = Owner();
+    summary.restoreInfo_ = RestoreInfo();
+    return summary;
+}
+
+CompactObjectList::Iterator::Iterator(const CompactObjectList* list, size_t index)
+{
+    view_.list_ = list;
+    view_.index_ = index;
+    if (index < list->records_.size()) {
+        view_.record_ = &list->records_[index];
+        list->decodeKey(index, view_.key_);
+    }
+}
+
+CompactObjectList::Iterator& CompactObjectList::Iterator::operator++()
+{
+    const auto& records = view_.list_->records_;
+    if (++view_.index_ < records.size()) {
+        view_.record_ = &records[view_.index_];
+        //the next key only needs the entry on top of the current one
+        DecodeKeyEntry(view_.list_->keys_.data() + view_.record_->keyOffset, view_.key_);
+    }
+    else {
+        view_.record_ = nullptr;
+        view_.key_.clear();
+    }
+    return *this;
+}
+
+CompactObjectList::CompactObjectList()
+{
+}
+
+void CompactObjectList::add(const ObjectSummary& summary)
+{
+    const std::string& key = summary.Key();
+    size_t shared = 0;
+    if (records_.size() % RestartInterval != 0) {
+        size_t limit = (std::min)(key.size(), lastKey_.size());
+        while (shared < limit && key[shared] == lastKey_[shared]) {
+            shared++;
+        }
+    }
+
+    Record record;
+    record.keyOffset = keys_.size();
+    PutVarint(keys_, shared);
+    PutVarint(keys_, key.size() - shared);
+    keys_.append(key, shared, std::string::npos);
+    lastKey_ = key;
+
+    Extra extra;
+    bool hasExtra = false;
+    record.size = summary.Size();
+    if (!EncodeETag(summary.ETag(), record.eTag, record.eTagParts)) {
+        record.eTagParts = IN_EXTRA;
+        extra.eTag = summary.ETag();
+        hasExtra = true;
+    }
+
+    record.lastModified = ParseLastModified(summary.LastModified());
+    if (!summary.LastModified().empty() &&
+        (record.lastModified < 0 || FormatLastModified(record.lastModified) != summary.LastModified())) {
+        extra.lastModified = summary.LastModified();
+        hasExtra = true;
+    }
+
+    record.storageClass = internString(summary.StorageClass());
+    if (record.storageClass == IN_EXTRA) {
+        extra.storageClass = summary.StorageClass();
+        hasExtra = true;
+    }
+    record.type = internString(summary.Type());
+    if (record.type == IN_EXTRA) {
+        extra.type = summary.Type();
+        hasExtra = true;
+    }
+
+    if (!summary.RestoreInfo().empty()) {
+        extra.restoreInfo = summary.RestoreInfo();
+        hasExtra = true;
+    }
+
+    record.owner = internOwner(summary.Owner());
+    record.extra = 0;
+    if (hasExtra) {
+        extras_.push_back(std::move(extra));
+        record.extra = static_cast<uint32_t>(extras_.size());
+    }
+    records_.push_back(record);
+}
+
+void CompactObjectList::add(const ObjectSummaryList& summaries)
+{
+    records_.reserve(records_.size() + summaries.size());
+    for (const auto& summary : summaries) {
+        add(summary);
+    }
+}
+
+void CompactObjectList::clear()
+{
+    keys_.clear();
+    lastKey_.clear();
+    records_.clear();
+    extras_.clear();
+    strings_.clear();
+    stringIndex_.clear();
+    owners_.clear();
+    ownerIndex_.clear();
+}
+
+void CompactObjectList::shrinkToFit()
+{
+    keys_.shrink_to_fit();
+    records_.shrink_to_fit();
+    extras_.shrink_to_fit();
+}
+
+size_t CompactObjectList::MemoryUsage() const
+{
+    size_t size = sizeof(CompactObjectList) + keys_.capacity() +
+        records_.capacity() * sizeof(Record) + extras_.capacity() * sizeof(Extra);
+    for (const auto& extra : extras_) {
+        size += extra.eTag.size() + extra.lastModified.size() + extra.restoreInfo.size() +
+            extra.storageClass.size() + extra.type.size();
+    }
+    for (const auto& value : strings_) {
+        size += 2 * (sizeof(std::string) + value.size());
+    }
+    for (const auto& owner : owners_) {
+        size += 2 * (sizeof(AlibabaCloud::OSS::Owner) + owner.Id().size() + owner.DisplayName().size());
+    }
+    return size;
+}
+
+CompactObjectList::View CompactObjectList::at(size_t index) const
+{
+    View view;
+    view.list_ = this;
+    view.index_ = index;
+    view.record_ = &records_.at(index);
+    decodeKey(index, view.key_);
+    return view;
+}
+
+const CompactObjectList::Extra* CompactObjectList::extra(const Record& record) const
+{
+    return record.extra == 0 ? nullptr : &extras_[record.extra - 1];
+}
+
+uint16_t CompactObjectList::internString(const std::string& value)
+{
+    auto it = stringIndex_.find(value);
+    if (it != stringIndex_.end()) {
+        return it->second;
+    }
+    if (strings_.size() >= IN_EXTRA) {
+        return IN_EXTRA;
+    }
+    uint16_t index = static_cast<uint16_t>(strings_.size());
+    strings_.push_back(value);
+    stringIndex_[value] = index;
+    return index;
+}
+
+uint32_t CompactObjectList::internOwner(const AlibabaCloud::OSS::Owner& owner)
+{
+    std::string id;
+    id.append(owner.Id()).append(1, '\0').append(owner.DisplayName());
+    auto it = ownerIndex_.find(id);
+    if (it != ownerIndex_.end()) {
+        return it->second;
+    }
+    uint32_t index = static_cast<uint32_t>(owners_.size());
+    owners_.push_back(owner);
+    ownerIndex_[id] = index;
+    return index;
+}
+
+void CompactObjectList::decodeKey(size_t index, std::string& key) const
+{
+    key.clear();
+    for (size_t i = index - index % RestartInterval; i <= index; i++) {
+        DecodeKeyEntry(keys_.data() + records_[i].keyOffset, key);
+    }
+}
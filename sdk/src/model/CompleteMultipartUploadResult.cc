@@ -17,6 +17,7 @@
 #include <alibabacloud/oss/model/CompleteMultipartUploadResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 #include <alibabacloud/oss/http/HttpType.h>
 
 using namespace AlibabaCloud::OSS;
@@ -48,9 +49,9 @@ CompleteMultipartUploadResult::CompleteMultipartUploadResult(const std::shared_p
     }
 
     if (contentType.compare("application/json") != 0) {
-        std::istreambuf_iterator<char> isb(*result.get()), end;
-        std::string str(isb, end);
-        *this = str;
+        XmlDocument doc;
+        doc.Load(*result);
+        parse(doc);
     }
     else {
         content_ = result;
@@ -68,14 +69,20 @@ CompleteMultipartUploadResult::CompleteMultipartUploadResult(const std::shared_p
 
 CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const std::string& result)
 {
-    if (result.empty()) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void CompleteMultipartUploadResult::parse(XmlDocument& doc)
+{
+    if (doc.Empty()) {
         parseDone_ = true;
-        return *this;
+        return;
     }
 
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("CompleteMultipartUploadResult", root->Name(), 29)) {
             XMLElement *node;
@@ -124,7 +131,6 @@ CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const s
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
 const std::string& CompleteMultipartUploadResult::Location() const
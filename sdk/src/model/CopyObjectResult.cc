@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/CopyObjectResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -36,9 +37,9 @@ CopyObjectResult::CopyObjectResult(const std::string& data):
 CopyObjectResult::CopyObjectResult(const std::shared_ptr<std::iostream>& data):
     CopyObjectResult()
 {
-    std::istreambuf_iterator<char> isb(*data.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*data);
+    parse(doc);
 }
 
 CopyObjectResult::CopyObjectResult(const HeaderCollection& headers, const std::shared_ptr<std::iostream>& data):
@@ -48,16 +49,22 @@ CopyObjectResult::CopyObjectResult(const HeaderCollection& headers, const std::s
         sourceVersionId_ = headers.at("x-oss-copy-source-version-id");
     }
 
-    std::istreambuf_iterator<char> isb(*data.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*data);
+    parse(doc);
 }
 
 CopyObjectResult& CopyObjectResult::operator =(const std::string& data)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(data.c_str(), data.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(data);
+    parse(doc);
+    return *this;
+}
+
+void CopyObjectResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("CopyObjectResult", root->Name(), strlen("CopyObjectResult"))) {
             XMLElement *node;
@@ -75,6 +82,5 @@ CopyObjectResult& CopyObjectResult::operator =(const std::string& data)
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
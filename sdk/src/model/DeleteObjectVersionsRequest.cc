@@ -77,20 +77,28 @@ void DeleteObjectVersionsRequest::setRequestPayer(RequestPayer value)
 
 std::string DeleteObjectVersionsRequest::payload() const
 {
-    std::stringstream ss;
-    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
-    ss << "<Delete>" << std::endl;
-    ss << "  <Quiet>" << (quiet_ ? "true":"false") << "</Quiet>" << std::endl;
+    size_t size = 96;
     for (auto const& object : objects_) {
-    ss << "  <Object>" << std::endl << ""; 
-    ss << "    <Key>" << XmlEscape(object.Key()) << "</Key>" << std::endl;
-    if (!object.VersionId().empty()) {
-    ss << "    <VersionId>" << object.VersionId() << "</VersionId>" << std::endl;
-    }
-    ss << "  </Object>" << std::endl;
+        size += object.Key().size() + object.VersionId().size() + 72;
     }
-    ss << "</Delete>" << std::endl;
-    return ss.str();
+
+    std::string body;
+    body.reserve(size);
+    body.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    body.append("<Delete>\n");
+    body.append("  <Quiet>").append(quiet_ ? "true" : "false").append("</Quiet>\n");
+    for (auto const& object : objects_) {
+        body.append("  <Object>\n");
+        body.append("    <Key>");
+        XmlEscapeAppend(body, object.Key());
+        body.append("</Key>\n");
+        if (!object.VersionId().empty()) {
+            body.append("    <VersionId>").append(object.VersionId()).append("</VersionId>\n");
+        }
+        body.append("  </Object>\n");
+    }
+    body.append("</Delete>\n");
+    return body;
 }
 
 ParameterCollection DeleteObjectVersionsRequest::specialParameters() const
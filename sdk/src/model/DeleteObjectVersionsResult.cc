@@ -17,6 +17,7 @@
 #include <alibabacloud/oss/model/DeleteObjectVersionsResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -38,22 +39,28 @@ DeleteObjectVersionsResult::DeleteObjectVersionsResult(const std::string& result
 DeleteObjectVersionsResult::DeleteObjectVersionsResult(const std::shared_ptr<std::iostream>& result) :
     DeleteObjectVersionsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 DeleteObjectVersionsResult& DeleteObjectVersionsResult::operator =(const std::string& result)
 {
-    if (result.empty()) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void DeleteObjectVersionsResult::parse(XmlDocument& doc)
+{
+    if (doc.Empty()) {
         quiet_ = true;
         parseDone_ = true;
-        return *this;
+        return;
     }
 
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("DeleteResult", root->Name(), 12)) {
             XMLElement *node;
@@ -88,12 +95,11 @@ DeleteObjectVersionsResult& DeleteObjectVersionsResult::operator =(const std::st
                 if (sub_node && sub_node->GetText()) {
                     object.setDeleteMarkerVersionId(sub_node->GetText());
                 }
-                deletedObjects_.push_back(object);
+                deletedObjects_.push_back(std::move(object));
             }
         }
         parseDone_ = true;
     }
-    return *this;
 }
 
 bool DeleteObjectVersionsResult::Quiet() const
@@ -77,17 +77,26 @@ void DeleteObjectsRequest::setRequestPayer(RequestPayer value)
 
 std::string DeleteObjectsRequest::payload() const
 {
-    std::stringstream ss;
-    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
-    ss << "<Delete>" << std::endl;
-    ss << "  <Quiet>" << (quiet_ ? "true":"false") << "</Quiet>" << std::endl;
+    //the body is sized up front, up to 1000 keys are written per request
+    size_t size = 96;
     for (auto const &key : keyList_) {
-    ss << "  <Object>" << std::endl << ""; 
-    ss << "    <Key>" << XmlEscape(key) << "</Key>" << std::endl;
-    ss << "  </Object>" << std::endl;
+        size += key.size() + 40;
     }
-    ss << "</Delete>" << std::endl;
-    return ss.str();
+
+    std::string body;
+    body.reserve(size);
+    body.append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    body.append("<Delete>\n");
+    body.append("  <Quiet>").append(quiet_ ? "true" : "false").append("</Quiet>\n");
+    for (auto const &key : keyList_) {
+        body.append("  <Object>\n");
+        body.append("    <Key>");
+        XmlEscapeAppend(body, key);
+        body.append("</Key>\n");
+        body.append("  </Object>\n");
+    }
+    body.append("</Delete>\n");
+    return body;
 }
 
 ParameterCollection DeleteObjectsRequest::specialParameters() const
@@ -17,6 +17,7 @@
 #include <alibabacloud/oss/model/DeleteObjectsResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -38,22 +39,28 @@ DeleteObjectsResult::DeleteObjectsResult(const std::string& result) :
 DeleteObjectsResult::DeleteObjectsResult(const std::shared_ptr<std::iostream>& result) :
     DeleteObjectsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 DeleteObjectsResult& DeleteObjectsResult::operator =(const std::string& result)
 {
-    if (result.empty()) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void DeleteObjectsResult::parse(XmlDocument& doc)
+{
+    if (doc.Empty()) {
         quiet_ = true;
         parseDone_ = true;
-        return *this;
+        return;
     }
 
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("DeleteResult", root->Name(), 12)) {
             XMLElement *node;
@@ -73,7 +80,6 @@ DeleteObjectsResult& DeleteObjectsResult::operator =(const std::string& result)
         }
         parseDone_ = true;
     }
-    return *this;
 }
 
 bool DeleteObjectsResult::Quiet() const
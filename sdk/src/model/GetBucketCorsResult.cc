@@ -19,6 +19,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketCorsResult::GetBucketCorsResult(const std::string& result):
 GetBucketCorsResult::GetBucketCorsResult(const std::shared_ptr<std::iostream>& result):
     GetBucketCorsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketCorsResult& GetBucketCorsResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketCorsResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("CORSConfiguration", root->Name(), 17)) {
             XMLElement *rule_node = root->FirstChildElement("CORSRule");
@@ -69,10 +76,9 @@ GetBucketCorsResult& GetBucketCorsResult::operator =(const std::string& result)
                     if (!strncmp(node->Name(), "MaxAgeSeconds", 13))
                         if (node->GetText()) rule.setMaxAgeSeconds(std::atoi(node->GetText()));
                 }
-                ruleList_.push_back(rule);
+                ruleList_.push_back(std::move(rule));
             }
             parseDone_ = true;
         }
     }
-    return *this;
 }
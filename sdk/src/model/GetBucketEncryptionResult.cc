@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketEncryptionResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketEncryptionResult::GetBucketEncryptionResult(const std::string& result)
 GetBucketEncryptionResult::GetBucketEncryptionResult(const std::shared_ptr<std::iostream>& result) :
     GetBucketEncryptionResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketEncryptionResult& GetBucketEncryptionResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketEncryptionResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("ServerSideEncryptionRule", root->Name(), 24)) {
             XMLElement* node;
@@ -62,5 +69,4 @@ GetBucketEncryptionResult& GetBucketEncryptionResult::operator =(const std::stri
             parseDone_ = true;
         }
     }
-    return *this;
 }
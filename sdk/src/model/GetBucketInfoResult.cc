@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketInfoResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -39,16 +40,22 @@ GetBucketInfoResult::GetBucketInfoResult(const std::string& result):
 GetBucketInfoResult::GetBucketInfoResult(const std::shared_ptr<std::iostream>& result):
     GetBucketInfoResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketInfoResult& GetBucketInfoResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketInfoResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("BucketInfo", root->Name(), 10)) {
             XMLElement *node;
@@ -115,5 +122,4 @@ GetBucketInfoResult& GetBucketInfoResult::operator =(const std::string& result)
             parseDone_ = true;
         }
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketInventoryConfigurationResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -35,16 +36,22 @@ GetBucketInventoryConfigurationResult::GetBucketInventoryConfigurationResult(con
 GetBucketInventoryConfigurationResult::GetBucketInventoryConfigurationResult(const std::shared_ptr<std::iostream>& result) :
     GetBucketInventoryConfigurationResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketInventoryConfigurationResult& GetBucketInventoryConfigurationResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketInventoryConfigurationResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("InventoryConfiguration", root->Name(), 22)) {
             XMLElement* node;
@@ -124,5 +131,4 @@ GetBucketInventoryConfigurationResult& GetBucketInventoryConfigurationResult::op
             parseDone_ = true;
         }
     }
-    return *this;
 }
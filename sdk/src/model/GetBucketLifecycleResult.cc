@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketLifecycleResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketLifecycleResult::GetBucketLifecycleResult(const std::string& result):
 GetBucketLifecycleResult::GetBucketLifecycleResult(const std::shared_ptr<std::iostream>& result):
     GetBucketLifecycleResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketLifecycleResult& GetBucketLifecycleResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketLifecycleResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("LifecycleConfiguration", root->Name(), 22)) {
             XMLElement *rule_node = root->FirstChildElement("Rule");
@@ -167,5 +174,4 @@ GetBucketLifecycleResult& GetBucketLifecycleResult::operator =(const std::string
 		    parseDone_ = true;
 		}
     }
-    return *this;
 }
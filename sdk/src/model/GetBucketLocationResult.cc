@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketLocationResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketLocationResult::GetBucketLocationResult(const std::string& result):
 GetBucketLocationResult::GetBucketLocationResult(const std::shared_ptr<std::iostream>& result):
     GetBucketLocationResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketLocationResult& GetBucketLocationResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketLocationResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("LocationConstraint", root->Name(), 18)) {
             if (root->GetText()) 
@@ -54,5 +61,4 @@ GetBucketLocationResult& GetBucketLocationResult::operator =(const std::string&
 		    parseDone_ = true;
 		}
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketLoggingResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketLoggingResult::GetBucketLoggingResult(const std::string& result):
 GetBucketLoggingResult::GetBucketLoggingResult(const std::shared_ptr<std::iostream>& result):
     GetBucketLoggingResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketLoggingResult& GetBucketLoggingResult::operator=(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketLoggingResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("BucketLoggingStatus", root->Name(), 19)) {
             XMLElement *log_node;
@@ -61,5 +68,4 @@ GetBucketLoggingResult& GetBucketLoggingResult::operator=(const std::string& res
             parseDone_ = true;
 		}
     }
-    return *this;
 }
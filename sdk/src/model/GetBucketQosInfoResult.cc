@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketQosInfoResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -36,16 +37,22 @@ GetBucketQosInfoResult::GetBucketQosInfoResult(const std::string& result) :
 GetBucketQosInfoResult::GetBucketQosInfoResult(const std::shared_ptr<std::iostream>& result) :
     GetBucketQosInfoResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketQosInfoResult& GetBucketQosInfoResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketQosInfoResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("QoSConfiguration", root->Name(), 16)) {
             XMLElement* node;
@@ -88,5 +95,4 @@ GetBucketQosInfoResult& GetBucketQosInfoResult::operator =(const std::string& re
             parseDone_ = true;
         }
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketRefererResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketRefererResult::GetBucketRefererResult(const std::string& result):
 GetBucketRefererResult::GetBucketRefererResult(const std::shared_ptr<std::iostream>& result):
     GetBucketRefererResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketRefererResult& GetBucketRefererResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketRefererResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("RefererConfiguration", root->Name(), 20)) {
             XMLElement *node;
@@ -63,5 +70,4 @@ GetBucketRefererResult& GetBucketRefererResult::operator =(const std::string& re
 		    parseDone_ = true;
 		}
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketStatResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -49,16 +50,22 @@ GetBucketStatResult::GetBucketStatResult(const std::string& result):
 GetBucketStatResult::GetBucketStatResult(const std::shared_ptr<std::iostream>& result):
     GetBucketStatResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketStatResult& GetBucketStatResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketStatResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("BucketStat", root->Name(), 10)) {
             XMLElement *node;
@@ -105,6 +112,5 @@ GetBucketStatResult& GetBucketStatResult::operator =(const std::string& result)
 
 		}
     }
-    return *this;
 }
 
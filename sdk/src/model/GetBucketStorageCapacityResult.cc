@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketStorageCapacityResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,16 +37,22 @@ GetBucketStorageCapacityResult::GetBucketStorageCapacityResult(const std::string
 GetBucketStorageCapacityResult::GetBucketStorageCapacityResult(const std::shared_ptr<std::iostream>& result):
     GetBucketStorageCapacityResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketStorageCapacityResult& GetBucketStorageCapacityResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketStorageCapacityResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("BucketUserQos", root->Name(), 13)) {
             XMLElement *node = root->FirstChildElement("StorageCapacity");
@@ -54,5 +61,4 @@ GetBucketStorageCapacityResult& GetBucketStorageCapacityResult::operator =(const
             parseDone_ = true;
         }
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketTaggingResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -35,16 +36,22 @@ GetBucketTaggingResult::GetBucketTaggingResult(const std::string& result) :
 GetBucketTaggingResult::GetBucketTaggingResult(const std::shared_ptr<std::iostream>& result) :
     GetBucketTaggingResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketTaggingResult& GetBucketTaggingResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketTaggingResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("Tagging", root->Name(), 7)) {
             XMLElement* tagSet_node = root->FirstChildElement("TagSet");
@@ -70,6 +77,5 @@ GetBucketTaggingResult& GetBucketTaggingResult::operator =(const std::string& re
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
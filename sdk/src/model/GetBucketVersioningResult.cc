@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/GetBucketVersioningResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -37,16 +38,22 @@ GetBucketVersioningResult::GetBucketVersioningResult(const std::string& result):
 GetBucketVersioningResult::GetBucketVersioningResult(const std::shared_ptr<std::iostream>& result):
     GetBucketVersioningResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketVersioningResult& GetBucketVersioningResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketVersioningResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("VersioningConfiguration", root->Name(), 23)) {
             XMLElement *node;
@@ -57,6 +64,5 @@ GetBucketVersioningResult& GetBucketVersioningResult::operator =(const std::stri
             parseDone_ = true;
 		}
     }
-    return *this;
 }
 
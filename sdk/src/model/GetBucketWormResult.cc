@@ -17,6 +17,7 @@
 
 #include <alibabacloud/oss/model/GetBucketWormResult.h>
 #include <tinyxml2/tinyxml2.h>
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -35,16 +36,22 @@ GetBucketWormResult::GetBucketWormResult(const std::string& result):
 GetBucketWormResult::GetBucketWormResult(const std::shared_ptr<std::iostream>& result):
     GetBucketWormResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetBucketWormResult& GetBucketWormResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetBucketWormResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("WormConfiguration", root->Name(), 17)) {
             XMLElement *node;
@@ -63,5 +70,4 @@ GetBucketWormResult& GetBucketWormResult::operator =(const std::string& result)
             parseDone_ = true;
         }
     }
-    return *this;
 }
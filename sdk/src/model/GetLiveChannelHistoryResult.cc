@@ -20,6 +20,7 @@
 #include <tinyxml2/tinyxml2.h>
 #include <sstream>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -38,16 +39,22 @@ GetLiveChannelHistoryResult::GetLiveChannelHistoryResult(const std::string& resu
 GetLiveChannelHistoryResult::GetLiveChannelHistoryResult(const std::shared_ptr<std::iostream>& result):
     GetLiveChannelHistoryResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetLiveChannelHistoryResult& GetLiveChannelHistoryResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetLiveChannelHistoryResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("LiveChannelHistory", root->Name(), 18)) {
             XMLElement *node;
@@ -70,12 +77,11 @@ GetLiveChannelHistoryResult& GetLiveChannelHistoryResult::operator =(const std::
                 {
                     rec.remoteAddr = node->GetText();
                 }
-                recordList_.push_back(rec);
+                recordList_.push_back(std::move(rec));
             }
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
 const LiveRecordVec& GetLiveChannelHistoryResult::LiveRecordList() const
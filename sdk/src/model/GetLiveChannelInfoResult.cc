@@ -20,6 +20,7 @@
 #include <tinyxml2/tinyxml2.h>
 #include <sstream>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -40,16 +41,22 @@ GetLiveChannelInfoResult::GetLiveChannelInfoResult(const std::string& result):
 GetLiveChannelInfoResult::GetLiveChannelInfoResult(const std::shared_ptr<std::iostream>& result):
     GetLiveChannelInfoResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetLiveChannelInfoResult& GetLiveChannelInfoResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetLiveChannelInfoResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("LiveChannelConfiguration", root->Name(), 24)) {
             XMLElement *node;
@@ -96,7 +103,6 @@ GetLiveChannelInfoResult& GetLiveChannelInfoResult::operator =(const std::string
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
 const std::string& GetLiveChannelInfoResult::Description() const
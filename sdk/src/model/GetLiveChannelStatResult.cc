@@ -20,6 +20,7 @@
 #include <tinyxml2/tinyxml2.h>
 #include <sstream>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -44,16 +45,22 @@ GetLiveChannelStatResult::GetLiveChannelStatResult(const std::string& result):
 GetLiveChannelStatResult::GetLiveChannelStatResult(const std::shared_ptr<std::iostream>& result):
     GetLiveChannelStatResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetLiveChannelStatResult& GetLiveChannelStatResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetLiveChannelStatResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("LiveChannelStat", root->Name(), 15)) {
             XMLElement *node;
@@ -126,7 +133,6 @@ GetLiveChannelStatResult& GetLiveChannelStatResult::operator =(const std::string
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
 LiveChannelStatus GetLiveChannelStatResult::Status() const
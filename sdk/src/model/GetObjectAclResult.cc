@@ -19,6 +19,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,24 +37,30 @@ GetObjectAclResult::GetObjectAclResult(const std::string& result):
 GetObjectAclResult::GetObjectAclResult(const std::shared_ptr<std::iostream>& result):
     GetObjectAclResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetObjectAclResult::GetObjectAclResult(const HeaderCollection& headers, const std::shared_ptr<std::iostream>& result) :
     OssObjectResult(headers)
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetObjectAclResult& GetObjectAclResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetObjectAclResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("AccessControlPolicy", root->Name(), 19)) {
             XMLElement *node;
@@ -82,6 +89,5 @@ GetObjectAclResult& GetObjectAclResult::operator =(const std::string& result)
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
@@ -19,6 +19,7 @@
 #include <tinyxml2/tinyxml2.h>
 #include <sstream> 
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -37,16 +38,22 @@ GetUserQosInfoResult::GetUserQosInfoResult(const std::string& result) :
 GetUserQosInfoResult::GetUserQosInfoResult(const std::shared_ptr<std::iostream>& result) :
     GetUserQosInfoResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 GetUserQosInfoResult& GetUserQosInfoResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void GetUserQosInfoResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("QoSConfiguration", root->Name(), 16)) {
             XMLElement* node;
@@ -93,5 +100,4 @@ GetUserQosInfoResult& GetUserQosInfoResult::operator =(const std::string& result
             parseDone_ = true;
         }
     }
-    return *this;
 }
@@ -19,6 +19,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -36,17 +37,23 @@ InitiateMultipartUploadResult::InitiateMultipartUploadResult(const std::string&
 InitiateMultipartUploadResult::InitiateMultipartUploadResult(const std::shared_ptr<std::iostream>& result):
     InitiateMultipartUploadResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 InitiateMultipartUploadResult& InitiateMultipartUploadResult::operator =(
     const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void InitiateMultipartUploadResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("InitiateMultipartUploadResult", root->Name(), 29)) {
             XMLElement *node;
@@ -69,5 +76,4 @@ InitiateMultipartUploadResult& InitiateMultipartUploadResult::operator =(
             parseDone_ = true;
 		}
     }
-    return *this;
 }
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/ListBucketInventoryConfigurationsResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -35,16 +36,22 @@ ListBucketInventoryConfigurationsResult::ListBucketInventoryConfigurationsResult
 ListBucketInventoryConfigurationsResult::ListBucketInventoryConfigurationsResult(const std::shared_ptr<std::iostream>& result) :
     ListBucketInventoryConfigurationsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 ListBucketInventoryConfigurationsResult& ListBucketInventoryConfigurationsResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void ListBucketInventoryConfigurationsResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root = doc.RootElement();
         if (root && !std::strncmp("ListInventoryConfigurationsResult", root->Name(), 33)) {
             XMLElement* node;
@@ -129,7 +136,7 @@ ListBucketInventoryConfigurationsResult& ListBucketInventoryConfigurationsResult
                     inventoryConfiguration.setOptionalFields(field);
                 }
 
-                inventoryConfigurationList_.push_back(inventoryConfiguration);
+                inventoryConfigurationList_.push_back(std::move(inventoryConfiguration));
             }
 
             node = root->FirstChildElement("IsTruncated");
@@ -141,5 +148,4 @@ ListBucketInventoryConfigurationsResult& ListBucketInventoryConfigurationsResult
             parseDone_ = true;
         }
     }
-    return *this;
 }
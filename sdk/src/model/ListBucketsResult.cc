@@ -20,6 +20,7 @@
 #include <alibabacloud/oss/model/Bucket.h>
 #include <alibabacloud/oss/model/Owner.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -42,16 +43,22 @@ ListBucketsResult::ListBucketsResult(const std::string& result):
 ListBucketsResult::ListBucketsResult(const std::shared_ptr<std::iostream>& result):
     ListBucketsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 ListBucketsResult& ListBucketsResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void ListBucketsResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("ListAllMyBucketsResult", root->Name(), 22)) {
             XMLElement *node;
@@ -107,7 +114,7 @@ ListBucketsResult& ListBucketsResult::operator =(const std::string& result)
                     if (node && node->GetText()) bucket.storageClass_ = ToStorageClassType(node->GetText());
 
                     bucket.owner_ = owner;
-                    buckets_.push_back(bucket);
+                    buckets_.push_back(std::move(bucket));
                 }
             }
         }
@@ -115,6 +122,5 @@ ListBucketsResult& ListBucketsResult::operator =(const std::string& result)
         //TODO check the result and the parse flag;
         parseDone_ = true;
     }
-    return *this;
 }
 
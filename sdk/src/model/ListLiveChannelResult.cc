@@ -21,6 +21,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <sstream>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -38,16 +39,22 @@ ListLiveChannelResult::ListLiveChannelResult(const std::string& result):
 ListLiveChannelResult::ListLiveChannelResult(const std::shared_ptr<std::iostream>& result):
     ListLiveChannelResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 ListLiveChannelResult& ListLiveChannelResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void ListLiveChannelResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("ListLiveChannelResult", root->Name(), 21)) {
             XMLElement *node;
@@ -128,12 +135,11 @@ ListLiveChannelResult& ListLiveChannelResult::operator =(const std::string& resu
                         info.playUrl = node->GetText();
                     }
                 }
-                liveChannelList_.push_back(info);
+                liveChannelList_.push_back(std::move(info));
             }
             parseDone_ = true;
         }
     }
-    return *this;
 }
 
 const std::string& ListLiveChannelResult::Marker() const
@@ -20,6 +20,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 using std::stringstream;
@@ -42,17 +43,23 @@ ListMultipartUploadsResult::ListMultipartUploadsResult(
     const std::shared_ptr<std::iostream>& result):
     ListMultipartUploadsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(
     const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void ListMultipartUploadsResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("ListMultipartUploadsResult", root->Name(), 26)) {
             XMLElement *node;
@@ -134,10 +141,9 @@ ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(
                 {
                     rec.Initiated = node->GetText();
                 }
-                multipartUploadList_.push_back(rec);
+                multipartUploadList_.push_back(std::move(rec));
             }
             parseDone_ = true;
 		}
     }
-    return *this;
 }
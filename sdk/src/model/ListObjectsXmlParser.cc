@@ -0,0 +1,422 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ListObjectsXmlParser.h"
+#include <cstring>
+#include "../utils/Utils.h"
+
+using namespace AlibabaCloud::OSS;
+
+ListResultXmlParser::ListResultXmlParser(const char *rootName, const std::string &encodingType) :
+    useUrlDecode_(IsUrlEncoding(encodingType)),
+    urlEncodingRequested_(useUrlDecode_),
+    parser_(this),
+    rootName_(rootName),
+    rootMatched_(false),
+    index_(0),
+    delivered_(0)
+{
+}
+
+void ListResultXmlParser::reset()
+{
+    parser_.reset();
+    rootMatched_ = false;
+    useUrlDecode_ = urlEncodingRequested_;
+    entry_.clear();
+    index_ = 0;
+    clearResult();
+}
+
+bool ListResultXmlParser::parse(const std::string &data)
+{
+    parser_.feed(data.c_str(), data.size());
+    return finish();
+}
+
+bool ListResultXmlParser::parse(std::istream &stream)
+{
+    parser_.feed(stream);
+    return finish();
+}
+
+bool ListResultXmlParser::finish()
+{
+    if (!parser_.finish()) {
+        return false;
+    }
+    if (rootMatched_) {
+        finishResult();
+    }
+    return true;
+}
+
+std::shared_ptr<std::iostream> ListResultXmlParser::createStream()
+{
+    return std::make_shared<XmlSaxStream>(&parser_);
+}
+
+void ListResultXmlParser::onStartElement(const std::string &name, size_t depth)
+{
+    if (depth == 1) {
+        rootMatched_ = (name == rootName_);
+    }
+    else if (depth == 2 && rootMatched_) {
+        entry_ = name;
+        ownerId_.clear();
+        ownerName_.clear();
+        onStartEntry(name);
+    }
+}
+
+void ListResultXmlParser::onEndElement(const std::string &name, size_t depth, std::string &text)
+{
+    if (!rootMatched_) {
+        return;
+    }
+
+    switch (depth)
+    {
+    case 2:
+        if (name == "EncodingType") {
+            useUrlDecode_ = urlEncodingRequested_ || IsUrlEncoding(text);
+        }
+        onField(name, text);
+        break;
+    case 3:
+        onEntryField(entry_, name, text);
+        break;
+    case 4:
+        if (name == "ID") {
+            ownerId_ = std::move(text);
+        }
+        else if (name == "DisplayName") {
+            ownerName_ = std::move(text);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+bool ListResultXmlParser::shouldDeliver()
+{
+    //skip the summaries already delivered by the previous attempt
+    if (index_++ < delivered_) {
+        return false;
+    }
+    delivered_++;
+    return true;
+}
+
+void ListResultXmlParser::decode(std::string &text) const
+{
+    if (useUrlDecode_) {
+        text = UrlDecode(text);
+    }
+}
+
+bool ListResultXmlParser::IsUrlEncoding(const std::string &type)
+{
+    return !ToLower(type.c_str()).compare(0, 3, "url", 3);
+}
+
+size_t ListResultXmlParser::ReserveSize(int maxKeys)
+{
+    if (maxKeys <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(maxKeys > 1000 ? 1000 : maxKeys);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ListObjectsXmlParser::ListObjectsXmlParser(ListObjectsResult *result, const ObjectSummaryHandler &handler,
+    const std::string &encodingType) :
+    ListResultXmlParser("ListBucketResult", encodingType),
+    result_(result),
+    handler_(handler)
+{
+}
+
+void ListObjectsXmlParser::clearResult()
+{
+    *result_ = ListObjectsResult();
+}
+
+void ListObjectsXmlParser::finishResult()
+{
+    if (useUrlDecode_) {
+        decode(result_->delimiter_);
+        decode(result_->marker_);
+        decode(result_->nextMarker_);
+        decode(result_->prefix_);
+    }
+    result_->parseDone_ = true;
+}
+
+void ListObjectsXmlParser::onStartEntry(const std::string &name)
+{
+    if (name == "Contents") {
+        summary_ = ObjectSummary();
+        summary_.size_ = 0;
+    }
+}
+
+void ListObjectsXmlParser::onEntryField(const std::string &entry, const std::string &name, std::string &text)
+{
+    if (entry == "Contents") {
+        if (name == "Key") { decode(text); summary_.key_ = std::move(text); }
+        else if (name == "LastModified") summary_.lastModified_ = std::move(text);
+        else if (name == "ETag") summary_.eTag_ = TrimQuotes(text.c_str());
+        else if (name == "Size") summary_.size_ = std::atoll(text.c_str());
+        else if (name == "StorageClass") summary_.storageClass_ = std::move(text);
+        else if (name == "Type") summary_.type_ = std::move(text);
+        else if (name == "Owner") summary_.owner_ = Owner(ownerId_, ownerName_);
+        else if (name == "RestoreInfo") summary_.restoreInfo_ = std::move(text);
+    }
+    else if (entry == "CommonPrefixes" && name == "Prefix") {
+        decode(text);
+        result_->commonPrefixes_.push_back(std::move(text));
+    }
+}
+
+void ListObjectsXmlParser::onField(const std::string &name, std::string &text)
+{
+    if (name == "Contents") {
+        if (!handler_) {
+            result_->objectSummarys_.push_back(std::move(summary_));
+        }
+        else if (shouldDeliver()) {
+            handler_(summary_);
+        }
+    }
+    else if (name == "Name") result_->name_ = std::move(text);
+    else if (name == "Prefix") result_->prefix_ = std::move(text);
+    else if (name == "Marker") result_->marker_ = std::move(text);
+    else if (name == "Delimiter") result_->delimiter_ = std::move(text);
+    else if (name == "MaxKeys") {
+        result_->maxKeys_ = std::atoi(text.c_str());
+        if (!handler_) {
+            result_->objectSummarys_.reserve(ReserveSize(result_->maxKeys_));
+        }
+    }
+    else if (name == "IsTruncated") result_->isTruncated_ = !std::strncmp("true", text.c_str(), 4);
+    else if (name == "NextMarker") result_->nextMarker_ = std::move(text);
+    else if (name == "EncodingType") {
+        result_->encodingType_ = std::move(text);
+        //entries received before the encoding type are decoded now, unless the request set it
+        if (!urlEncodingRequested_) {
+            for (auto &summary : result_->objectSummarys_) decode(summary.key_);
+            for (auto &prefix : result_->commonPrefixes_) decode(prefix);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ListObjectsV2XmlParser::ListObjectsV2XmlParser(ListObjectsV2Result *result, const ObjectSummaryHandler &handler,
+    const std::string &encodingType) :
+    ListResultXmlParser("ListBucketResult", encodingType),
+    result_(result),
+    handler_(handler)
+{
+}
+
+void ListObjectsV2XmlParser::clearResult()
+{
+    *result_ = ListObjectsV2Result();
+}
+
+void ListObjectsV2XmlParser::finishResult()
+{
+    if (useUrlDecode_) {
+        decode(result_->delimiter_);
+        decode(result_->startAfter_);
+        decode(result_->prefix_);
+    }
+    result_->parseDone_ = true;
+}
+
+void ListObjectsV2XmlParser::onStartEntry(const std::string &name)
+{
+    if (name == "Contents") {
+        summary_ = ObjectSummary();
+        summary_.size_ = 0;
+    }
+}
+
+void ListObjectsV2XmlParser::onEntryField(const std::string &entry, const std::string &name, std::string &text)
+{
+    if (entry == "Contents") {
+        if (name == "Key") { decode(text); summary_.key_ = std::move(text); }
+        else if (name == "LastModified") summary_.lastModified_ = std::move(text);
+        else if (name == "ETag") summary_.eTag_ = TrimQuotes(text.c_str());
+        else if (name == "Size") summary_.size_ = std::atoll(text.c_str());
+        else if (name == "StorageClass") summary_.storageClass_ = std::move(text);
+        else if (name == "Type") summary_.type_ = std::move(text);
+        else if (name == "Owner") summary_.owner_ = Owner(ownerId_, ownerName_);
+        else if (name == "RestoreInfo") summary_.restoreInfo_ = std::move(text);
+    }
+    else if (entry == "CommonPrefixes" && name == "Prefix") {
+        decode(text);
+        result_->commonPrefixes_.push_back(std::move(text));
+    }
+}
+
+void ListObjectsV2XmlParser::onField(const std::string &name, std::string &text)
+{
+    if (name == "Contents") {
+        if (!handler_) {
+            result_->objectSummarys_.push_back(std::move(summary_));
+        }
+        else if (shouldDeliver()) {
+            handler_(summary_);
+        }
+    }
+    else if (name == "Name") result_->name_ = std::move(text);
+    else if (name == "Prefix") result_->prefix_ = std::move(text);
+    else if (name == "StartAfter") result_->startAfter_ = std::move(text);
+    else if (name == "ContinuationToken") result_->continuationToken_ = std::move(text);
+    else if (name == "NextContinuationToken") result_->nextContinuationToken_ = std::move(text);
+    else if (name == "Delimiter") result_->delimiter_ = std::move(text);
+    else if (name == "MaxKeys") {
+        result_->maxKeys_ = std::atoi(text.c_str());
+        if (!handler_) {
+            result_->objectSummarys_.reserve(ReserveSize(result_->maxKeys_));
+        }
+    }
+    else if (name == "KeyCount") result_->keyCount_ = std::atoi(text.c_str());
+    else if (name == "IsTruncated") result_->isTruncated_ = !std::strncmp("true", text.c_str(), 4);
+    else if (name == "EncodingType") {
+        result_->encodingType_ = std::move(text);
+        if (!urlEncodingRequested_) {
+            for (auto &summary : result_->objectSummarys_) decode(summary.key_);
+            for (auto &prefix : result_->commonPrefixes_) decode(prefix);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+ListObjectVersionsXmlParser::ListObjectVersionsXmlParser(ListObjectVersionsResult *result,
+    const ObjectVersionSummaryHandler &versionHandler,
+    const DeleteMarkerSummaryHandler &deleteMarkerHandler,
+    const std::string &encodingType) :
+    ListResultXmlParser("ListVersionsResult", encodingType),
+    result_(result),
+    versionHandler_(versionHandler),
+    deleteMarkerHandler_(deleteMarkerHandler)
+{
+}
+
+void ListObjectVersionsXmlParser::clearResult()
+{
+    *result_ = ListObjectVersionsResult();
+}
+
+void ListObjectVersionsXmlParser::finishResult()
+{
+    if (useUrlDecode_) {
+        decode(result_->delimiter_);
+        decode(result_->keyMarker_);
+        decode(result_->nextKeyMarker_);
+        decode(result_->prefix_);
+    }
+    result_->parseDone_ = true;
+}
+
+void ListObjectVersionsXmlParser::onStartEntry(const std::string &name)
+{
+    if (name == "Version") {
+        version_ = ObjectVersionSummary();
+        version_.size_ = 0;
+        version_.isLatest_ = false;
+    }
+    else if (name == "DeleteMarker") {
+        deleteMarker_ = DeleteMarkerSummary();
+        deleteMarker_.isLatest_ = false;
+    }
+}
+
+void ListObjectVersionsXmlParser::onEntryField(const std::string &entry, const std::string &name, std::string &text)
+{
+    if (entry == "Version") {
+        if (name == "Key") { decode(text); version_.key_ = std::move(text); }
+        else if (name == "VersionId") version_.versionid_ = std::move(text);
+        else if (name == "IsLatest") version_.isLatest_ = !std::strncmp("true", text.c_str(), 4);
+        else if (name == "LastModified") version_.lastModified_ = std::move(text);
+        else if (name == "ETag") version_.eTag_ = TrimQuotes(text.c_str());
+        else if (name == "Size") version_.size_ = std::atoll(text.c_str());
+        else if (name == "StorageClass") version_.storageClass_ = std::move(text);
+        else if (name == "Type") version_.type_ = std::move(text);
+        else if (name == "Owner") version_.owner_ = Owner(ownerId_, ownerName_);
+    }
+    else if (entry == "DeleteMarker") {
+        if (name == "Key") { decode(text); deleteMarker_.key_ = std::move(text); }
+        else if (name == "VersionId") deleteMarker_.versionid_ = std::move(text);
+        else if (name == "IsLatest") deleteMarker_.isLatest_ = !std::strncmp("true", text.c_str(), 4);
+        else if (name == "LastModified") deleteMarker_.lastModified_ = std::move(text);
+        else if (name == "Owner") deleteMarker_.owner_ = Owner(ownerId_, ownerName_);
+    }
+    else if (entry == "CommonPrefixes" && name == "Prefix") {
+        decode(text);
+        result_->commonPrefixes_.push_back(std::move(text));
+    }
+}
+
+void ListObjectVersionsXmlParser::onField(const std::string &name, std::string &text)
+{
+    //versions and delete markers are interleaved, so they share the delivered counter
+    if (name == "Version") {
+        if (!versionHandler_) {
+            result_->objectVersionSummarys_.push_back(std::move(version_));
+        }
+        else if (shouldDeliver()) {
+            versionHandler_(version_);
+        }
+    }
+    else if (name == "DeleteMarker") {
+        if (!deleteMarkerHandler_) {
+            result_->deleteMarkerSummarys_.push_back(std::move(deleteMarker_));
+        }
+        else if (shouldDeliver()) {
+            deleteMarkerHandler_(deleteMarker_);
+        }
+    }
+    else if (name == "Name") result_->name_ = std::move(text);
+    else if (name == "Prefix") result_->prefix_ = std::move(text);
+    else if (name == "KeyMarker") result_->keyMarker_ = std::move(text);
+    else if (name == "NextKeyMarker") result_->nextKeyMarker_ = std::move(text);
+    else if (name == "VersionIdMarker") result_->versionIdMarker_ = std::move(text);
+    else if (name == "NextVersionIdMarker") result_->nextVersionIdMarker_ = std::move(text);
+    else if (name == "Delimiter") result_->delimiter_ = std::move(text);
+    else if (name == "MaxKeys") {
+        result_->maxKeys_ = std::atoi(text.c_str());
+        if (!versionHandler_) {
+            result_->objectVersionSummarys_.reserve(ReserveSize(result_->maxKeys_));
+        }
+    }
+    else if (name == "IsTruncated") result_->isTruncated_ = !std::strncmp("true", text.c_str(), 4);
+    else if (name == "EncodingType") {
+        result_->encodingType_ = std::move(text);
+        if (!urlEncodingRequested_) {
+            for (auto &version : result_->objectVersionSummarys_) decode(version.key_);
+            for (auto &marker : result_->deleteMarkerSummarys_) decode(marker.key_);
+            for (auto &prefix : result_->commonPrefixes_) decode(prefix);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/model/ListObjectsResult.h>
+#include <alibabacloud/oss/model/ListObjectsV2Result.h>
+#include <alibabacloud/oss/model/ListObjectVersionsResult.h>
+#include "../utils/XmlSaxParser.h"
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * Streaming parser of the listing results. The response is parsed while it is received,
+    * summaries are either appended to the result or passed to a handler one by one.
+    * The parser can be reset for a retried request, summaries which were already passed
+    * to the handler are not passed again. The encoding type of the request decodes the keys
+    * from the start, the summaries passed to a handler may come before <EncodingType>.
+    */
+    class ListResultXmlParser : public XmlSaxParser::Handler
+    {
+    public:
+        virtual ~ListResultXmlParser() = default;
+        void reset();
+        bool parse(const std::string &data);
+        bool parse(std::istream &stream);
+        bool finish();
+        std::shared_ptr<std::iostream> createStream();
+
+        void onStartElement(const std::string &name, size_t depth) override;
+        void onEndElement(const std::string &name, size_t depth, std::string &text) override;
+
+    protected:
+        ListResultXmlParser(const char *rootName, const std::string &encodingType);
+        virtual void clearResult() = 0;
+        virtual void finishResult() = 0;
+        virtual void onStartEntry(const std::string &name) = 0;
+        virtual void onEntryField(const std::string &entry, const std::string &name, std::string &text) = 0;
+        virtual void onField(const std::string &name, std::string &text) = 0;
+        bool shouldDeliver();
+        void decode(std::string &text) const;
+        static bool IsUrlEncoding(const std::string &type);
+        static size_t ReserveSize(int maxKeys);
+
+        bool useUrlDecode_;
+        bool urlEncodingRequested_;
+        std::string ownerId_;
+        std::string ownerName_;
+    private:
+        XmlSaxParser parser_;
+        const char *rootName_;
+        bool rootMatched_;
+        std::string entry_;
+        size_t index_;
+        size_t delivered_;
+    };
+
+    class ListObjectsXmlParser : public ListResultXmlParser
+    {
+    public:
+        ListObjectsXmlParser(ListObjectsResult *result, const ObjectSummaryHandler &handler = nullptr,
+            const std::string &encodingType = "");
+    protected:
+        void clearResult() override;
+        void finishResult() override;
+        void onStartEntry(const std::string &name) override;
+        void onEntryField(const std::string &entry, const std::string &name, std::string &text) override;
+        void onField(const std::string &name, std::string &text) override;
+    private:
+        ListObjectsResult *result_;
+        ObjectSummaryHandler handler_;
+        ObjectSummary summary_;
+    };
+
+    class ListObjectsV2XmlParser : public ListResultXmlParser
+    {
+    public:
+        ListObjectsV2XmlParser(ListObjectsV2Result *result, const ObjectSummaryHandler &handler = nullptr,
+            const std::string &encodingType = "");
+    protected:
+        void clearResult() override;
+        void finishResult() override;
+        void onStartEntry(const std::string &name) override;
+        void onEntryField(const std::string &entry, const std::string &name, std::string &text) override;
+        void onField(const std::string &name, std::string &text) override;
+    private:
+        ListObjectsV2Result *result_;
+        ObjectSummaryHandler handler_;
+        ObjectSummary summary_;
+    };
+
+    class ListObjectVersionsXmlParser : public ListResultXmlParser
+    {
+    public:
+        ListObjectVersionsXmlParser(ListObjectVersionsResult *result,
+            const ObjectVersionSummaryHandler &versionHandler = nullptr,
+            const DeleteMarkerSummaryHandler &deleteMarkerHandler = nullptr,
+            const std::string &encodingType = "");
+    protected:
+        void clearResult() override;
+        void finishResult() override;
+        void onStartEntry(const std::string &name) override;
+        void onEntryField(const std::string &entry, const std::string &name, std::string &text) override;
+        void onField(const std::string &name, std::string &text) override;
+    private:
+        ListObjectVersionsResult *result_;
+        ObjectVersionSummaryHandler versionHandler_;
+        DeleteMarkerSummaryHandler deleteMarkerHandler_;
+        ObjectVersionSummary version_;
+        DeleteMarkerSummary deleteMarker_;
+    };
+}
+}
@@ -18,6 +18,7 @@
 #include <alibabacloud/oss/model/ListPartsResult.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
@@ -41,16 +42,22 @@ ListPartsResult::ListPartsResult(const std::string& result):
 ListPartsResult::ListPartsResult(const std::shared_ptr<std::iostream>& result):
     ListPartsResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 ListPartsResult& ListPartsResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void ListPartsResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("ListPartsResult", root->Name(), 15)) {
             XMLElement *node;
@@ -117,13 +124,12 @@ ListPartsResult& ListPartsResult::operator =(const std::string& result)
                 {
                     part.cRC64_ = std::strtoull(node->GetText(), nullptr, 10);
                 }
-                partList_.push_back(part);
+                partList_.push_back(std::move(part));
             }
         }
         //TODO check the result and the parse flag;
         parseDone_ = true;
     }
-    return *this;
 }
 
 const std::string& ListPartsResult::UploadId() const
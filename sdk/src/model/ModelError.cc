@@ -108,7 +108,9 @@ static const char * GetArgErrorMsg(const int code)
         "Object Tag value is invalid, it's length should be less than 256.",
         /*Resumable for wstring path -68*/
         "Only support wstring path in windows os.",
-        "The type of filePath and checkpointDir should be the same, either string or wstring."
+        "The type of filePath and checkpointDir should be the same, either string or wstring.",
+        /*SelectObject column decoder -70*/
+        "The column decoder only decodes csv output, the OutputFormat should be CSVOutputFormat."
     };
 
     int index = code - ARG_ERROR_START;
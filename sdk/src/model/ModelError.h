@@ -124,6 +124,9 @@ namespace OSS
     /*Resumable for wstring path*/
     const int ARG_ERROR_PATH_NOT_SUPPORT_WSTRING_TYPE = ARG_ERROR_BASE + 68;
     const int ARG_ERROR_PATH_NOT_SAME_TYPE = ARG_ERROR_BASE + 69;
+
+    /*SelectObject column decoder*/
+    const int ARG_ERROR_SELECT_OBJECT_COLUMN_DECODER_NOT_CSV = ARG_ERROR_BASE + 70;
 }
 }
 
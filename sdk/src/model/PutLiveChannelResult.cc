@@ -20,6 +20,7 @@
 #include <alibabacloud/oss/model/Bucket.h>
 #include <alibabacloud/oss/model/Owner.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -37,16 +38,22 @@ PutLiveChannelResult::PutLiveChannelResult(const std::string& result):
 PutLiveChannelResult::PutLiveChannelResult(const std::shared_ptr<std::iostream>& result):
     PutLiveChannelResult()
 {
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 PutLiveChannelResult& PutLiveChannelResult::operator =(const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void PutLiveChannelResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("CreateLiveChannelResult", root->Name(), 23)) {
             XMLElement *node;
@@ -63,7 +70,6 @@ PutLiveChannelResult& PutLiveChannelResult::operator =(const std::string& result
         }
         parseDone_ = true;
     }
-    return *this;
 }
 
 const std::string& PutLiveChannelResult::PublishUrl() const
@@ -0,0 +1,441 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <alibabacloud/oss/model/SelectObjectColumnDecoder.h>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include "SelectObjectRecordSplitter.h"
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char QUOTE = '"';
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+#if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_WIN32)
+#define SELECT_SWAR_DIGITS 1
+/* the value of 8 ascii digits, checks all of them are digits */
+bool ParseEightDigits(const char* data, uint64_t& value)
+{
+    uint64_t word;
+    memcpy(&word, data, 8);
+    if (((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+        0x3333333333333333ULL) {
+        return false;
+    }
+    word -= 0x3030303030303030ULL;
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+        (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    value = word;
+    return true;
+}
+#endif
+
+/* parses up to 18 digits, more digits do not fit in the fast path */
+bool ParseDigits(const char* data, size_t size, uint64_t& value)
+{
+    uint64_t v = 0;
+    size_t i = 0;
+#ifdef SELECT_SWAR_DIGITS
+    for (; i + 8 <= size; i += 8) {
+        uint64_t eight;
+        if (!ParseEightDigits(data + i, eight)) {
+            return false;
+        }
+        v = v * 100000000ULL + eight;
+    }
+#endif
+    for (; i < size; i++) {
+        if (!IsDigit(data[i])) {
+            return false;
+        }
+        v = v * 10 + static_cast<uint64_t>(data[i] - '0');
+    }
+    value = v;
+    return true;
+}
+
+bool ParseInt64(const char* data, size_t size, int64_t& value)
+{
+    bool negative = false;
+    if (size > 0 && (data[0] == '-' || data[0] == '+')) {
+        negative = data[0] == '-';
+        data++;
+        size--;
+    }
+    if (size == 0) {
+        return false;
+    }
+    if (size > 18) {
+        char buffer[32];
+        if (size > 19 || !IsDigit(data[0])) {
+            return false;
+        }
+        buffer[0] = negative ? '-' : '+';
+        memcpy(buffer + 1, data, size);
+        buffer[size + 1] = '\0';
+        char* stop = nullptr;
+        errno = 0;
+        long long v = strtoll(buffer, &stop, 10);
+        if (errno != 0 || stop != buffer + size + 1) {
+            return false;
+        }
+        value = static_cast<int64_t>(v);
+        return true;
+    }
+    uint64_t v;
+    if (!ParseDigits(data, size, v)) {
+        return false;
+    }
+    value = negative ? -static_cast<int64_t>(v) : static_cast<int64_t>(v);
+    return true;
+}
+
+bool ParseDoubleSlow(const char* data, size_t size, double& value)
+{
+    std::string buffer(data, size);
+    char* stop = nullptr;
+    value = strtod(buffer.c_str(), &stop);
+    return stop == buffer.c_str() + size;
+}
+
+/* mantissas of up to 15 digits scaled by up to 1e22 are exact, anything else goes to strtod */
+bool ParseDouble(const char* data, size_t size, double& value)
+{
+    static const double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char* p = data;
+    const char* end = data + size;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    for (; p < end && IsDigit(*p); p++, digits++) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    }
+    if (p < end && *p == '.') {
+        p++;
+        for (; p < end && IsDigit(*p); p++, digits++, exponent--) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        }
+    }
+    if (digits == 0) {
+        return ParseDoubleSlow(data, size, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negativeExponent = *p == '-';
+            p++;
+        }
+        int e = 0;
+        const char* expStart = p;
+        for (; p < end && IsDigit(*p) && e < 10000; p++) {
+            e = e * 10 + (*p - '0');
+        }
+        if (p == expStart) {
+            return false;
+        }
+        exponent += negativeExponent ? -e : e;
+    }
+    if (p != end || digits > 15 || exponent < -22 || exponent > 22) {
+        return ParseDoubleSlow(data, size, value);
+    }
+    double v = static_cast<double>(mantissa);
+    v = exponent < 0 ? v / powers[-exponent] : v * powers[exponent];
+    value = negative ? -v : v;
+    return true;
+}
+
+bool ParseFixed(const char* data, size_t size, int& value)
+{
+    uint64_t v;
+    if (!ParseDigits(data, size, v)) {
+        return false;
+    }
+    value = static_cast<int>(v);
+    return true;
+}
+
+/* days since 1970-01-01 of a proleptic gregorian date */
+int64_t DaysFromCivil(int64_t y, int64_t m, int64_t d)
+{
+    y -= m <= 2 ? 1 : 0;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+bool ParseTimestamp(const char* data, size_t size, int64_t& value)
+{
+    int year, month, day, hour = 0, minute = 0, second = 0;
+    if (size < 10 || data[4] != '-' || data[7] != '-' ||
+        !ParseFixed(data, 4, year) || !ParseFixed(data + 5, 2, month) || !ParseFixed(data + 8, 2, day) ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+    size_t i = 10;
+    int64_t micros = 0;
+    if (i < size && (data[i] == ' ' || data[i] == 'T')) {
+        if (size < 19 || data[13] != ':' || data[16] != ':' ||
+            !ParseFixed(data + 11, 2, hour) || !ParseFixed(data + 14, 2, minute) || !ParseFixed(data + 17, 2, second) ||
+            hour > 23 || minute > 59 || second > 60) {
+            return false;
+        }
+        i = 19;
+        if (i < size && data[i] == '.') {
+            int scale = 100000;
+            for (i++; i < size && IsDigit(data[i]); i++, scale /= 10) {
+                micros += (data[i] - '0') * scale;
+            }
+        }
+    }
+    if (i < size && data[i] == 'Z') {
+        i++;
+    }
+    if (i != size) {
+        return false;
+    }
+    int64_t seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    value = seconds * 1000000 + micros;
+    return true;
+}
+}
+
+void SelectColumn::clear()
+{
+    int64Values_.clear();
+    doubleValues_.clear();
+    stringData_.clear();
+    stringOffsets_.resize(1);
+    nulls_.clear();
+}
+
+SelectObjectColumnDecoder::SelectObjectColumnDecoder(const std::vector<SelectColumnType>& schema,
+    const SelectColumnBatchHandler& handler, size_t batchRows) :
+    handler_(handler),
+    batchRows_(batchRows > 0 ? batchRows : 1),
+    fieldDelimiter_(','),
+    recordDelimiter_("\n"),
+    skipHeader_(false),
+    rowCount_(0),
+    invalidValues_(0)
+{
+    for (auto type : schema) {
+        batch_.columns_.push_back(SelectColumn(type));
+    }
+}
+
+void SelectObjectColumnDecoder::reset(char fieldDelimiter, const std::string& recordDelimiter, bool skipHeader)
+{
+    for (auto& column : batch_.columns_) {
+        column.clear();
+    }
+    batch_.rowCount_ = 0;
+    fieldDelimiter_ = fieldDelimiter;
+    recordDelimiter_ = recordDelimiter.empty() ? "\n" : recordDelimiter;
+    skipHeader_ = skipHeader;
+    rowCount_ = 0;
+    invalidValues_ = 0;
+}
+
+void SelectObjectColumnDecoder::decode(const char* data, size_t size)
+{
+    const char* end = data + size;
+    while (data < end) {
+        data = decodeRecord(data, end);
+    }
+}
+
+void SelectObjectColumnDecoder::flush()
+{
+    if (batch_.rowCount_ > 0) {
+        if (handler_) {
+            handler_(batch_);
+        }
+        for (auto& column : batch_.columns_) {
+            column.clear();
+        }
+        batch_.rowCount_ = 0;
+    }
+}
+
+const char* SelectObjectColumnDecoder::decodeRecord(const char* data, const char* end)
+{
+    const size_t columns = batch_.columns_.size();
+    const char recordStart = recordDelimiter_[0];
+    const size_t recordSize = recordDelimiter_.size();
+    size_t column = 0;
+    const char* p = data;
+    bool last = false;
+    while (!last) {
+        const char* fieldStart = p;
+        const char* fieldEnd = nullptr;
+        bool quoted = false;
+        bool escaped = false;
+        if (p < end && *p == QUOTE) {
+            //a quoted field runs to the quote which is not doubled
+            const char* q = p + 1;
+            while (true) {
+                q = static_cast<const char*>(memchr(q, QUOTE, static_cast<size_t>(end - q)));
+                if (q == nullptr) {
+                    q = end;
+                    break;
+                }
+                if (q + 1 < end && q[1] == QUOTE) {
+                    escaped = true;
+                    q += 2;
+                    continue;
+                }
+                break;
+            }
+            quoted = true;
+            fieldStart = p + 1;
+            fieldEnd = q;
+            p = q < end ? q + 1 : end;
+        }
+
+        //the end of the field, a record delimiter of several bytes must match as a whole
+        const char* stop = p;
+        while (true) {
+            stop += SelectObjectRecordSplitter::FindEither(stop, static_cast<size_t>(end - stop), fieldDelimiter_, recordStart);
+            if (stop == end || *stop == fieldDelimiter_ ||
+                (static_cast<size_t>(end - stop) >= recordSize && memcmp(stop, recordDelimiter_.data(), recordSize) == 0)) {
+                break;
+            }
+            stop++;
+        }
+        if (fieldEnd == nullptr) {
+            fieldEnd = stop;
+        }
+
+        if (!skipHeader_ && column < columns) {
+            if (escaped) {
+                unquoted_.clear();
+                for (const char* c = fieldStart; c < fieldEnd; c++) {
+                    unquoted_.push_back(*c);
+                    if (*c == QUOTE) {
+                        c++;
+                    }
+                }
+                appendField(column, unquoted_.data(), unquoted_.size(), true);
+            }
+            else {
+                appendField(column, fieldStart, static_cast<size_t>(fieldEnd - fieldStart), quoted);
+            }
+        }
+        column++;
+
+        if (stop == end) {
+            p = end;
+            last = true;
+        }
+        else if (*stop == fieldDelimiter_) {
+            p = stop + 1;
+        }
+        else {
+            p = stop + recordSize;
+            last = true;
+        }
+    }
+
+    if (skipHeader_) {
+        skipHeader_ = false;
+        return p;
+    }
+    for (; column < columns; column++) {
+        appendNull(column);
+    }
+    batch_.rowCount_++;
+    rowCount_++;
+    if (batch_.rowCount_ >= batchRows_) {
+        flush();
+    }
+    return p;
+}
+
+void SelectObjectColumnDecoder::appendField(size_t column, const char* data, size_t size, bool quoted)
+{
+    auto& col = batch_.columns_[column];
+    bool valid = true;
+    switch (col.type_)
+    {
+    case SelectColumnType::String:
+        col.stringData_.append(data, size);
+        col.stringOffsets_.push_back(static_cast<uint32_t>(col.stringData_.size()));
+        col.nulls_.push_back(size == 0 && !quoted ? 1 : 0);
+        return;
+    case SelectColumnType::Int64:
+    {
+        int64_t value = 0;
+        valid = size > 0 && ParseInt64(data, size, value);
+        col.int64Values_.push_back(valid ? value : 0);
+        break;
+    }
+    case SelectColumnType::Double:
+    {
+        double value = 0.0;
+        valid = size > 0 && ParseDouble(data, size, value);
+        col.doubleValues_.push_back(valid ? value : 0.0);
+        break;
+    }
+    case SelectColumnType::Timestamp:
+    {
+        int64_t value = 0;
+        valid = size > 0 && ParseTimestamp(data, size, value);
+        col.int64Values_.push_back(valid ? value : 0);
+        break;
+    }
+    }
+    col.nulls_.push_back(valid ? 0 : 1);
+    if (!valid && size > 0) {
+        invalidValues_++;
+    }
+}
+
+void SelectObjectColumnDecoder::appendNull(size_t column)
+{
+    auto& col = batch_.columns_[column];
+    switch (col.type_)
+    {
+    case SelectColumnType::String:
+        col.stringOffsets_.push_back(static_cast<uint32_t>(col.stringData_.size()));
+        break;
+    case SelectColumnType::Double:
+        col.doubleValues_.push_back(0.0);
+        break;
+    default:
+        col.int64Values_.push_back(0);
+        break;
+    }
+    col.nulls_.push_back(1);
+}
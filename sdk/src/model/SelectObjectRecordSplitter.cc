@@ -0,0 +1,186 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SelectObjectRecordSplitter.h"
+#include <cstring>
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+const char QUOTE = '"';
+
+size_t FindByte(const char* data, size_t size, char a)
+{
+    auto p = static_cast<const char*>(memchr(data, a, size));
+    return p ? static_cast<size_t>(p - data) : size;
+}
+}
+
+size_t SelectObjectRecordSplitter::FindEither(const char* data, size_t size, char a, char b)
+{
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+    const uint64_t pa = ones * static_cast<uint8_t>(a);
+    const uint64_t pb = ones * static_cast<uint8_t>(b);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        uint64_t x = word ^ pa;
+        uint64_t y = word ^ pb;
+        if ((((x - ones) & ~x) | ((y - ones) & ~y)) & highs) {
+            break;
+        }
+    }
+    for (; i < size; i++) {
+        if (data[i] == a || data[i] == b) {
+            return i;
+        }
+    }
+    return size;
+}
+
+SelectObjectRecordSplitter::SelectObjectRecordSplitter(const std::string& delimiter, bool quoted,
+    const SelectRecordHandler& handler) :
+    delimiter_(delimiter.empty() ? "\n" : delimiter),
+    quoted_(quoted),
+    handler_(handler),
+    matched_(0),
+    inQuote_(false),
+    recordCount_(0),
+    skipped_(0)
+{
+}
+
+void SelectObjectRecordSplitter::feed(const char* data, size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    size_t first = 0;
+    size_t records = 0;
+    size_t last = scan(data, size, first, records);
+    if (records == 0) {
+        pending_.append(data, size);
+        return;
+    }
+
+    if (!pending_.empty()) {
+        //the first record started in an earlier piece of data
+        pending_.append(data, first);
+        deliver(pending_.data(), pending_.size(), 1);
+        pending_.clear();
+        data += first;
+        size -= first;
+        last -= first;
+        records--;
+    }
+    if (records > 0) {
+        deliver(data, last, records);
+    }
+    pending_.assign(data + last, size - last);
+}
+
+void SelectObjectRecordSplitter::finish()
+{
+    if (!pending_.empty()) {
+        deliver(pending_.data(), pending_.size(), 1);
+        pending_.clear();
+    }
+    matched_ = 0;
+    inQuote_ = false;
+}
+
+size_t SelectObjectRecordSplitter::scan(const char* data, size_t size, size_t& first, size_t& records, size_t limit)
+{
+    const char lead = delimiter_[0];
+    size_t last = 0;
+    size_t i = 0;
+    while (i < size && records < limit) {
+        if (matched_ > 0) {
+            if (data[i] == delimiter_[matched_]) {
+                i++;
+                if (++matched_ == delimiter_.size()) {
+                    matched_ = 0;
+                    if (records++ == 0) {
+                        first = i;
+                    }
+                    last = i;
+                }
+                continue;
+            }
+            matched_ = 0;
+        }
+
+        if (inQuote_) {
+            i += FindByte(data + i, size - i, QUOTE);
+            if (i < size) {
+                inQuote_ = false;
+                i++;
+            }
+            continue;
+        }
+
+        i += quoted_ ? FindEither(data + i, size - i, lead, QUOTE) : FindByte(data + i, size - i, lead);
+        if (i == size) {
+            break;
+        }
+        if (data[i] != lead) {
+            inQuote_ = true;
+            i++;
+            continue;
+        }
+        i++;
+        if (++matched_ == delimiter_.size()) {
+            matched_ = 0;
+            if (records++ == 0) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+    return last;
+}
+
+void SelectObjectRecordSplitter::deliver(const char* data, size_t size, size_t records)
+{
+    recordCount_ += records;
+    if (skipped_ > 0) {
+        if (skipped_ >= records) {
+            skipped_ -= records;
+            return;
+        }
+        //a batch starts at a record boundary, outside of any quote
+        size_t matched = matched_;
+        bool inQuote = inQuote_;
+        matched_ = 0;
+        inQuote_ = false;
+        size_t first = 0;
+        size_t count = 0;
+        size_t skip = scan(data, size, first, count, static_cast<size_t>(skipped_));
+        matched_ = matched;
+        inQuote_ = inQuote;
+        data += skip;
+        size -= skip;
+        records -= count;
+        skipped_ = 0;
+    }
+    if (handler_) {
+        handler_(data, size, records);
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <alibabacloud/oss/model/SelectObjectRequest.h>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * Splits the output of SelectObject into complete records as the frames arrive.
+    * Records which lie within one piece of data are delivered in place, only a record
+    * spanning two pieces is copied. For csv output the record delimiter is ignored
+    * inside a quoted field.
+    */
+    class SelectObjectRecordSplitter
+    {
+    public:
+        SelectObjectRecordSplitter(const std::string& delimiter, bool quoted, const SelectRecordHandler& handler);
+        void feed(const char* data, size_t size);
+        /* delivers the last record if it has no trailing delimiter */
+        void finish();
+        /* the first records are not delivered, an earlier attempt did. they are still counted */
+        void setSkippedRecords(uint64_t records) { skipped_ = records; }
+        uint64_t RecordCount() const { return recordCount_; }
+
+        /* position of the first byte equal to a or b, compares 8 bytes at a time */
+        static size_t FindEither(const char* data, size_t size, char a, char b);
+
+    private:
+        size_t scan(const char* data, size_t size, size_t& first, size_t& records, size_t limit = SIZE_MAX);
+        void deliver(const char* data, size_t size, size_t records);
+
+        std::string delimiter_;
+        bool quoted_;
+        SelectRecordHandler handler_;
+        size_t matched_;
+        bool inQuote_;
+        std::string pending_;
+        uint64_t recordCount_;
+        uint64_t skipped_;
+    };
+}
+}
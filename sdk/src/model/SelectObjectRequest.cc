@@ -23,6 +23,7 @@
 #include "../utils/LogUtils.h"
 #include "../utils/Crc32.h"
 #include "../utils/StreamBuf.h"
+#include "SelectObjectRecordSplitter.h"
 
 #define FRAME_HEADER_LEN   (12+8)
 
@@ -46,9 +47,15 @@ struct SelectObjectFrame {
 class SelectObjectStreamBuf : public StreamBufProxy
 {
 public:
-    SelectObjectStreamBuf(std::iostream& stream, int initCrc32) :
+    SelectObjectStreamBuf(std::iostream& stream, int initCrc32,
+        bool framed = true, std::shared_ptr<SelectObjectRecordSplitter> splitter = nullptr) :
         StreamBufProxy(stream), 
-        lastStatus_(0)
+        lastStatus_(0),
+        framed_(framed),
+        splitter_(splitter),
+        endReceived_(false),
+        scannedBytes_(0),
+        endStatus_(0)
     {
         // init frame
         frame_.init_crc32 = initCrc32;
@@ -63,6 +70,20 @@ public:
         return lastStatus_;
     }
 
+    /* delivers the last record, once the whole output is known to be received */
+    void finish()
+    {
+        if (splitter_ != nullptr && (!framed_ || endReceived_)) {
+            splitter_->finish();
+        }
+    }
+
+    bool EndReceived() const { return endReceived_; }
+    uint64_t ScannedBytes() const { return scannedBytes_; }
+    int EndStatus() const { return endStatus_; }
+    const std::string& EndMessage() const { return endMessage_; }
+    uint64_t RecordCount() const { return splitter_ != nullptr ? splitter_->RecordCount() : 0; }
+
 protected:
     int selectObjectDepackFrame(const char *ptr, int len, int *frame_type, int *payload_len, char **payload_buf, SelectObjectFrame *frame)
     {
@@ -136,6 +157,11 @@ protected:
             switch (frame_type)
             {
             case 0x800001:
+                if (splitter_ != nullptr) {
+                    splitter_->feed(payload_buf, payload_len);
+                    result += payload_len;
+                    break;
+                }
                 int temp;
                 temp = static_cast<int>(StreamBufProxy::xsputn(payload_buf, payload_len));
                 if (temp < 0) {
@@ -150,7 +176,7 @@ protected:
                 int32_t copy = sizeof(frame->end_frame) - frame->end_frame_size;
                 copy = (copy > payload_len) ? payload_len : copy;
                 if (copy > 0) {
-                    memcpy(frame->end_frame + frame->end_frame_size, ptr, copy);
+                    memcpy(frame->end_frame + frame->end_frame_size, payload_buf, copy);
                     frame->end_frame_size += copy;
                 }
             }
@@ -169,6 +195,10 @@ protected:
                         return -1;
                     }
 
+                    if (frame->header[1] == 0x80 && frame->header[2] == 0x00 && frame->header[3] == 0x05) {
+                        parseEndFrame(frame);
+                    }
+
                     // reset to get next frame
                     frame->header_len = 0;
                     frame->tail_len = 0;
@@ -183,8 +213,32 @@ protected:
         return result;
     }
 
+    //Total Scanned Bytes | Http Status Code | Error Message
+    //<----8 bytes------> <--4 bytes-----> <variable>
+    void parseEndFrame(const SelectObjectFrame *frame)
+    {
+        if (frame->end_frame_size < 12) {
+            return;
+        }
+        scannedBytes_ = 0;
+        for (int i = 0; i < 8; i++) {
+            scannedBytes_ = (scannedBytes_ << 8) | frame->end_frame[i];
+        }
+        uint32_t status = 0;
+        for (int i = 8; i < 12; i++) {
+            status = (status << 8) | frame->end_frame[i];
+        }
+        endStatus_ = static_cast<int>(status);
+        endMessage_.assign(reinterpret_cast<const char *>(frame->end_frame) + 12, frame->end_frame_size - 12);
+        endReceived_ = true;
+    }
+
     std::streamsize xsputn(const char *ptr, std::streamsize count)
     {
+        if (!framed_) {
+            splitter_->feed(ptr, static_cast<size_t>(count));
+            return count;
+        }
         int result = selectObjectTransferContent(&frame_, ptr, static_cast<int>(count));
         if (result < 0) {
             if (result == -1) {
@@ -198,6 +252,12 @@ protected:
 private:
     SelectObjectFrame frame_;
     int lastStatus_;
+    bool framed_;
+    std::shared_ptr<SelectObjectRecordSplitter> splitter_;
+    bool endReceived_;
+    uint64_t scannedBytes_;
+    int endStatus_;
+    std::string endMessage_;
 };
 
 /////////////////////////////////////////////////////////////
@@ -210,7 +270,8 @@ SelectObjectRequest::SelectObjectRequest(const std::string& bucket, const std::s
     inputFormat_(nullptr),
     outputFormat_(nullptr),
     streamBuffer_(nullptr),
-    upperContent_(nullptr)
+    upperContent_(nullptr),
+    recordCount_(0)
 {
     setResponseStreamFactory(ResponseStreamFactory());
 
@@ -225,9 +286,37 @@ void SelectObjectRequest::setResponseStreamFactory(const IOStreamFactory& factor
 {
     upperResponseStreamFactory_ = factory;
     ServiceRequest::setResponseStreamFactory([this]() {
+        //the buffer of the previous attempt is only left when the request is retried
+        bool retried = streamBuffer_ != nullptr;
+        uint64_t delivered = retried ? std::static_pointer_cast<SelectObjectStreamBuf>(streamBuffer_)->RecordCount() : 0;
         streamBuffer_ = nullptr;
         auto content = upperResponseStreamFactory_();
-        if (!outputFormat_->OutputRawData()) {
+        if (recordHandler_ || columnDecoder_) {
+            //csv output quotes the fields which contain the delimiters
+            bool csv = outputFormat_->Type() == "csv";
+            const std::string& delimiter = csv ?
+                static_cast<const CSVOutputFormat *>(outputFormat_)->RecordDelimiter() :
+                static_cast<const JSONOutputFormat *>(outputFormat_)->RecordDelimiter();
+            SelectRecordHandler handler = recordHandler_;
+            if (columnDecoder_) {
+                const std::string& fieldDelimiter = static_cast<const CSVOutputFormat *>(outputFormat_)->FieldDelimiter();
+                if (!retried) {
+                    columnDecoder_->reset(fieldDelimiter.empty() ? ',' : fieldDelimiter[0], delimiter, outputFormat_->OutputHeader());
+                }
+                auto decoder = columnDecoder_;
+                auto recordHandler = recordHandler_;
+                handler = [decoder, recordHandler](const char* data, size_t size, size_t records) {
+                    if (recordHandler) {
+                        recordHandler(data, size, records);
+                    }
+                    decoder->decode(data, size);
+                };
+            }
+            auto splitter = std::make_shared<SelectObjectRecordSplitter>(delimiter, csv, handler);
+            splitter->setSkippedRecords(delivered);
+            streamBuffer_ = std::make_shared<SelectObjectStreamBuf>(*content, 0, !outputFormat_->OutputRawData(), splitter);
+        }
+        else if (!outputFormat_->OutputRawData()) {
             int initCrc32 = 0;
 #ifdef ENABLE_OSS_TEST
             if (!!(Flags() & 0x20000000)) {
@@ -248,6 +337,16 @@ uint64_t SelectObjectRequest::MaxSkippedRecordsAllowed() const
     return maxSkippedRecordsAllowed_;
 }
 
+void SelectObjectRequest::setRecordHandler(const SelectRecordHandler& handler)
+{
+    recordHandler_ = handler;
+}
+
+void SelectObjectRequest::setColumnDecoder(const std::shared_ptr<SelectObjectColumnDecoder>& decoder)
+{
+    columnDecoder_ = decoder;
+}
+
 void SelectObjectRequest::setSkippedRecords(bool skipPartialDataRecord, uint64_t maxSkippedRecords)
 {
     skipPartialDataRecord_ = skipPartialDataRecord;
@@ -296,6 +395,9 @@ int SelectObjectRequest::validate() const
     if (inputFormat_->Type() != outputFormat_->Type()) {
         return ARG_ERROR_SELECT_OBJECT_PROCESS_NOT_SAME;
     }
+    if (columnDecoder_ && outputFormat_->Type() != "csv") {
+        return ARG_ERROR_SELECT_OBJECT_COLUMN_DECODER_NOT_CSV;
+    }
     return 0;
 }
 
@@ -321,9 +423,20 @@ std::string SelectObjectRequest::payload() const
 int SelectObjectRequest::dispose() const
 {
     int ret = 0;
+    endFrame_ = SelectObjectEndFrame();
+    recordCount_ = 0;
     if (streamBuffer_ != nullptr) {
         auto buf = std::static_pointer_cast<SelectObjectStreamBuf>(streamBuffer_);
+        buf->finish();
         ret = buf->LastStatus();
+        endFrame_.received_ = buf->EndReceived();
+        endFrame_.scannedBytes_ = buf->ScannedBytes();
+        endFrame_.status_ = buf->EndStatus();
+        endFrame_.errorMessage_ = buf->EndMessage();
+        recordCount_ = buf->RecordCount();
+        if (columnDecoder_) {
+            columnDecoder_->flush();
+        }
         streamBuffer_ = nullptr;
     }
     upperContent_ = nullptr;
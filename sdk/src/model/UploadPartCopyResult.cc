@@ -19,6 +19,7 @@
 #include <alibabacloud/oss/model/Owner.h>
 #include <tinyxml2/tinyxml2.h>
 #include "../utils/Utils.h"
+#include "../utils/XmlDocument.h"
 using namespace AlibabaCloud::OSS;
 using namespace tinyxml2;
 
@@ -42,17 +43,23 @@ UploadPartCopyResult::UploadPartCopyResult(const std::shared_ptr<std::iostream>&
         sourceVersionId_ = headers.at("x-oss-copy-source-version-id");
     }
 
-    std::istreambuf_iterator<char> isb(*result.get()), end;
-    std::string str(isb, end);
-    *this = str;
+    XmlDocument doc;
+    doc.Load(*result);
+    parse(doc);
 }
 
 UploadPartCopyResult& UploadPartCopyResult::operator =(
     const std::string& result)
 {
-    XMLDocument doc;
-    XMLError xml_err;
-    if ((xml_err = doc.Parse(result.c_str(), result.size())) == XML_SUCCESS) {
+    XmlDocument doc;
+    doc.Load(result);
+    parse(doc);
+    return *this;
+}
+
+void UploadPartCopyResult::parse(XmlDocument& doc)
+{
+    if (doc.ErrorID() == XML_SUCCESS) {
         XMLElement* root =doc.RootElement();
         if (root && !std::strncmp("CopyPartResult", root->Name(), 14)) {
             XMLElement *node;
@@ -69,7 +76,6 @@ UploadPartCopyResult& UploadPartCopyResult::operator =(
             parseDone_ = true;
 		}
     }
-    return *this;
 }
 
 const std::string& UploadPartCopyResult::LastModified() const
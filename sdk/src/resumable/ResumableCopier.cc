@@ -23,6 +23,7 @@
 #include <alibabacloud/oss/Const.h>
 #include "../utils/Utils.h"
 #include "../utils/LogUtils.h"
+#include "../utils/LockProfiler.h"
 #include "../utils/FileSystemUtils.h"
 #include "../external/json/json.h"
 //#include "OssClientImpl.h"
@@ -53,7 +54,8 @@ CopyObjectOutcome ResumableCopier::Copy()
             Part part;
             while (true) {
                 {
-                std::lock_guard<std::mutex> lck(lock_);
+                std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                ProfiledLock(lck, LockSite::ResumableWorker);
                 if (partsToUploadCopy.empty())
                     break;
                 part = partsToUploadCopy.front();
@@ -91,7 +93,8 @@ CopyObjectOutcome ResumableCopier::Copy()
 
                 //lock
                 {
-                    std::lock_guard<std::mutex> lck(lock_);
+                    std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                    ProfiledLock(lck, LockSite::ResumableWorker);
                     if (outcome.isSuccess()) {
                         part.eTag_ = outcome.result().ETag();
                         partsCopied.push_back(part);
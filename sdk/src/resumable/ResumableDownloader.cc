@@ -18,9 +18,11 @@
 #include <algorithm>
 #include <set>
 #include <alibabacloud/oss/Const.h>
+#include <alibabacloud/oss/client/Metrics.h>
 #include "../utils/Utils.h"
 #include "../utils/Crc64.h"
 #include "../utils/LogUtils.h"
+#include "../utils/LockProfiler.h"
 #include "../utils/FileSystemUtils.h"
 #include "../external/json/json.h"
 //#include "OssClientImpl.h"
@@ -60,7 +62,8 @@ GetObjectOutcome ResumableDownloader::Download()
             PartRecord part;
             while (true) {
                 {
-                std::lock_guard<std::mutex> lck(lock_);
+                std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                ProfiledLock(lck, LockSite::ResumableWorker);
                 if (partsToDownload.empty())
                     break;
                 part = partsToDownload.front();
@@ -112,7 +115,8 @@ GetObjectOutcome ResumableDownloader::Download()
 
                 // lock
                 {
-                    std::lock_guard<std::mutex> lck(lock_);
+                    std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                    ProfiledLock(lck, LockSite::ResumableWorker);
                     if (outcome.isSuccess()) {
                         part.crc64 = std::strtoull(outcome.result().Metadata().HttpMetaData().at("x-oss-hash-crc64ecma-by-client").c_str(), nullptr, 10);
                         downloadedParts.push_back(part);
@@ -214,6 +218,9 @@ GetObjectOutcome ResumableDownloader::Download()
                 localCRC64 = CRC64::CombineCRC(localCRC64, downloadedParts[i].crc64, downloadedParts[i].size);
             }
             if (localCRC64 != meta.CRC64()) {
+                if (client_->configuration().metrics != nullptr) {
+                    client_->configuration().metrics->recordCrcFailure();
+                }
                 return GetObjectOutcome(OssError("CrcCheckError", "ResumableDownload object CRC checksum fail."));
             }
         }
@@ -484,7 +491,8 @@ void ResumableDownloader::DownloadPartProcessCallback(size_t increment, int64_t
     inc = std::max(inc, static_cast<int64_t>(0));
     increment = static_cast<size_t>(inc);
 
-    std::lock_guard<std::mutex> lck(downloader->lock_);
+    std::unique_lock<std::mutex> lck(downloader->lock_, std::defer_lock);
+    ProfiledLock(lck, LockSite::ResumableWorker);
     downloader->consumedSize_ += increment;
 
     auto process = downloader->request_.TransferProgress();
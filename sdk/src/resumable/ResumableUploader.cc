@@ -19,6 +19,7 @@
 #include <alibabacloud/oss/model/CompleteMultipartUploadRequest.h>
 #include <alibabacloud/oss/OssFwd.h>
 #include <alibabacloud/oss/Const.h>
+#include <alibabacloud/oss/client/Metrics.h>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
@@ -28,6 +29,7 @@
 #include "../utils/FileSystemUtils.h"
 #include "../utils/Utils.h"
 #include "../utils/LogUtils.h"
+#include "../utils/LockProfiler.h"
 #include "../utils/Crc64.h"
 #include "../OssClientImpl.h"
 #include "../model/ModelError.h"
@@ -85,7 +87,8 @@ PutObjectOutcome ResumableUploader::Upload()
             Part part;
             while (true) {
                 {
-                std::lock_guard<std::mutex> lck(lock_);
+                std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                ProfiledLock(lck, LockSite::ResumableWorker);
                 if (partsToUpload.empty())
                     break;
                 part = partsToUpload.front();
@@ -135,7 +138,8 @@ PutObjectOutcome ResumableUploader::Upload()
 
                 //lock
                 {
-                std::lock_guard<std::mutex> lck(lock_);
+                std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+                ProfiledLock(lck, LockSite::ResumableWorker);
                 uploadedParts.push_back(part);
                 outcomes.push_back(outcome);
                 }
@@ -201,6 +205,9 @@ PutObjectOutcome ResumableUploader::Upload()
 
     uint64_t ossCRC64 = outcome.result().CRC64();
     if (ossCRC64 != 0 && localCRC64 != ossCRC64) {
+        if (client_->configuration().metrics != nullptr) {
+            client_->configuration().metrics->recordCrcFailure();
+        }
         return PutObjectOutcome(OssError("CrcCheckError", "ResumableUpload Object CRC Checksum fail."));
     }
 
@@ -452,7 +459,8 @@ void ResumableUploader::UploadPartProcessCallback(size_t increment, int64_t tran
     inc = std::max(inc, static_cast<int64_t>(0));
     increment = static_cast<size_t>(inc);
 
-    std::lock_guard<std::mutex> lck(uploader->lock_);
+    std::unique_lock<std::mutex> lck(uploader->lock_, std::defer_lock);
+    ProfiledLock(lck, LockSite::ResumableWorker);
     uploader->consumedSize_ += increment;
 
     auto process = uploader->request_.TransferProgress();
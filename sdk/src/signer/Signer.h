@@ -18,6 +18,7 @@
 
 #include <string>
 #include <ctime>
+#include <memory>
 #include <alibabacloud/oss/Types.h>
 #include <alibabacloud/oss/auth/Credentials.h>
 #include <alibabacloud/oss/http/HttpRequest.h>
@@ -36,7 +37,18 @@ namespace OSS
                 product_(product),
                 bucket_(bucket),
                 key_(key),
-                credentials_(credentials),
+                credentials_(std::make_shared<const Credentials>(std::move(credentials))),
+                requestTime_(requestTime)
+        {}
+
+        SignerParam(std::string&& region, std::string&& product, 
+            std::string&& bucket, std::string&& key, 
+            std::shared_ptr<const Credentials>&& credentials, std::time_t requestTime):
+                region_(region),
+                product_(product),
+                bucket_(bucket),
+                key_(key),
+                credentials_(std::move(credentials)),
                 requestTime_(requestTime)
         {}
 
@@ -44,7 +56,7 @@ namespace OSS
     const std::string& Product() const { return product_; }
     const std::string& Bucket() const { return bucket_; }
     const std::string& Key() const { return key_; }
-    const Credentials& Cred() const { return credentials_; }
+    const Credentials& Cred() const { return *credentials_; }
     std::time_t RequestTime() const { return requestTime_; }
     const HeaderSet& AdditionalHeaders() const { return additionalHeaders_; }
     void setAdditionalHeaders(const HeaderSet& headers) { additionalHeaders_ = headers; }
@@ -60,7 +72,7 @@ namespace OSS
         std::string product_;
         std::string bucket_;
         std::string key_;
-        Credentials credentials_;
+        std::shared_ptr<const Credentials> credentials_;
         std::time_t requestTime_;
         HeaderSet additionalHeaders_;
         std::time_t expires_;
@@ -0,0 +1,290 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AsyncLogger.h"
+#include "LogUtils.h"
+#include "LockProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+    const uint32_t PAD_RECORD = 0xFFFFFFFF;
+    const int64_t DRAIN_INTERVAL_MS = 20;
+
+    struct RecordHeader
+    {
+        uint32_t size;      /* the whole record, 8 bytes aligned */
+        uint32_t length;    /* the message */
+        int64_t timeMs;
+        const char* tag;
+        int32_t level;
+        uint32_t reserved;
+    };
+
+    struct LogEntry
+    {
+        int64_t timeMs;
+        LogLevel level;
+        const char* tag;
+        const std::string* threadId;
+        std::string msg;
+    };
+
+    size_t AlignUp(size_t value)
+    {
+        return (value + 7) & ~static_cast<size_t>(7);
+    }
+}
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* single producer (the owning thread), single consumer (the drain under drainLock_) */
+    class LogRing
+    {
+    public:
+        LogRing(size_t capacity, uint64_t generation) :
+            buffer_(capacity),
+            head_(0),
+            tail_(0),
+            dropped_(0),
+            generation_(generation),
+            threadId_(CurrentThreadIdString())
+        {
+        }
+
+        bool push(LogLevel level, const char* tag, int64_t timeMs, const char* msg, size_t len)
+        {
+            const size_t capacity = buffer_.size();
+            len = (std::min)(len, capacity / 4);
+            const size_t recordSize = AlignUp(sizeof(RecordHeader) + len);
+            const uint64_t head = head_.load(std::memory_order_relaxed);
+            const uint64_t tail = tail_.load(std::memory_order_acquire);
+            size_t pos = static_cast<size_t>(head % capacity);
+            size_t skip = 0;
+            if (capacity - pos < recordSize) {
+                skip = capacity - pos;
+            }
+            if (capacity - static_cast<size_t>(head - tail) < skip + recordSize) {
+                dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            if (skip >= sizeof(RecordHeader)) {
+                RecordHeader pad = { PAD_RECORD, 0, 0, nullptr, 0, 0 };
+                std::memcpy(&buffer_[pos], &pad, sizeof(pad));
+            }
+            if (skip > 0) {
+                pos = 0;
+            }
+            RecordHeader header = { static_cast<uint32_t>(recordSize), static_cast<uint32_t>(len),
+                timeMs, tag, static_cast<int32_t>(level), 0 };
+            std::memcpy(&buffer_[pos], &header, sizeof(header));
+            std::memcpy(&buffer_[pos + sizeof(header)], msg, len);
+            head_.store(head + skip + recordSize, std::memory_order_release);
+            return true;
+        }
+
+        void drain(std::vector<LogEntry>& entries)
+        {
+            const size_t capacity = buffer_.size();
+            uint64_t tail = tail_.load(std::memory_order_relaxed);
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            while (tail < head) {
+                size_t pos = static_cast<size_t>(tail % capacity);
+                size_t contiguous = capacity - pos;
+                if (contiguous < sizeof(RecordHeader)) {
+                    tail += contiguous;
+                    continue;
+                }
+                RecordHeader header;
+                std::memcpy(&header, &buffer_[pos], sizeof(header));
+                if (header.size == PAD_RECORD) {
+                    tail += contiguous;
+                    continue;
+                }
+                LogEntry entry = { header.timeMs, static_cast<LogLevel>(header.level), header.tag, &threadId_,
+                    std::string(&buffer_[pos + sizeof(header)], header.length) };
+                entries.push_back(std::move(entry));
+                tail += header.size;
+            }
+            tail_.store(tail, std::memory_order_release);
+        }
+
+        bool empty() const
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+        }
+        uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+        uint64_t Generation() const { return generation_; }
+
+    private:
+        std::vector<char> buffer_;
+        std::atomic<uint64_t> head_;
+        std::atomic<uint64_t> tail_;
+        std::atomic<uint64_t> dropped_;
+        uint64_t generation_;
+        std::string threadId_;
+    };
+}
+}
+
+/* the ring of the calling thread, a new one is taken when the logger is restarted */
+static thread_local std::shared_ptr<LogRing> LocalRing;
+
+AsyncLogger& AsyncLogger::Instance()
+{
+    // never destroyed, logging threads may still hold a reference at exit
+    static AsyncLogger* instance = new AsyncLogger();
+    return *instance;
+}
+
+AsyncLogger::AsyncLogger() :
+    running_(false),
+    generation_(0),
+    ringSize_(0),
+    retiredDropped_(0),
+    stopRequested_(false)
+{
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+void AsyncLogger::start(size_t ringSize)
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    if (running_.load()) {
+        return;
+    }
+    ringSize_ = AlignUp((std::max)(ringSize, static_cast<size_t>(4096)));
+    generation_++;
+    {
+        std::lock_guard<std::mutex> wlck(waitLock_);
+        stopRequested_ = false;
+    }
+    worker_ = std::thread(&AsyncLogger::run, this);
+    running_.store(true);
+}
+
+void AsyncLogger::stop()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        if (!running_.load()) {
+            return;
+        }
+        running_.store(false);
+    }
+    {
+        std::lock_guard<std::mutex> wlck(waitLock_);
+        stopRequested_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    drainAll();
+}
+
+LogRing& AsyncLogger::localRing()
+{
+    auto generation = generation_.load();
+    if (LocalRing == nullptr || LocalRing->Generation() != generation) {
+        std::unique_lock<std::mutex> lck(lock_, std::defer_lock);
+        ProfiledLock(lck, LockSite::LogRegistry);
+        LocalRing = std::make_shared<LogRing>(ringSize_, generation);
+        rings_.push_back(LocalRing);
+    }
+    return *LocalRing;
+}
+
+bool AsyncLogger::push(LogLevel level, const char* tag, int64_t timeMs, const char* msg, size_t len)
+{
+    return localRing().push(level, tag, timeMs, msg, len);
+}
+
+void AsyncLogger::flush()
+{
+    drainAll();
+}
+
+uint64_t AsyncLogger::DroppedCount() const
+{
+    std::lock_guard<std::mutex> lck(lock_);
+    uint64_t dropped = retiredDropped_;
+    for (const auto& ring : rings_) {
+        dropped += ring->Dropped();
+    }
+    return dropped;
+}
+
+void AsyncLogger::run()
+{
+    std::unique_lock<std::mutex> wlck(waitLock_);
+    while (!stopRequested_) {
+        wlck.unlock();
+        drainAll();
+        wlck.lock();
+        cv_.wait_for(wlck, std::chrono::milliseconds(DRAIN_INTERVAL_MS), [this]() { return stopRequested_; });
+    }
+}
+
+void AsyncLogger::drainAll()
+{
+    std::lock_guard<std::mutex> dlck(drainLock_);
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        rings = rings_;
+    }
+
+    std::vector<LogEntry> entries;
+    for (const auto& ring : rings) {
+        ring->drain(entries);
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const LogEntry& a, const LogEntry& b) { return a.timeMs < b.timeMs; });
+
+    auto callback = GetLogCallbackInner();
+    if (callback != nullptr) {
+        std::string line;
+        for (const auto& entry : entries) {
+            line.clear();
+            AppendLogPrefix(line, entry.level, entry.tag, entry.timeMs, *entry.threadId);
+            line.append(entry.msg).append("\n");
+            callback(entry.level, line);
+        }
+    }
+
+    // forget the rings of the threads which are gone, or of an earlier start
+    std::lock_guard<std::mutex> lck(lock_);
+    auto generation = generation_.load();
+    auto it = std::remove_if(rings_.begin(), rings_.end(), [&](const std::shared_ptr<LogRing>& ring) {
+        bool retired = (ring.use_count() <= 2 || ring->Generation() != generation) && ring->empty();
+        if (retired) {
+            retiredDropped_ += ring->Dropped();
+        }
+        return retired;
+    });
+    rings_.erase(it, rings_.end());
+}
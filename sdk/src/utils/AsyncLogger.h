@@ -0,0 +1,72 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/Types.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    class LogRing;
+
+    /**
+    * Passes the log lines to the log callback from a background thread. Every logging thread
+    * has its own ring buffer, written without lock, the formatter thread drains the rings,
+    * orders the lines by time, adds the prefix and calls the callback. A line which doesn't
+    * fit into the ring of its thread is dropped and counted.
+    */
+    class AsyncLogger
+    {
+    public:
+        static AsyncLogger& Instance();
+
+        void start(size_t ringSize);
+        void stop();
+        bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+        /* false when the line is dropped */
+        bool push(LogLevel level, const char* tag, int64_t timeMs, const char* msg, size_t len);
+        void flush();
+        uint64_t DroppedCount() const;
+
+    private:
+        AsyncLogger();
+        ~AsyncLogger();
+        LogRing& localRing();
+        void run();
+        void drainAll();
+
+        std::atomic<bool> running_;
+        std::atomic<uint64_t> generation_;
+        size_t ringSize_;
+        mutable std::mutex lock_;
+        std::vector<std::shared_ptr<LogRing>> rings_;
+        uint64_t retiredDropped_;
+        std::mutex drainLock_;
+        std::mutex waitLock_;
+        std::condition_variable cv_;
+        bool stopRequested_;
+        std::thread worker_;
+    };
+}
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CpuAccounting.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+    const int STAGE_COUNT = static_cast<int>(CpuStage::Count);
+
+    struct CpuContext
+    {
+        CpuContext() : operation(nullptr), inOperation(false), stage(-1), start(0), mark(0) {}
+        /* of the running operation, or of the last one of the thread */
+        std::shared_ptr<MetricsRegistry> registry;
+        const char* operation;
+        bool inOperation;
+        int stage;
+        uint64_t start;
+        uint64_t mark;
+        uint64_t stageNanos[STAGE_COUNT];
+    };
+
+    thread_local CpuContext Context;
+
+    void BeginOperation(CpuContext& ctx, uint64_t now)
+    {
+        ctx.inOperation = true;
+        ctx.stage = -1;
+        ctx.start = now;
+        ctx.mark = now;
+        for (auto& nanos : ctx.stageNanos) {
+            nanos = 0;
+        }
+    }
+
+    void EndOperation(CpuContext& ctx, uint64_t now)
+    {
+        ctx.inOperation = false;
+        ctx.registry->recordCpu(ctx.operation, now - ctx.start, ctx.stageNanos);
+    }
+}
+
+uint64_t AlibabaCloud::OSS::ThreadCpuNanos()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        return 0;
+    }
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) * 100;
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+}
+
+CpuOperationScope::CpuOperationScope(const std::shared_ptr<MetricsRegistry>& metrics, const char* operation) :
+    active_(false)
+{
+    CpuContext& ctx = Context;
+    if (ctx.inOperation) {
+        return;
+    }
+    if (metrics == nullptr || !metrics->StageCpuEnabled()) {
+        if (ctx.registry != nullptr) {
+            ctx.registry.reset();
+        }
+        return;
+    }
+    ctx.registry = metrics;
+    ctx.operation = operation;
+    BeginOperation(ctx, ThreadCpuNanos());
+    active_ = true;
+}
+
+CpuOperationScope::~CpuOperationScope()
+{
+    if (!active_) {
+        return;
+    }
+    CpuContext& ctx = Context;
+    uint64_t now = ThreadCpuNanos();
+    if (ctx.stage >= 0) {
+        ctx.stageNanos[ctx.stage] += now - ctx.mark;
+    }
+    EndOperation(ctx, now);
+}
+
+CpuStageScope::CpuStageScope(CpuStage stage) :
+    active_(false),
+    outermost_(false),
+    previous_(-1)
+{
+    CpuContext& ctx = Context;
+    if (ctx.registry == nullptr) {
+        return;
+    }
+    uint64_t now = ThreadCpuNanos();
+    if (!ctx.inOperation) {
+        BeginOperation(ctx, now);
+        outermost_ = true;
+    }
+    else if (ctx.stage >= 0) {
+        ctx.stageNanos[ctx.stage] += now - ctx.mark;
+    }
+    previous_ = ctx.stage;
+    ctx.stage = static_cast<int>(stage);
+    ctx.mark = now;
+    active_ = true;
+}
+
+CpuStageScope::~CpuStageScope()
+{
+    if (!active_) {
+        return;
+    }
+    CpuContext& ctx = Context;
+    uint64_t now = ThreadCpuNanos();
+    ctx.stageNanos[ctx.stage] += now - ctx.mark;
+    ctx.stage = previous_;
+    ctx.mark = now;
+    if (outermost_) {
+        EndOperation(ctx, now);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <alibabacloud/oss/client/Metrics.h>
+#include <memory>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* the cpu time consumed by the calling thread */
+    uint64_t ThreadCpuNanos();
+
+    /**
+    * Accounts the thread cpu time of an operation to the registry when its stage cpu
+    * accounting is enabled. An operation started inside another one is part of the outer one.
+    */
+    class CpuOperationScope
+    {
+    public:
+        CpuOperationScope(const std::shared_ptr<MetricsRegistry>& metrics, const char* operation);
+        ~CpuOperationScope();
+    private:
+        CpuOperationScope(const CpuOperationScope&) = delete;
+        CpuOperationScope& operator=(const CpuOperationScope&) = delete;
+        bool active_;
+    };
+
+    /**
+    * Charges the thread cpu time spent in its lifetime to a stage of the current operation,
+    * or of the last operation of the thread when there is none. It costs a thread local
+    * check when the accounting is off.
+    */
+    class CpuStageScope
+    {
+    public:
+        explicit CpuStageScope(CpuStage stage);
+        ~CpuStageScope();
+    private:
+        CpuStageScope(const CpuStageScope&) = delete;
+        CpuStageScope& operator=(const CpuStageScope&) = delete;
+        bool active_;
+        bool outermost_;
+        int previous_;
+    };
+}
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LockProfiler.h"
+#include <atomic>
+
+using namespace AlibabaCloud::OSS;
+
+namespace
+{
+    /* one cache line per site, so that the sites don't contend on the counters */
+    struct alignas(64) SiteCounter
+    {
+        std::atomic<uint64_t> waits;
+        std::atomic<uint64_t> waitNanos;
+    };
+
+    const char* SiteNames[static_cast<int>(LockSite::Count)] = {
+        "CurlHandlePool",
+        "CurlHandleWait",
+        "CurlPoolGrow",
+        "HttpClientRetry",
+        "LogRegistry",
+        "LogCallback",
+        "ResumableWorker"
+    };
+
+    SiteCounter SiteCounters[static_cast<int>(LockSite::Count)];
+
+    std::atomic<bool> TimeCallbacks(false);
+}
+
+void LockProfiler::record(LockSite site, uint64_t waitNanos)
+{
+    SiteCounter& counter = SiteCounters[static_cast<int>(site)];
+    counter.waits.fetch_add(1, std::memory_order_relaxed);
+    counter.waitNanos.fetch_add(waitNanos, std::memory_order_relaxed);
+}
+
+std::vector<LockSiteStat> LockProfiler::snapshot()
+{
+    std::vector<LockSiteStat> stats;
+    for (int i = 0; i < static_cast<int>(LockSite::Count); i++) {
+        LockSiteStat stat;
+        stat.Name = SiteNames[i];
+        stat.Waits = SiteCounters[i].waits.load(std::memory_order_relaxed);
+        stat.WaitNanos = SiteCounters[i].waitNanos.load(std::memory_order_relaxed);
+        stats.push_back(stat);
+    }
+    return stats;
+}
+
+void LockProfiler::setCallbackTiming(bool enable)
+{
+    TimeCallbacks.store(enable, std::memory_order_relaxed);
+}
+
+bool LockProfiler::CallbackTiming()
+{
+    return TimeCallbacks.load(std::memory_order_relaxed);
+}
+
+void LockProfiler::reset()
+{
+    for (auto& counter : SiteCounters) {
+        counter.waits.store(0, std::memory_order_relaxed);
+        counter.waitNanos.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* the shared locks of the client whose waits are profiled */
+    enum class LockSite : int
+    {
+        CurlHandlePool = 0,   /* the queue lock of the curl handle pool */
+        CurlHandleWait,       /* blocked on an empty curl handle pool */
+        CurlPoolGrow,         /* growing the curl handle pool */
+        HttpClientRetry,      /* HttpClient::requestLock_ of the retry wait */
+        LogRegistry,          /* registering the ring of a thread to the async logger */
+        LogCallback,          /* in the synchronous log callback when callback timing is on,
+                                 every call is counted, the default callback serializes on std::cerr */
+        ResumableWorker,      /* the lock of a resumable upload, download or copy */
+        Count
+    };
+
+    struct LockSiteStat
+    {
+        std::string Name;
+        uint64_t Waits;
+        uint64_t WaitNanos;
+    };
+
+    /**
+    * Process wide counters of the time spent waiting on the shared locks. A lock is first
+    * tried, only a contended acquisition reads the clock and updates the counters, so the
+    * uncontended path costs nothing more than the lock itself.
+    */
+    class LockProfiler
+    {
+    public:
+        static void record(LockSite site, uint64_t waitNanos);
+        static std::vector<LockSiteStat> snapshot();
+        static void reset();
+        /* times every synchronous log callback, off by default as it reads the clock twice a line */
+        static void setCallbackTiming(bool enable);
+        static bool CallbackTiming();
+
+        static uint64_t NowNanos()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    };
+
+    /* locks a std::unique_lock constructed with std::defer_lock */
+    template <typename Lock>
+    inline void ProfiledLock(Lock& lck, LockSite site)
+    {
+        if (lck.try_lock()) {
+            return;
+        }
+        uint64_t start = LockProfiler::NowNanos();
+        lck.lock();
+        LockProfiler::record(site, LockProfiler::NowNanos() - start);
+    }
+}
+}
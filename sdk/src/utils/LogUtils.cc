@@ -16,6 +16,10 @@
 
 #include "Utils.h"
 #include "LogUtils.h"
+#include "AsyncLogger.h"
+#include "LockProfiler.h"
+#include "CpuAccounting.h"
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <cstdarg>
@@ -35,37 +39,47 @@ const static char *EnvLogLevels[] =
     "info", "debug", "trace", "all"
 };
 
-static std::string LogPrefix(LogLevel logLevel, const char* tag)
+static const char *LogStr[] = {"[OFF]", "[FATAL]", "[ERROR]", "[WARN]", "[INFO]" , "[DEBUG]", "[TRACE]", "[ALL]"};
+
+const std::string& AlibabaCloud::OSS::CurrentThreadIdString()
+{
+    static thread_local std::string threadId;
+    if (threadId.empty()) {
+        std::stringstream ss;
+        ss << std::this_thread::get_id();
+        threadId = ss.str();
+    }
+    return threadId;
+}
+
+void AlibabaCloud::OSS::AppendLogPrefix(std::string& out, LogLevel logLevel, const char* tag, int64_t timeMs, const std::string& threadId)
 {
-    static const char *LogStr[] = {"[OFF]", "[FATAL]", "[ERROR]", "[WARN]", "[INFO]" , "[DEBUG]", "[TRACE]", "[ALL]"};
-    int index = logLevel - LogLevel::LogOff;
-    std::stringstream ss;
-    auto tp = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-    auto ms = tp.time_since_epoch().count() % 1000;
-    auto t = std::chrono::system_clock::to_time_t(tp);
-    struct tm tm;
+    // localtime is only called when the second changes
+    static thread_local std::time_t cachedSecond = -1;
+    static thread_local char cachedTime[32];
+    std::time_t t = static_cast<std::time_t>(timeMs / 1000);
+    if (t != cachedSecond) {
+        struct tm tm;
 #ifdef WIN32
-    ::localtime_s(&tm, &t);
-#else
-    ::localtime_r(&t, &tm);
-#endif
-#if defined(__GNUG__) && __GNUC__ < 5
-    char tmbuff[64];
-    strftime(tmbuff, 64, "%Y-%m-%d %H:%M:%S.", &tm);
-    ss << "[" << tmbuff << std::setw(3) << std::setfill('0') << ms << "]";
+        ::localtime_s(&tm, &t);
 #else
-    ss << "[" << std::put_time(&tm, "%Y-%m-%d %H:%M:%S.") << std::setw(3) << std::setfill('0') << ms << "]";
+        ::localtime_r(&t, &tm);
 #endif
-    ss << LogStr[index];
-    ss << "[" << tag << "]";
-    ss << "[" << std::this_thread::get_id() << "]";
-    return ss.str();
+        strftime(cachedTime, sizeof(cachedTime), "[%Y-%m-%d %H:%M:%S.", &tm);
+        cachedSecond = t;
+    }
+    int ms = static_cast<int>(timeMs % 1000);
+    char msStr[5] = { static_cast<char>('0' + ms / 100), static_cast<char>('0' + ms / 10 % 10),
+        static_cast<char>('0' + ms % 10), ']', '\0' };
+    out.append(cachedTime).append(msStr);
+    out.append(LogStr[logLevel - LogLevel::LogOff]);
+    out.append("[").append(tag).append("]");
+    out.append("[").append(threadId).append("]");
 }
 
 void AlibabaCloud::OSS::FormattedLog(LogLevel logLevel, const char* tag, const char* fmt, ...)
 {
-    std::stringstream ss;
-    ss << LogPrefix(logLevel, tag);
+    CpuStageScope logStage(CpuStage::Log);
     char buffer[2050];
     int i = 0;
     va_list args;
@@ -77,14 +91,32 @@ void AlibabaCloud::OSS::FormattedLog(LogLevel logLevel, const char* tag, const c
 #endif
     va_end(args);
 
+    i = (std::max)(0, (std::min)(i, static_cast<int>(sizeof(buffer) - 2)));
     while (i > 0 && buffer[i - 1] == '\n') {
         i--;
-        buffer[i] = '\0';
+    }
+    buffer[i] = '\0';
+
+    auto timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    auto& asyncLogger = AsyncLogger::Instance();
+    if (asyncLogger.isRunning()) {
+        asyncLogger.push(logLevel, tag, static_cast<int64_t>(timeMs), buffer, static_cast<size_t>(i));
+        return;
     }
 
-    ss << buffer << std::endl;
-    if (gLogCallback) {
-        gLogCallback(logLevel, ss.str());
+    std::string line;
+    line.reserve(96 + static_cast<size_t>(i));
+    AppendLogPrefix(line, logLevel, tag, static_cast<int64_t>(timeMs), CurrentThreadIdString());
+    line.append(buffer, static_cast<size_t>(i)).append("\n");
+    auto callback = gLogCallback;
+    if (callback && LockProfiler::CallbackTiming()) {
+        uint64_t start = LockProfiler::NowNanos();
+        callback(logLevel, line);
+        LockProfiler::record(LockSite::LogCallback, LockProfiler::NowNanos() - start);
+    }
+    else if (callback) {
+        callback(logLevel, line);
     }
 }
 
@@ -114,10 +146,36 @@ void AlibabaCloud::OSS::SetLogCallbackInner(LogCallback callback)
     gLogCallback = callback;
 }
 
+void AlibabaCloud::OSS::SetAsyncLogInner(bool enable, size_t bufferSize)
+{
+    if (enable) {
+        AsyncLogger::Instance().start(bufferSize);
+    }
+    else {
+        AsyncLogger::Instance().stop();
+    }
+}
+
+void AlibabaCloud::OSS::FlushLogInner()
+{
+    if (AsyncLogger::Instance().isRunning()) {
+        AsyncLogger::Instance().flush();
+    }
+}
+
+uint64_t AlibabaCloud::OSS::GetDroppedLogCountInner()
+{
+    return AsyncLogger::Instance().DroppedCount();
+}
+
 void AlibabaCloud::OSS::InitLogInner()
 {
     gOssLogLevel = LogLevel::LogOff;
     gLogCallback = nullptr;
+    auto async = std::getenv("OSS_SDK_LOG_ASYNC");
+    if (async && Trim(async) == "1") {
+        SetAsyncLogInner(true, DEFAULT_ASYNC_LOG_BUFFER_SIZE);
+    }
     auto value = std::getenv("OSS_SDK_LOG_LEVEL");
     if (value) {
         auto level = ToLower(Trim(value).c_str());
@@ -134,6 +192,7 @@ void AlibabaCloud::OSS::InitLogInner()
 
 void AlibabaCloud::OSS::DeinitLogInner()
 {
+    SetAsyncLogInner(false, 0);
     gOssLogLevel = LogLevel::LogOff;
     gLogCallback = nullptr;
 }
@@ -29,7 +29,14 @@ namespace OSS
     void SetLogLevelInner(LogLevel level);
     void SetLogCallbackInner(LogCallback callback);
 
+    const size_t DEFAULT_ASYNC_LOG_BUFFER_SIZE = 256 * 1024;
+    void SetAsyncLogInner(bool enable, size_t bufferSize);
+    void FlushLogInner();
+    uint64_t GetDroppedLogCountInner();
+
     void FormattedLog(LogLevel logLevel, const char* tag, const char* formatStr, ...);
+    void AppendLogPrefix(std::string& out, LogLevel logLevel, const char* tag, int64_t timeMs, const std::string& threadId);
+    const std::string& CurrentThreadIdString();
 
 #ifdef DISABLE_OSS_LOGGING
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /* a read only stream over a buffer shared by several readers, each with its own position */
+    class SharedBufferStream : public std::iostream
+    {
+    public:
+        explicit SharedBufferStream(const std::shared_ptr<const std::string>& data) :
+            std::iostream(nullptr),
+            buf_(data)
+        {
+            rdbuf(&buf_);
+        }
+        const std::shared_ptr<const std::string>& data() const { return buf_.data(); }
+
+    private:
+        class SharedBuf : public std::streambuf
+        {
+        public:
+            explicit SharedBuf(const std::shared_ptr<const std::string>& data) : data_(data)
+            {
+                char* begin = const_cast<char*>(data_->data());
+                setg(begin, begin, begin + data_->size());
+            }
+            const std::shared_ptr<const std::string>& data() const { return data_; }
+
+        protected:
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in)) {
+                    return pos_type(off_type(-1));
+                }
+                off_type base = dir == std::ios_base::beg ? 0 :
+                    dir == std::ios_base::cur ? static_cast<off_type>(gptr() - eback()) : static_cast<off_type>(egptr() - eback());
+                return seekpos(pos_type(base + off), which);
+            }
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                off_type off = static_cast<off_type>(pos);
+                if (!(which & std::ios_base::in) || off < 0 || off > static_cast<off_type>(egptr() - eback())) {
+                    return pos_type(off_type(-1));
+                }
+                setg(eback(), eback() + off, egptr());
+                return pos;
+            }
+
+        private:
+            std::shared_ptr<const std::string> data_;
+        };
+        SharedBuf buf_;
+    };
+
+    /**
+    * Collects a response body into a buffer which can be shared when the body is complete.
+    * With a target stream the body is written to the target as well, and the buffer is only
+    * kept while it is not larger than limit. Moving back with seekp, as a broken transfer
+    * does, moves the target and truncates the buffer.
+    */
+    class SharedBufferSink : public std::iostream
+    {
+    public:
+        SharedBufferSink(const std::shared_ptr<std::iostream>& target, size_t limit) :
+            std::iostream(nullptr),
+            buf_(target, limit)
+        {
+            rdbuf(&buf_);
+        }
+        const std::shared_ptr<std::iostream>& target() const { return buf_.target(); }
+        /* nullptr once the body went over the limit */
+        std::shared_ptr<const std::string> data() const { return buf_.data(); }
+
+    private:
+        class SinkBuf : public std::streambuf
+        {
+        public:
+            SinkBuf(const std::shared_ptr<std::iostream>& target, size_t limit) :
+                target_(target),
+                targetStart_(target != nullptr ? target->tellp() : pos_type(0)),
+                limit_(limit),
+                data_(std::make_shared<std::string>()),
+                pos_(0)
+            {
+            }
+            const std::shared_ptr<std::iostream>& target() const { return target_; }
+            std::shared_ptr<const std::string> data() const { return data_; }
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize count) override
+            {
+                if (target_ != nullptr && !target_->write(s, count)) {
+                    return 0;
+                }
+                if (data_ != nullptr) {
+                    if (data_->size() + static_cast<size_t>(count) > limit_) {
+                        data_ = nullptr;
+                    }
+                    else {
+                        data_->append(s, static_cast<size_t>(count));
+                    }
+                }
+                pos_ += static_cast<uint64_t>(count);
+                return count;
+            }
+            int_type overflow(int_type c) override
+            {
+                if (traits_type::eq_int_type(c, traits_type::eof())) {
+                    return traits_type::not_eof(c);
+                }
+                char ch = traits_type::to_char_type(c);
+                return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+            }
+            int sync() override
+            {
+                return target_ != nullptr && !target_->flush() ? -1 : 0;
+            }
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                if (dir == std::ios_base::cur && off == 0 && (which & std::ios_base::out)) {
+                    return pos_type(static_cast<off_type>(pos_));
+                }
+                off_type base = dir == std::ios_base::beg ? 0 : static_cast<off_type>(pos_);
+                return seekpos(pos_type(base + off), which);
+            }
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                off_type off = static_cast<off_type>(pos);
+                if (!(which & std::ios_base::out) || off < 0 || off > static_cast<off_type>(pos_)) {
+                    return pos_type(off_type(-1));
+                }
+                if (target_ != nullptr) {
+                    if (targetStart_ == pos_type(off_type(-1)) || !target_->seekp(targetStart_ + off)) {
+                        return pos_type(off_type(-1));
+                    }
+                }
+                if (data_ != nullptr) {
+                    data_->resize(static_cast<size_t>(off));
+                }
+                pos_ = static_cast<uint64_t>(off);
+                return pos;
+            }
+
+        private:
+            std::shared_ptr<std::iostream> target_;
+            pos_type targetStart_;
+            size_t limit_;
+            std::shared_ptr<std::string> data_;
+            uint64_t pos_;
+        };
+        SinkBuf buf_;
+    };
+}
+}
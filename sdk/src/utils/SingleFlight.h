@@ -0,0 +1,115 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * The concurrent calls with the same key share the outcome of the first one. If the
+    * first call leaves fn without a value, by an exception, its waiters run their own fn,
+    * so the failure reaches them the way it reached the first caller.
+    */
+    template <typename T>
+    class SingleFlight
+    {
+    public:
+        SingleFlight() = default;
+
+        T run(const std::string& key, const std::function<T()>& fn)
+        {
+            std::unique_lock<std::mutex> lck(lock_);
+            auto it = calls_.find(key);
+            if (it != calls_.end()) {
+                auto call = it->second;
+                call->cv.wait(lck, [&call]() { return call->done; });
+                if (call->failed) {
+                    lck.unlock();
+                    return fn();
+                }
+                return call->value;
+            }
+            auto call = std::make_shared<Call>();
+            calls_[key] = call;
+            lck.unlock();
+
+            Finish finish(*this, key, call);
+            T value = fn();
+            finish.complete(value);
+            return value;
+        }
+
+    private:
+        struct Call
+        {
+            Call() : done(false), failed(false) {}
+            std::condition_variable cv;
+            bool done;
+            bool failed;
+            T value;
+        };
+
+        /* wakes the waiters when fn returns, or fails them when it is left early */
+        class Finish
+        {
+        public:
+            Finish(SingleFlight& flight, const std::string& key, const std::shared_ptr<Call>& call) :
+                flight_(flight), key_(key), call_(call), completed_(false) {}
+            ~Finish()
+            {
+                if (!completed_) {
+                    finish(nullptr);
+                }
+            }
+            void complete(const T& value)
+            {
+                completed_ = true;
+                finish(&value);
+            }
+
+        private:
+            void finish(const T* value)
+            {
+                {
+                    std::lock_guard<std::mutex> lck(flight_.lock_);
+                    if (value != nullptr) {
+                        call_->value = *value;
+                    }
+                    call_->failed = value == nullptr;
+                    call_->done = true;
+                    flight_.calls_.erase(key_);
+                }
+                call_->cv.notify_all();
+            }
+            SingleFlight& flight_;
+            const std::string& key_;
+            std::shared_ptr<Call> call_;
+            bool completed_;
+        };
+
+        std::mutex lock_;
+        std::unordered_map<std::string, std::shared_ptr<Call>> calls_;
+    };
+}
+}
@@ -182,41 +182,33 @@ std::string AlibabaCloud::OSS::Base64EncodeUrlSafe(const char *src, int len)
 
 std::string AlibabaCloud::OSS::XmlEscape(const std::string& value)
 {
-    struct Entity {
-        const char* pattern;
-        char value;
-    };
-
-    static const Entity entities[] = {
-        { "&quot;", '\"' },
-        { "&amp;",  '&'  },
-        { "&apos;", '\'' },
-        { "&lt;",	'<'  },
-        { "&gt;",	'>'  },
-        { "&#13;",	'\r' }
-    };
-
-    if (value.empty()) {
-        return value;
-    }
-
-    std::stringstream ss;
-    for (size_t i = 0; i < value.size(); i++) {
-        bool flag = false;
-        for (size_t j = 0; j < (sizeof(entities)/sizeof(entities[0])); j++) {
-            if (value[i] == entities[j].value) {
-                flag = true;
-                ss << entities[j].pattern;
-                break;
-            }
-        }
+    std::string out;
+    out.reserve(value.size());
+    XmlEscapeAppend(out, value);
+    return out;
+}
 
-        if (!flag) {
-            ss << value[i];
+void AlibabaCloud::OSS::XmlEscapeAppend(std::string& out, const std::string& value)
+{
+    const char* begin = value.data();
+    const char* end = begin + value.size();
+    const char* ptr = begin;
+    for (; ptr < end; ptr++) {
+        const char* pattern;
+        switch (*ptr) {
+        case '\"': pattern = "&quot;"; break;
+        case '&': pattern = "&amp;"; break;
+        case '\'': pattern = "&apos;"; break;
+        case '<': pattern = "&lt;"; break;
+        case '>': pattern = "&gt;"; break;
+        case '\r': pattern = "&#13;"; break;
+        default: continue;
         }
+        out.append(begin, ptr - begin);
+        out.append(pattern);
+        begin = ptr + 1;
     }
-
-    return ss.str();
+    out.append(begin, end - begin);
 }
 ByteBuffer AlibabaCloud::OSS::Base64Decode(const char *data, int len)
 {
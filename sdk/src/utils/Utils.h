@@ -47,6 +47,7 @@ namespace OSS
     std::string Base64EncodeUrlSafe(const char *src, int len);
 
     std::string XmlEscape(const std::string& value);
+    void XmlEscapeAppend(std::string& out, const std::string& value);
 
     ByteBuffer Base64Decode(const char *src, int len);
     ByteBuffer Base64Decode(const std::string &src);
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include "XmlDocument.h"
+#include "CpuAccounting.h"
+
+using namespace AlibabaCloud::OSS;
+using namespace tinyxml2;
+
+namespace
+{
+const std::streamsize XML_READ_CHUNK = 16 * 1024;
+
+std::streamsize RemainingSize(std::istream& stream)
+{
+    auto begin = stream.tellg();
+    if (begin == std::streampos(-1)) {
+        return -1;
+    }
+    stream.seekg(0, std::ios::end);
+    auto end = stream.tellg();
+    stream.seekg(begin);
+    if (end == std::streampos(-1) || !stream.good()) {
+        stream.clear();
+        stream.seekg(begin);
+        return -1;
+    }
+    return static_cast<std::streamsize>(end - begin);
+}
+}
+
+XmlDocument::XmlDocument() :
+    empty_(true)
+{
+}
+
+XMLError XmlDocument::Load(std::istream& stream)
+{
+    CpuStageScope parseStage(CpuStage::Parse);
+    std::streamsize capacity = RemainingSize(stream);
+    bool sized = capacity >= 0;
+    if (!sized) {
+        capacity = XML_READ_CHUNK;
+    }
+
+    char* buffer = new char[capacity + 1];
+    std::streamsize size = 0;
+    while (true) {
+        stream.read(buffer + size, capacity - size);
+        size += stream.gcount();
+        if (sized || size < capacity) {
+            break;
+        }
+        //unknown size, grow the buffer and keep reading
+        char* grown = new char[capacity * 2 + 1];
+        memcpy(grown, buffer, static_cast<size_t>(size));
+        delete [] buffer;
+        buffer = grown;
+        capacity *= 2;
+    }
+
+    empty_ = (size == 0);
+    return doc_.ParseInSitu(buffer, static_cast<size_t>(size));
+}
+
+XMLError XmlDocument::Load(const std::string& data)
+{
+    CpuStageScope parseStage(CpuStage::Parse);
+    empty_ = data.empty();
+    return doc_.Parse(data.c_str(), data.size());
+}
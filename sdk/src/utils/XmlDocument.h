@@ -0,0 +1,55 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <string>
+#include <iostream>
+#include <tinyxml2/tinyxml2.h>
+
+/* the class is internal and keeps a tinyxml2 document, whose types GCC hides in every build,
+   the static one without -fvisibility=hidden as well */
+#if !defined(_WIN32) && defined(__GNUC__) && __GNUC__ >= 4
+#   define ALIBABACLOUD_OSS_XML_HIDDEN __attribute__((visibility("hidden")))
+#else
+#   define ALIBABACLOUD_OSS_XML_HIDDEN
+#endif
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * A tinyxml2 document which is parsed in the buffer the response body is read into.
+    * The stream is read with a single bulk read when its size is known, so the payload
+    * is neither copied into an intermediate string nor copied again by the parser.
+    */
+    class ALIBABACLOUD_OSS_XML_HIDDEN XmlDocument
+    {
+    public:
+        XmlDocument();
+        /* reads and parses the remaining content of the stream */
+        tinyxml2::XMLError Load(std::istream& stream);
+        tinyxml2::XMLError Load(const std::string& data);
+        /* true when the loaded content was empty */
+        bool Empty() const { return empty_; }
+        tinyxml2::XMLError ErrorID() const { return doc_.ErrorID(); }
+        tinyxml2::XMLElement* RootElement() { return doc_.RootElement(); }
+    private:
+        tinyxml2::XMLDocument doc_;
+        bool empty_;
+    };
+}
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XmlSaxParser.h"
+#include "CpuAccounting.h"
+#include <cstring>
+#include <cstdlib>
+
+using namespace AlibabaCloud::OSS;
+
+static void AppendUtf8(std::string &out, unsigned long cp)
+{
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    }
+    else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+    else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+    else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+XmlSaxParser::XmlSaxParser(Handler *handler) :
+    handler_(handler)
+{
+    reset();
+}
+
+void XmlSaxParser::reset()
+{
+    state_ = State::Text;
+    error_ = false;
+    sawRoot_ = false;
+    quote_ = 0;
+    markCount_ = 0;
+    token_.clear();
+    text_.clear();
+    stack_.clear();
+}
+
+bool XmlSaxParser::feed(const char *data, size_t size)
+{
+    CpuStageScope parseStage(CpuStage::Parse);
+    if (error_) {
+        return false;
+    }
+
+    const char *ptr = data;
+    const char *end = data + size;
+    while (ptr < end && !error_) {
+        switch (state_)
+        {
+        case State::Text:
+        {
+            const char *next = ptr;
+            while (next < end && *next != '<' && *next != '&') {
+                next++;
+            }
+            //text outside of the root element is ignored
+            if (!stack_.empty()) {
+                text_.append(ptr, next - ptr);
+            }
+            ptr = next;
+            if (ptr < end) {
+                state_ = (*ptr == '<') ? State::Tag : State::Entity;
+                token_.clear();
+                quote_ = 0;
+                ptr++;
+            }
+        }
+            break;
+
+        case State::Entity:
+        {
+            char c = *ptr++;
+            if (c == ';') {
+                error_ = !decodeEntity();
+                state_ = State::Text;
+            }
+            else {
+                token_.push_back(c);
+                error_ = token_.size() > 10;
+            }
+        }
+            break;
+
+        case State::Tag:
+        {
+            char c = *ptr++;
+            if (quote_) {
+                if (c == quote_) {
+                    quote_ = 0;
+                }
+                token_.push_back(c);
+            }
+            else if (c == '>') {
+                onTag();
+            }
+            else {
+                if (c == '"' || c == '\'') {
+                    quote_ = c;
+                }
+                token_.push_back(c);
+                if (token_.size() == 3 && token_ == "!--") {
+                    state_ = State::Comment;
+                    markCount_ = 0;
+                }
+                else if (token_.size() == 8 && token_ == "![CDATA[") {
+                    state_ = State::CData;
+                    markCount_ = 0;
+                }
+            }
+        }
+            break;
+
+        case State::Comment:
+        {
+            char c = *ptr++;
+            if (c == '-') {
+                markCount_++;
+            }
+            else if (c == '>' && markCount_ >= 2) {
+                state_ = State::Text;
+            }
+            else {
+                markCount_ = 0;
+            }
+        }
+            break;
+
+        case State::CData:
+        {
+            char c = *ptr++;
+            if (c == ']') {
+                markCount_++;
+            }
+            else if (c == '>' && markCount_ >= 2) {
+                text_.append(markCount_ - 2, ']');
+                markCount_ = 0;
+                state_ = State::Text;
+            }
+            else {
+                text_.append(markCount_, ']');
+                markCount_ = 0;
+                text_.push_back(c);
+            }
+        }
+            break;
+        }
+    }
+
+    return !error_;
+}
+
+bool XmlSaxParser::feed(std::istream &stream)
+{
+    char buffer[16384];
+    while (stream.good() && !error_) {
+        stream.read(buffer, sizeof(buffer));
+        auto got = stream.gcount();
+        if (got > 0) {
+            feed(buffer, static_cast<size_t>(got));
+        }
+    }
+    return !error_;
+}
+
+bool XmlSaxParser::finish()
+{
+    return !error_ && sawRoot_ && stack_.empty() && state_ == State::Text;
+}
+
+void XmlSaxParser::onTag()
+{
+    state_ = State::Text;
+    if (token_.empty()) {
+        error_ = true;
+        return;
+    }
+
+    //processing instruction or doctype
+    if (token_[0] == '?' || token_[0] == '!') {
+        return;
+    }
+
+    if (token_[0] == '/') {
+        auto last = token_.find_last_not_of(" \t\r\n");
+        if (stack_.empty() || stack_.back().compare(0, std::string::npos, token_, 1, last) != 0) {
+            error_ = true;
+            return;
+        }
+        handler_->onEndElement(stack_.back(), stack_.size(), text_);
+        stack_.pop_back();
+        text_.clear();
+        return;
+    }
+
+    if (stack_.empty() && sawRoot_) {
+        error_ = true;
+        return;
+    }
+
+    bool selfClose = token_.back() == '/';
+    auto pos = token_.find_first_of(" \t\r\n/");
+    if (pos == 0) {
+        error_ = true;
+        return;
+    }
+    sawRoot_ = true;
+    stack_.push_back(token_.substr(0, pos));
+    text_.clear();
+    handler_->onStartElement(stack_.back(), stack_.size());
+    if (selfClose) {
+        handler_->onEndElement(stack_.back(), stack_.size(), text_);
+        stack_.pop_back();
+        text_.clear();
+    }
+}
+
+bool XmlSaxParser::decodeEntity()
+{
+    if (token_ == "amp") {
+        text_.push_back('&');
+    }
+    else if (token_ == "lt") {
+        text_.push_back('<');
+    }
+    else if (token_ == "gt") {
+        text_.push_back('>');
+    }
+    else if (token_ == "quot") {
+        text_.push_back('"');
+    }
+    else if (token_ == "apos") {
+        text_.push_back('\'');
+    }
+    else if (token_.size() > 1 && token_[0] == '#') {
+        char *end = nullptr;
+        unsigned long cp;
+        if (token_[1] == 'x' || token_[1] == 'X') {
+            cp = std::strtoul(token_.c_str() + 2, &end, 16);
+        }
+        else {
+            cp = std::strtoul(token_.c_str() + 1, &end, 10);
+        }
+        if (end == nullptr || *end != '\0' || cp > 0x10FFFF) {
+            return false;
+        }
+        AppendUtf8(text_, cp);
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+XmlSaxStreamBuf::int_type XmlSaxStreamBuf::overflow(int_type ch)
+{
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        char c = traits_type::to_char_type(ch);
+        parser_->feed(&c, 1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize XmlSaxStreamBuf::xsputn(const char *ptr, std::streamsize count)
+{
+    //parse errors are reported by the parser, the transfer itself always succeeds
+    parser_->feed(ptr, static_cast<size_t>(count));
+    return count;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <string>
+#include <vector>
+#include <iostream>
+#include <memory>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+    /**
+    * A small incremental (SAX style) xml parser for the response bodies of OSS.
+    * Data can be fed in chunks of any size; element events are emitted as soon
+    * as a tag is complete, so a response never has to be held in memory as a whole.
+    * Only the subset of xml produced by OSS is supported: elements, text,
+    * the predefined and numeric entities, CDATA, comments and processing instructions.
+    * Attributes are skipped.
+    */
+    class XmlSaxParser
+    {
+    public:
+        class Handler
+        {
+        public:
+            virtual ~Handler() = default;
+            /* depth of the root element is 1 */
+            virtual void onStartElement(const std::string &name, size_t depth) = 0;
+            /* text holds the decoded text of the element, the handler may move it away */
+            virtual void onEndElement(const std::string &name, size_t depth, std::string &text) = 0;
+        };
+
+        explicit XmlSaxParser(Handler *handler);
+        void reset();
+        bool feed(const char *data, size_t size);
+        bool feed(std::istream &stream);
+        bool finish();
+        bool hasError() const { return error_; }
+
+    private:
+        enum class State
+        {
+            Text, Entity, Tag, Comment, CData
+        };
+        void onTag();
+        bool decodeEntity();
+
+        Handler *handler_;
+        State state_;
+        bool error_;
+        bool sawRoot_;
+        char quote_;
+        size_t markCount_;
+        std::string token_;
+        std::string text_;
+        std::vector<std::string> stack_;
+    };
+
+    /**
+    * A streambuf which forwards everything written to it to an XmlSaxParser,
+    * so it can be used as the response body of a request.
+    */
+    class XmlSaxStreamBuf : public std::streambuf
+    {
+    public:
+        explicit XmlSaxStreamBuf(XmlSaxParser *parser) : parser_(parser) {}
+    protected:
+        int_type overflow(int_type ch = traits_type::eof()) override;
+        std::streamsize xsputn(const char *ptr, std::streamsize count) override;
+    private:
+        XmlSaxParser *parser_;
+    };
+
+    class XmlSaxStream : public std::iostream
+    {
+    public:
+        explicit XmlSaxStream(XmlSaxParser *parser) :
+            std::iostream(nullptr),
+            streamBuf_(parser)
+        {
+            rdbuf(&streamBuf_);
+        }
+    private:
+        XmlSaxStreamBuf streamBuf_;
+    };
+}
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <fstream>
+#include <thread>
+#include <chrono>
+#include "../Config.h"
+#include "../Utils.h"
+#include <src/utils/FileSystemUtils.h>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class RefreshableCredentialsProviderTest : public ::testing::Test {
+protected:
+    RefreshableCredentialsProviderTest()
+    {
+    }
+
+    ~RefreshableCredentialsProviderTest() override
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+class CountingCredentialsFetcher : public CredentialsFetcher
+{
+public:
+    CountingCredentialsFetcher(long lifetime, bool fail = false) :
+        count(0), lifetime_(lifetime), fail_(fail)
+    {}
+
+    bool fetch(Credentials& credentials, std::time_t& expiration) override
+    {
+        int n = ++count;
+        if (fail_) {
+            return false;
+        }
+        credentials.setAccessKeyId("ak-" + std::to_string(n));
+        credentials.setAccessKeySecret("sk-" + std::to_string(n));
+        credentials.setSessionToken("token-" + std::to_string(n));
+        expiration = lifetime_ > 0 ? std::time(nullptr) + lifetime_ : 0;
+        return true;
+    }
+
+    std::atomic<int> count;
+private:
+    long lifetime_;
+    bool fail_;
+};
+
+TEST_F(RefreshableCredentialsProviderTest, FirstFetchIsSynchronousTest)
+{
+    auto fetcher = std::make_shared<CountingCredentialsFetcher>(0);
+    RefreshableCredentialsProvider provider(fetcher);
+    EXPECT_EQ(fetcher->count.load(), 1);
+    EXPECT_EQ(provider.getCredentials().AccessKeyId(), "ak-1");
+    EXPECT_EQ(provider.getCredentials().AccessKeySecret(), "sk-1");
+    EXPECT_EQ(provider.getCredentials().SessionToken(), "token-1");
+    EXPECT_EQ(provider.Expiration(), 0);
+
+    //the same snapshot is shared by all readers until the next refresh
+    auto snapshot1 = provider.getCredentialsSnapshot();
+    auto snapshot2 = provider.getCredentialsSnapshot();
+    EXPECT_EQ(snapshot1.get(), snapshot2.get());
+}
+
+TEST_F(RefreshableCredentialsProviderTest, RefreshAheadOfExpirationTest)
+{
+    auto fetcher = std::make_shared<CountingCredentialsFetcher>(2);
+    RefreshableCredentialsProvider provider(fetcher, 1, 10);
+    auto snapshot = provider.getCredentialsSnapshot();
+    EXPECT_EQ(snapshot->AccessKeyId(), "ak-1");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+    EXPECT_GE(fetcher->count.load(), 2);
+    EXPECT_NE(provider.getCredentials().AccessKeyId(), "ak-1");
+
+    //old snapshot stays valid for the reader who holds it
+    EXPECT_EQ(snapshot->AccessKeyId(), "ak-1");
+}
+
+TEST_F(RefreshableCredentialsProviderTest, FetchFailRetryTest)
+{
+    auto fetcher = std::make_shared<CountingCredentialsFetcher>(0, true);
+    RefreshableCredentialsProvider provider(fetcher, 300, 50);
+    EXPECT_EQ(provider.getCredentials().AccessKeyId(), "");
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_GE(fetcher->count.load(), 3);
+}
+
+TEST_F(RefreshableCredentialsProviderTest, NullFetcherTest)
+{
+    RefreshableCredentialsProvider provider(nullptr, 300, 50);
+    EXPECT_EQ(provider.getCredentials().AccessKeyId(), "");
+    EXPECT_EQ(provider.refresh(), false);
+    EXPECT_EQ(provider.Expiration(), 0);
+}
+
+TEST_F(RefreshableCredentialsProviderTest, FileCredentialsFetcherTest)
+{
+    auto path = TestUtils::GetTargetFileName("credentials") + ".json";
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    out << "{\"AccessKeyId\":\"fileAk\",\"AccessKeySecret\":\"fileSk\","
+        << "\"SecurityToken\":\"fileToken\",\"Expiration\":\"2033-05-18T03:33:20Z\"}";
+    out.close();
+
+    FileCredentialsFetcher fetcher(path);
+    Credentials credentials("", "");
+    std::time_t expiration = 0;
+    EXPECT_EQ(fetcher.fetch(credentials, expiration), true);
+    EXPECT_EQ(credentials.AccessKeyId(), "fileAk");
+    EXPECT_EQ(credentials.AccessKeySecret(), "fileSk");
+    EXPECT_EQ(credentials.SessionToken(), "fileToken");
+    EXPECT_EQ(expiration, 2000000000);
+
+    auto provider = std::make_shared<RefreshableCredentialsProvider>(std::make_shared<FileCredentialsFetcher>(path));
+    EXPECT_EQ(provider->getCredentials().AccessKeyId(), "fileAk");
+    RemoveFile(path);
+
+    FileCredentialsFetcher badFetcher(path);
+    EXPECT_EQ(badFetcher.fetch(credentials, expiration), false);
+}
+
+}
+}
@@ -179,7 +179,63 @@ TEST_F(CryptoStreamBufTest, CryptoStreamTest)
     auto content = std::make_shared<std::fstream>("", std::ios_base::out | std::ios_base::in | std::ios_base::trunc | std::ios_base::binary);
     auto cryptoStream = std::make_shared<CryptoStreamBuf>(*content, cipher, ByteBuffer(32), ByteBuffer(16));
     cryptoStream = nullptr;
-}
-
-}
-}
\ No newline at end of file
+}
+
+TEST_F(CryptoStreamBufTest, LargeBufferTest)
+{
+    auto key = ByteBuffer(32);
+    auto iv = ByteBuffer(16);
+    memcpy((void *)key.data(), (void *)("12345678901234561234567890123456"), 32);
+    memcpy((void *)iv.data(), (void *)("1234567890123456"), 16);
+    auto cipher = SymmetricCipher::CreateAES256_CTRImpl();
+
+    //larger than several batches, and not aligned to the block size
+    std::string plain = TestUtils::GetRandomString(3 * 64 * 1024 + 12345);
+    auto refCipher = SymmetricCipher::CreateAES256_CTRImpl();
+    refCipher->EncryptInit(key, iv);
+    std::string encrypted(plain.size(), '\0');
+    refCipher->Encrypt((unsigned char *)&encrypted[0], static_cast<int>(plain.size()),
+        (const unsigned char *)plain.data(), static_cast<int>(plain.size()));
+
+    auto content = std::make_shared<std::stringstream>(plain);
+    CryptoStreamBuf cryptoStream(*content, cipher, key, iv);
+    const int steps[] = { 1000, 64 * 1024 + 3, 200000, static_cast<int>(plain.size()) };
+    for (auto step : steps) {
+        std::string buff(plain.size(), '\0');
+        size_t size = 0;
+        content->clear();
+        content->seekg(0, content->beg);
+        while (size < plain.size()) {
+            content->read(&buff[size], step);
+            if (content->gcount() <= 0) {
+                break;
+            }
+            size += static_cast<size_t>(content->gcount());
+        }
+        EXPECT_EQ(size, plain.size());
+        EXPECT_TRUE(buff == encrypted);
+    }
+
+    //seek into the middle of a block
+    const int offset = 70001;
+    std::string buff(plain.size() - offset, '\0');
+    content->clear();
+    content->seekg(offset, content->beg);
+    content->read(&buff[0], buff.size());
+    EXPECT_EQ(static_cast<size_t>(content->gcount()), buff.size());
+    EXPECT_TRUE(buff == encrypted.substr(offset));
+
+    //decrypt with large writes, skipping the first bytes
+    for (auto step : steps) {
+        auto output = std::make_shared<std::stringstream>();
+        auto decryptStream = std::make_shared<CryptoStreamBuf>(*output, cipher, key, iv, 7);
+        for (size_t i = 0; i < encrypted.size(); i += step) {
+            output->write(encrypted.data() + i, std::min(static_cast<size_t>(step), encrypted.size() - i));
+        }
+        decryptStream = nullptr;
+        EXPECT_TRUE(output->str() == plain.substr(7));
+    }
+}
+
+}
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/BulkObjectDeleter.h>
+#include "../Config.h"
+#include "../Utils.h"
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class BulkObjectDeleterTest : public ::testing::Test {
+protected:
+    BulkObjectDeleterTest()
+    {
+    }
+
+    ~BulkObjectDeleterTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-bulkdeleter");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    static void PutKeys(const std::string& prefix, int count)
+    {
+        for (int i = 0; i < count; i++) {
+            Client->PutObject(PutObjectRequest(BucketName, prefix + std::to_string(i),
+                std::make_shared<std::stringstream>("data")));
+        }
+    }
+
+    static size_t CountKeys(const std::string& prefix)
+    {
+        ListObjectsV2Request request(BucketName);
+        request.setPrefix(prefix);
+        auto outcome = Client->ListObjectsV2(request);
+        EXPECT_EQ(outcome.isSuccess(), true);
+        return outcome.result().ObjectSummarys().size();
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> BulkObjectDeleterTest::Client = nullptr;
+std::string BulkObjectDeleterTest::BucketName = "";
+
+TEST_F(BulkObjectDeleterTest, DeletePrefixTest)
+{
+    PutKeys("bulk/prefix/", 25);
+    PutKeys("bulk/keep/", 3);
+    EXPECT_EQ(CountKeys("bulk/prefix/"), 25U);
+
+    BulkObjectDeleter deleter(*Client, BucketName);
+    deleter.setConcurrency(4);
+    EXPECT_EQ(deleter.deletePrefix("bulk/prefix/"), true);
+    EXPECT_EQ(deleter.DeletedCount(), 25U);
+    EXPECT_EQ(deleter.FailedCount(), 0U);
+    EXPECT_EQ(deleter.Errors().empty(), true);
+    EXPECT_EQ(CountKeys("bulk/prefix/"), 0U);
+    EXPECT_EQ(CountKeys("bulk/keep/"), 3U);
+}
+
+TEST_F(BulkObjectDeleterTest, AddKeyTest)
+{
+    PutKeys("bulk/add/", 10);
+
+    BulkObjectDeleter deleter(*Client, BucketName);
+    for (int i = 0; i < 10; i++) {
+        deleter.addKey("bulk/add/" + std::to_string(i));
+    }
+    deleter.flush();
+    EXPECT_EQ(deleter.DeletedCount(), 10U);
+    EXPECT_EQ(CountKeys("bulk/add/"), 0U);
+
+    //the deleter is reusable after a flush
+    PutKeys("bulk/add/", 2);
+    deleter.addObject(ObjectIdentifier("bulk/add/0"));
+    deleter.addObject(ObjectIdentifier("bulk/add/1"));
+    deleter.flush();
+    EXPECT_EQ(deleter.DeletedCount(), 12U);
+    EXPECT_EQ(CountKeys("bulk/add/"), 0U);
+}
+
+TEST_F(BulkObjectDeleterTest, DeleteFailTest)
+{
+    auto bucket = TestUtils::GetBucketName("cpp-sdk-bulkdeleter-none");
+    BulkObjectDeleter deleter(*Client, bucket);
+    deleter.setMaxRetries(1);
+    deleter.addKey("a");
+    deleter.addKey("b");
+    deleter.flush();
+    EXPECT_EQ(deleter.DeletedCount(), 0U);
+    EXPECT_EQ(deleter.FailedCount(), 2U);
+    auto errors = deleter.Errors();
+    EXPECT_EQ(errors.size(), 1U);
+    EXPECT_EQ(errors[0].Error().Code(), "NoSuchBucket");
+    EXPECT_EQ(errors[0].Objects().size(), 2U);
+
+    EXPECT_EQ(deleter.deletePrefix("bulk/"), false);
+    EXPECT_EQ(deleter.ListError().Code(), "NoSuchBucket");
+}
+
+}
+}
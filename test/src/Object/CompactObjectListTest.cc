@@ -0,0 +1,120 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/model/CompactObjectList.h>
+#include "../Config.h"
+#include "../Utils.h"
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class CompactObjectListTest : public ::testing::Test {
+protected:
+    static ObjectSummaryList BuildSummaries(int count)
+    {
+        std::stringstream xml;
+        xml << "<?xml version=\"1.0\" encoding=\"UTF-8\"?><ListBucketResult><Name>oss-example</Name>";
+        for (int i = 0; i < count; i++) {
+            xml << "<Contents><Key>dir/sub/object-" << (10000 + i) << ".jpg</Key>"
+                << "<LastModified>2012-02-24T08:43:" << (10 + i % 50) << "." << (100 + i % 900) << "Z</LastModified>"
+                << "<ETag>\"5B3C1A2E053D763E1B002CC607C5A0" << (10 + i % 90) << (i % 3 == 0 ? "-3" : "") << "\"</ETag>"
+                << "<Type>" << (i % 2 ? "Normal" : "Multipart") << "</Type>"
+                << "<Size>" << i * 1024 << "</Size>"
+                << "<StorageClass>" << (i % 5 ? "Standard" : "IA") << "</StorageClass>"
+                << "<Owner><ID>0022012022" << i % 2 << "</ID><DisplayName>user-example</DisplayName></Owner>"
+                << "</Contents>";
+        }
+        //values which do not fit the compact form
+        xml << "<Contents><Key>dir/~odd</Key><LastModified>Fri, 24 Feb 2012 06:07:48 GMT</LastModified>"
+            << "<ETag>\"abc\"</ETag><Size>1</Size><RestoreInfo>ongoing-request=\"true\"</RestoreInfo></Contents>";
+        xml << "</ListBucketResult>";
+        ListObjectsResult result(xml.str());
+        return result.ObjectSummarys();
+    }
+
+    static void ExpectEqual(const CompactObjectList::View& view, const ObjectSummary& summary)
+    {
+        EXPECT_EQ(view.Key(), summary.Key());
+        EXPECT_EQ(view.ETag(), summary.ETag());
+        EXPECT_EQ(view.Size(), summary.Size());
+        EXPECT_EQ(view.LastModified(), summary.LastModified());
+        EXPECT_EQ(view.StorageClass(), summary.StorageClass());
+        EXPECT_EQ(view.Type(), summary.Type());
+        EXPECT_EQ(view.Owner().Id(), summary.Owner().Id());
+        EXPECT_EQ(view.Owner().DisplayName(), summary.Owner().DisplayName());
+        EXPECT_EQ(view.RestoreInfo(), summary.RestoreInfo());
+    }
+};
+
+TEST_F(CompactObjectListTest, IterateTest)
+{
+    auto summaries = BuildSummaries(100);
+    ASSERT_EQ(summaries.size(), 101UL);
+
+    CompactObjectList list;
+    list.add(summaries);
+    EXPECT_EQ(list.size(), 101UL);
+
+    size_t i = 0;
+    for (const auto& view : list) {
+        ExpectEqual(view, summaries[i++]);
+    }
+    EXPECT_EQ(i, summaries.size());
+}
+
+TEST_F(CompactObjectListTest, RandomAccessTest)
+{
+    auto summaries = BuildSummaries(50);
+    CompactObjectList list;
+    for (const auto& summary : summaries) {
+        list.add(summary);
+    }
+
+    size_t indexes[] = { 0, 15, 16, 17, 33, 50, 49 };
+    for (auto index : indexes) {
+        ExpectEqual(list.at(index), summaries[index]);
+    }
+    auto summary = list.at(17).Summary();
+    EXPECT_EQ(summary.Key(), summaries[17].Key());
+    EXPECT_EQ(summary.ETag(), summaries[17].ETag());
+    EXPECT_EQ(list.at(0).LastModifiedTime(), 1330072990100LL);
+    EXPECT_EQ(list.at(50).LastModifiedTime(), -1);
+}
+
+TEST_F(CompactObjectListTest, MemoryUsageTest)
+{
+    auto summaries = BuildSummaries(1000);
+    CompactObjectList list;
+    list.add(summaries);
+    list.shrinkToFit();
+
+    size_t listSize = 0;
+    for (const auto& summary : summaries) {
+        listSize += sizeof(ObjectSummary) + summary.Key().capacity() + summary.ETag().capacity() +
+            summary.LastModified().capacity() + summary.StorageClass().capacity() + summary.Type().capacity() +
+            summary.Owner().Id().capacity() + summary.Owner().DisplayName().capacity();
+    }
+    EXPECT_LT(list.MemoryUsage() * 3, listSize);
+
+    list.clear();
+    EXPECT_EQ(list.empty(), true);
+    EXPECT_EQ(list.begin() == list.end(), true);
+}
+
+}
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ListObjectsV2Paginator.h>
+#include <alibabacloud/oss/client/RetryStrategy.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <atomic>
+#include <sstream>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ListObjectsV2PaginatorTest : public ::testing::Test {
+protected:
+    ListObjectsV2PaginatorTest()
+    {
+    }
+
+    ~ListObjectsV2PaginatorTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-paginator");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+        for (int i = 0; i < 25; i++) {
+            std::string key = "paginator/" + std::to_string(100 + i);
+            Client->PutObject(PutObjectRequest(BucketName, key, std::make_shared<std::stringstream>("data")));
+        }
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> ListObjectsV2PaginatorTest::Client = nullptr;
+std::string ListObjectsV2PaginatorTest::BucketName = "";
+
+class NoRetryStrategy : public RetryStrategy
+{
+public:
+    bool shouldRetry(const Error&, long) const override { return false; }
+    long calcDelayTimeMs(const Error&, long) const override { return 0; }
+};
+
+TEST_F(ListObjectsV2PaginatorTest, ListAllPagesTest)
+{
+    ListObjectsV2Request request(BucketName);
+    request.setPrefix("paginator/");
+    request.setMaxKeys(10);
+
+    ListObjectsV2Paginator paginator(*Client, request, 2);
+    std::vector<std::string> keys;
+    int pages = 0;
+    for (const auto& outcome : paginator) {
+        EXPECT_EQ(outcome.isSuccess(), true);
+        for (const auto& summary : outcome.result().ObjectSummarys()) {
+            keys.push_back(summary.Key());
+        }
+        pages++;
+    }
+    EXPECT_EQ(pages, 3);
+    ASSERT_EQ(keys.size(), 25UL);
+    EXPECT_EQ(keys.front(), "paginator/100");
+    EXPECT_EQ(keys.back(), "paginator/124");
+    EXPECT_EQ(paginator.hasNext(), false);
+}
+
+TEST_F(ListObjectsV2PaginatorTest, MemoryLimitTest)
+{
+    ListObjectsV2Request request(BucketName);
+    request.setPrefix("paginator/");
+    request.setMaxKeys(5);
+
+    //a limit smaller than a page still lists one page at a time
+    ListObjectsV2Paginator paginator(*Client, request, 4, 1);
+    size_t count = 0;
+    while (paginator.hasNext()) {
+        auto outcome = paginator.next();
+        EXPECT_EQ(outcome.isSuccess(), true);
+        count += outcome.result().ObjectSummarys().size();
+    }
+    EXPECT_EQ(count, 25UL);
+    EXPECT_EQ(paginator.next().isSuccess(), false);
+}
+
+TEST_F(ListObjectsV2PaginatorTest, StopOnErrorTest)
+{
+    ClientConfiguration conf;
+    conf.connectTimeoutMs = 1000;
+    conf.retryStrategy = std::make_shared<NoRetryStrategy>();
+    OssClient client("http://127.0.0.1:1", "ak", "sk", conf);
+
+    ListObjectsV2Paginator paginator(client, ListObjectsV2Request(BucketName));
+    int pages = 0;
+    for (auto it = paginator.begin(); it != paginator.end(); ++it) {
+        EXPECT_EQ(it->isSuccess(), false);
+        pages++;
+    }
+    EXPECT_EQ(pages, 1);
+}
+
+/* answers every listing with a truncated page which has no continuation token */
+class TokenlessHttpClient : public HttpClient
+{
+public:
+    TokenlessHttpClient() : requests(0) {}
+    std::shared_ptr<HttpResponse> makeRequest(const std::shared_ptr<HttpRequest>& request) override
+    {
+        requests++;
+        auto response = std::make_shared<HttpResponse>(request);
+        response->setStatusCode(200);
+        // the body goes to the stream of the request, like the curl client does
+        auto body = request->ResponseStreamFactory()();
+        *body << "<?xml version=\"1.0\" encoding=\"UTF-8\"?><ListBucketResult><Name>bucket</Name>"
+            "<MaxKeys>1</MaxKeys><IsTruncated>true</IsTruncated><KeyCount>1</KeyCount>"
+            "<Contents><Key>a</Key><Size>1</Size></Contents></ListBucketResult>";
+        response->addBody(body);
+        return response;
+    }
+    std::atomic<int> requests;
+};
+
+TEST_F(ListObjectsV2PaginatorTest, TruncatedWithoutTokenTest)
+{
+    ClientConfiguration conf;
+    auto httpClient = std::make_shared<TokenlessHttpClient>();
+    conf.httpClient = httpClient;
+    OssClient client(Config::Endpoint, "ak", "sk", conf);
+
+    ListObjectsV2Paginator paginator(client, ListObjectsV2Request("bucket"));
+    std::vector<bool> pages;
+    for (auto it = paginator.begin(); it != paginator.end(); ++it) {
+        pages.push_back(it->isSuccess());
+    }
+    ASSERT_EQ(pages.size(), 2U);
+    EXPECT_EQ(pages[0], true);
+    EXPECT_EQ(pages[1], false);
+    EXPECT_EQ(httpClient->requests.load(), 1);
+}
+
+TEST_F(ListObjectsV2PaginatorTest, DestroyBeforeConsumedTest)
+{
+    ListObjectsV2Request request(BucketName);
+    request.setPrefix("paginator/");
+    request.setMaxKeys(1);
+
+    ListObjectsV2Paginator paginator(*Client, request, 3);
+    EXPECT_EQ(paginator.hasNext(), true);
+    auto outcome = paginator.next();
+    EXPECT_EQ(outcome.isSuccess(), true);
+}
+
+}
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ParallelObjectLister.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <algorithm>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ParallelObjectListerTest : public ::testing::Test {
+protected:
+    ParallelObjectListerTest()
+    {
+    }
+
+    ~ParallelObjectListerTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-parallellister");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+        const char *dirs[] = { "lister/a/", "lister/b/", "lister/b/sub/", "lister/d/" };
+        for (auto dir : dirs) {
+            for (int i = 0; i < 7; i++) {
+                Keys.push_back(std::string(dir) + std::to_string(i));
+            }
+        }
+        Keys.push_back("lister/0");
+        Keys.push_back("lister/c");
+        Keys.push_back("lister/e");
+        std::sort(Keys.begin(), Keys.end());
+        for (const auto& key : Keys) {
+            Client->PutObject(PutObjectRequest(BucketName, key, std::make_shared<std::stringstream>("data")));
+        }
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    static std::vector<std::string> ListAll(ParallelObjectLister& lister)
+    {
+        std::vector<std::string> keys;
+        ObjectSummary summary;
+        while (lister.next(summary)) {
+            keys.push_back(summary.Key());
+        }
+        return keys;
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+    static std::vector<std::string> Keys;
+};
+
+std::shared_ptr<OssClient> ParallelObjectListerTest::Client = nullptr;
+std::string ParallelObjectListerTest::BucketName = "";
+std::vector<std::string> ParallelObjectListerTest::Keys;
+
+TEST_F(ParallelObjectListerTest, OrderedDiscoveryTest)
+{
+    ParallelObjectLister lister(*Client, BucketName, "lister/");
+    lister.setOrdered(true);
+    lister.setConcurrency(3);
+    lister.setMaxKeys(2);
+    auto keys = ListAll(lister);
+    EXPECT_EQ(lister.hasError(), false);
+    EXPECT_EQ(keys, Keys);
+    //0, a/, b/, c, d/, e
+    EXPECT_EQ(lister.ShardCount(), 6UL);
+}
+
+TEST_F(ParallelObjectListerTest, UnorderedDiscoveryTest)
+{
+    ParallelObjectLister lister(*Client, BucketName, "lister/");
+    lister.setConcurrency(8);
+    lister.setMaxKeys(3);
+    auto keys = ListAll(lister);
+    EXPECT_EQ(lister.hasError(), false);
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys, Keys);
+}
+
+TEST_F(ParallelObjectListerTest, SplitKeysTest)
+{
+    ParallelObjectLister lister(*Client, BucketName, "lister/");
+    lister.setOrdered(true);
+    lister.setConcurrency(2);
+    lister.setMaxKeys(4);
+    lister.setSplitKeys({ "lister/b/3", "lister/a/1", "lister/d/6" });
+    auto keys = ListAll(lister);
+    EXPECT_EQ(lister.hasError(), false);
+    EXPECT_EQ(keys, Keys);
+    EXPECT_EQ(lister.ShardCount(), 4UL);
+}
+
+TEST_F(ParallelObjectListerTest, ListFailTest)
+{
+    ParallelObjectLister lister(*Client, BucketName + "-not-exist", "lister/");
+    auto keys = ListAll(lister);
+    EXPECT_EQ(keys.empty(), true);
+    EXPECT_EQ(lister.hasError(), true);
+    EXPECT_EQ(lister.Error().Code(), "NoSuchBucket");
+}
+
+}
+}
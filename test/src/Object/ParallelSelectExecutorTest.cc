@@ -0,0 +1,240 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ParallelSelectExecutor.h>
+#include <alibabacloud/oss/client/Error.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <sstream>
+#include <algorithm>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+class ParallelSelectExecutorTest : public ::testing::Test
+{
+protected:
+    ParallelSelectExecutorTest()
+    {
+    }
+    ~ParallelSelectExecutorTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-parallelselect");
+        CreateBucketOutcome outCome = Client->CreateBucket(CreateBucketRequest(BucketName));
+        EXPECT_EQ(outCome.isSuccess(), true);
+
+        Content = "id,name\n";
+        for (int i = 0; i < RowCount; i++) {
+            Content.append(std::to_string(i)).append(",name-").append(std::to_string(i));
+            Content.append(i + 1 < RowCount ? "\n" : "");
+        }
+        auto content = std::make_shared<std::stringstream>(Content);
+        auto putOutcome = Client->PutObject(PutObjectRequest(BucketName, ObjectName, content));
+        EXPECT_EQ(putOutcome.isSuccess(), true);
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    static std::string ExpectedOutput()
+    {
+        std::string expected;
+        for (int i = 0; i < RowCount; i++) {
+            expected.append(std::to_string(i)).append(",name-").append(std::to_string(i)).append("\n");
+        }
+        return expected;
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+    static std::string ObjectName;
+    static std::string Content;
+    static const int RowCount = 1000;
+};
+
+std::shared_ptr<OssClient> ParallelSelectExecutorTest::Client = nullptr;
+std::string ParallelSelectExecutorTest::BucketName = "";
+std::string ParallelSelectExecutorTest::ObjectName = "parallel-select.csv";
+std::string ParallelSelectExecutorTest::Content = "";
+
+TEST_F(ParallelSelectExecutorTest, OrderedSelectTest)
+{
+    CSVInputFormat inputFormat;
+    inputFormat.setHeaderInfo(CSVHeader::Use);
+    CSVOutputFormat outputFormat;
+
+    ParallelSelectExecutor executor(*Client, BucketName, ObjectName, "select * from ossobject", inputFormat, outputFormat);
+    executor.setConcurrency(4);
+    std::string output;
+    size_t records = 0;
+    executor.setRecordHandler([&](const char* data, size_t size, size_t count) {
+        output.append(data, size);
+        records += count;
+    });
+    EXPECT_EQ(executor.execute(), true);
+    EXPECT_EQ(output, ExpectedOutput());
+    EXPECT_EQ(records, static_cast<size_t>(RowCount));
+    EXPECT_EQ(executor.RecordCount(), static_cast<uint64_t>(RowCount));
+    EXPECT_TRUE(executor.SplitsCount() > 0);
+
+    int64_t nextSplit = 0;
+    uint64_t size = 0;
+    for (const auto& range : executor.RangeResults()) {
+        EXPECT_EQ(range.Done(), true);
+        EXPECT_EQ(range.SplitStart(), nextSplit);
+        EXPECT_TRUE(range.CRC64() != 0);
+        nextSplit = range.SplitEnd() + 1;
+        size += range.Size();
+    }
+    EXPECT_EQ(nextSplit, static_cast<int64_t>(executor.SplitsCount()));
+    EXPECT_EQ(size, static_cast<uint64_t>(output.size()));
+}
+
+TEST_F(ParallelSelectExecutorTest, UnorderedSelectTest)
+{
+    CSVInputFormat inputFormat;
+    inputFormat.setHeaderInfo(CSVHeader::Use);
+    CSVOutputFormat outputFormat;
+
+    ParallelSelectExecutor executor(*Client, BucketName, ObjectName, "select * from ossobject", inputFormat, outputFormat);
+    executor.setConcurrency(3);
+    executor.setRangeCount(7);
+    executor.setOrdered(false);
+    std::vector<std::string> lines;
+    std::string pending;
+    executor.setRecordHandler([&](const char* data, size_t size, size_t) {
+        pending.assign(data, size);
+        size_t pos = 0, next;
+        while ((next = pending.find('\n', pos)) != std::string::npos) {
+            lines.push_back(pending.substr(pos, next - pos + 1));
+            pos = next + 1;
+        }
+        EXPECT_EQ(pos, pending.size());
+    });
+    EXPECT_EQ(executor.execute(), true);
+    EXPECT_EQ(executor.RangeResults().size(), 7U);
+    EXPECT_EQ(lines.size(), static_cast<size_t>(RowCount));
+
+    std::sort(lines.begin(), lines.end());
+    std::vector<std::string> expected;
+    for (int i = 0; i < RowCount; i++) {
+        expected.push_back(std::to_string(i).append(",name-").append(std::to_string(i)).append("\n"));
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(lines, expected);
+}
+
+TEST_F(ParallelSelectExecutorTest, SelectNonExistentObjectTest)
+{
+    CSVInputFormat inputFormat;
+    CSVOutputFormat outputFormat;
+
+    ParallelSelectExecutor executor(*Client, BucketName, "no-such-object.csv", "select * from ossobject", inputFormat, outputFormat);
+    size_t calls = 0;
+    executor.setRecordHandler([&](const char*, size_t, size_t) { calls++; });
+    EXPECT_EQ(executor.execute(), false);
+    EXPECT_EQ(executor.Error().Code(), "NoSuchKey");
+    EXPECT_EQ(executor.RangeResults().size(), 0U);
+    EXPECT_EQ(calls, 0U);
+}
+
+/* answers the meta request with one split, and breaks the first select response after two records */
+class BrokenSelectHttpClient : public HttpClient
+{
+public:
+    BrokenSelectHttpClient() : selects(0) {}
+    std::shared_ptr<HttpResponse> makeRequest(const std::shared_ptr<HttpRequest>& request) override
+    {
+        auto response = std::make_shared<HttpResponse>(request);
+        auto body = request->ResponseStreamFactory()();
+        response->addBody(body);
+        if (request->url().query().find("meta") != std::string::npos) {
+            std::string meta = Number(0, 8) + Number(200, 4) + Number(1, 4) + Number(3, 8) + Number(2, 4);
+            *body << Frame(0x800006, meta.append(1, '\0'));
+            response->setStatusCode(200);
+            return response;
+        }
+        if (selects++ == 0) {
+            *body << Frame(0x800001, "1,a\n2,b\n3,");
+            response->setStatusCode(ERROR_CURL_BASE + 18);
+            response->setStatusMsg("transfer closed with outstanding read data remaining");
+            return response;
+        }
+        *body << Frame(0x800001, "1,a\n2,b\n3,c\n");
+        *body << Frame(0x800005, Number(12, 8) + Number(200, 4));
+        response->setStatusCode(200);
+        return response;
+    }
+    int selects;
+
+private:
+    static std::string Number(uint64_t value, int bytes)
+    {
+        std::string out;
+        for (int i = bytes - 1; i >= 0; i--) {
+            out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+        }
+        return out;
+    }
+    /* version | type | payload length | header checksum | offset | payload | payload checksum, no checksums */
+    static std::string Frame(uint32_t type, const std::string& payload)
+    {
+        return std::string(1, '\1') + Number(type, 3) + Number(payload.size() + 8, 4) + Number(0, 4) +
+            Number(0, 8) + payload + Number(0, 4);
+    }
+};
+
+TEST_F(ParallelSelectExecutorTest, RetriedRangeTest)
+{
+    ClientConfiguration conf;
+    auto httpClient = std::make_shared<BrokenSelectHttpClient>();
+    conf.httpClient = httpClient;
+    OssClient client(Config::Endpoint, "ak", "sk", conf);
+
+    CSVInputFormat inputFormat;
+    CSVOutputFormat outputFormat;
+    ParallelSelectExecutor executor(client, "bucket", "object.csv", "select * from ossobject", inputFormat, outputFormat);
+    executor.setConcurrency(1);
+    std::string output;
+    size_t records = 0;
+    executor.setRecordHandler([&](const char* data, size_t size, size_t count) {
+        output.append(data, size);
+        records += count;
+    });
+    EXPECT_EQ(executor.execute(), true);
+    EXPECT_EQ(httpClient->selects, 2);
+    EXPECT_EQ(output, "1,a\n2,b\n3,c\n");
+    EXPECT_EQ(records, 3U);
+    ASSERT_EQ(executor.RangeResults().size(), 1U);
+    EXPECT_EQ(executor.RangeResults()[0].RecordCount(), 3U);
+    EXPECT_EQ(executor.RangeResults()[0].Size(), 12U);
+}
+}
+}
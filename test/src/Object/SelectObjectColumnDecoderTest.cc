@@ -0,0 +1,138 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <alibabacloud/oss/model/SelectObjectColumnDecoder.h>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class SelectObjectColumnDecoderTest : public ::testing::Test {
+protected:
+    static std::string StringValue(const SelectColumn& column, size_t row)
+    {
+        auto& offsets = column.StringOffsets();
+        return column.StringData().substr(offsets[row], offsets[row + 1] - offsets[row]);
+    }
+};
+
+TEST_F(SelectObjectColumnDecoderTest, DecodeTypesTest)
+{
+    std::vector<SelectColumnType> schema = { SelectColumnType::Int64, SelectColumnType::Double,
+        SelectColumnType::String, SelectColumnType::Timestamp };
+    size_t batches = 0;
+    SelectObjectColumnDecoder decoder(schema, [&](const SelectColumnBatch& batch) {
+        batches++;
+        ASSERT_EQ(batch.RowCount(), 5U);
+        ASSERT_EQ(batch.ColumnCount(), 4U);
+        auto& ints = batch.Column(0);
+        auto& doubles = batch.Column(1);
+        auto& strings = batch.Column(2);
+        auto& times = batch.Column(3);
+
+        EXPECT_EQ(ints.Int64Values(), std::vector<int64_t>({ 1, -1234567890123, 0, 9223372036854775807LL, 0 }));
+        EXPECT_EQ(ints.Nulls(), std::vector<uint8_t>({ 0, 0, 1, 0, 1 }));
+        EXPECT_DOUBLE_EQ(doubles.DoubleValues()[0], 2.5);
+        EXPECT_DOUBLE_EQ(doubles.DoubleValues()[1], -0.001);
+        EXPECT_DOUBLE_EQ(doubles.DoubleValues()[2], 1.5e10);
+        EXPECT_DOUBLE_EQ(doubles.DoubleValues()[3], 3.14159265358979323846);
+        EXPECT_EQ(doubles.Nulls(), std::vector<uint8_t>({ 0, 0, 0, 0, 1 }));
+
+        EXPECT_EQ(StringValue(strings, 0), "plain");
+        EXPECT_EQ(StringValue(strings, 1), "Conectiv, Inc");
+        EXPECT_EQ(StringValue(strings, 2), "say \"hi\"");
+        EXPECT_EQ(StringValue(strings, 3), "");
+        EXPECT_EQ(StringValue(strings, 4), "");
+        EXPECT_EQ(strings.Nulls(), std::vector<uint8_t>({ 0, 0, 0, 0, 1 }));
+
+        EXPECT_EQ(times.Int64Values()[0], 0);
+        EXPECT_EQ(times.Int64Values()[1], 951782400LL * 1000000);
+        EXPECT_EQ(times.Int64Values()[2], 1700000000LL * 1000000 + 123456);
+        EXPECT_EQ(times.Nulls(), std::vector<uint8_t>({ 0, 0, 0, 1, 1 }));
+    });
+
+    std::string data =
+        "1,2.5,plain,1970-01-01 00:00:00\n"
+        "-1234567890123,-0.001,\"Conectiv, Inc\",2000-02-29\n"
+        ",1.5e10,\"say \"\"hi\"\"\",2023-11-14T22:13:20.123456Z,extra\n"
+        "9223372036854775807,3.14159265358979323846,\"\",bad\n"
+        "x";
+    decoder.decode(data.data(), data.size());
+    EXPECT_EQ(batches, 0U);
+    decoder.flush();
+    EXPECT_EQ(batches, 1U);
+    EXPECT_EQ(decoder.RowCount(), 5U);
+    //"bad" and "x"
+    EXPECT_EQ(decoder.InvalidValues(), 2U);
+}
+
+TEST_F(SelectObjectColumnDecoderTest, BatchRowsTest)
+{
+    std::vector<size_t> sizes;
+    std::vector<int64_t> values;
+    SelectObjectColumnDecoder decoder({ SelectColumnType::Int64, SelectColumnType::String }, [&](const SelectColumnBatch& batch) {
+        sizes.push_back(batch.RowCount());
+        for (size_t i = 0; i < batch.RowCount(); i++) {
+            values.push_back(batch.Column(0).Int64Values()[i]);
+        }
+        EXPECT_EQ(batch.Column(1).StringOffsets().size(), batch.RowCount() + 1);
+    }, 4);
+    decoder.reset('|', "\r\n", true);
+
+    std::string data = "id|name\r\n";
+    for (int i = 0; i < 10; i++) {
+        data.append(std::to_string(i * 11111111111LL)).append("|n\r").append(std::to_string(i)).append("\r\n");
+    }
+    //complete records may be decoded in any number of calls
+    size_t cut = data.find("\r\n", 30) + 2;
+    decoder.decode(data.data(), cut);
+    decoder.decode(data.data() + cut, data.size() - cut);
+    decoder.flush();
+    EXPECT_EQ(sizes, std::vector<size_t>({ 4, 4, 2 }));
+    ASSERT_EQ(values.size(), 10U);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(values[i], i * 11111111111LL);
+    }
+}
+
+TEST_F(SelectObjectColumnDecoderTest, NumberParseTest)
+{
+    const char* doubles[] = { "0", "-0.5", "123456789012345", "1234567890123456789", "1e-300", "+7.25E+2",
+        "0.1", "2.2250738585072014e-308", "99999999999999999999.5", ".5", "5." };
+    std::string data;
+    for (auto value : doubles) {
+        data.append(value).append(",").append(value).append("\n");
+    }
+    size_t rows = 0;
+    SelectObjectColumnDecoder decoder({ SelectColumnType::Double, SelectColumnType::Int64 }, [&](const SelectColumnBatch& batch) {
+        for (size_t i = 0; i < batch.RowCount(); i++, rows++) {
+            EXPECT_EQ(batch.Column(0).DoubleValues()[i], strtod(doubles[rows], nullptr)) << doubles[rows];
+            EXPECT_EQ(batch.Column(0).Nulls()[i], 0) << doubles[rows];
+        }
+        auto& ints = batch.Column(1);
+        EXPECT_EQ(ints.Int64Values()[0], 0);
+        EXPECT_EQ(ints.Int64Values()[2], 123456789012345LL);
+        EXPECT_EQ(ints.Int64Values()[3], 1234567890123456789LL);
+        EXPECT_EQ(ints.Nulls(), std::vector<uint8_t>({ 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1 }));
+    });
+    decoder.decode(data.data(), data.size());
+    decoder.flush();
+    EXPECT_EQ(rows, sizeof(doubles) / sizeof(doubles[0]));
+}
+
+}
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <src/model/SelectObjectRecordSplitter.h>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class SelectObjectRecordSplitterTest : public ::testing::Test {
+protected:
+    /* feeds the data cut at the given positions and returns the delivered records */
+    static std::vector<std::string> Split(const std::string& data, const std::string& delimiter, bool quoted,
+        const std::vector<size_t>& cuts, size_t* batches = nullptr)
+    {
+        std::vector<std::string> records;
+        std::string delivered;
+        size_t calls = 0;
+        SelectObjectRecordSplitter splitter(delimiter, quoted, [&](const char* p, size_t size, size_t count) {
+            calls++;
+            delivered.append(p, size);
+            for (size_t i = 0; i < count; i++) {
+                records.push_back("");
+            }
+        });
+
+        size_t pos = 0;
+        for (auto cut : cuts) {
+            splitter.feed(data.data() + pos, cut - pos);
+            pos = cut;
+        }
+        splitter.feed(data.data() + pos, data.size() - pos);
+        splitter.finish();
+        EXPECT_EQ(delivered, data);
+        EXPECT_EQ(splitter.RecordCount(), records.size());
+        if (batches) {
+            *batches = calls;
+        }
+
+        //cut the delivered data into the records with the reference scanner
+        std::vector<std::string> result;
+        std::string current;
+        bool inQuote = false;
+        for (size_t i = 0; i < data.size(); i++) {
+            current.push_back(data[i]);
+            if (quoted && data[i] == '"') {
+                inQuote = !inQuote;
+            }
+            if (!inQuote && current.size() >= delimiter.size() &&
+                !current.compare(current.size() - delimiter.size(), delimiter.size(), delimiter)) {
+                result.push_back(current);
+                current.clear();
+            }
+        }
+        if (!current.empty()) {
+            result.push_back(current);
+        }
+        EXPECT_EQ(records.size(), result.size());
+        return result;
+    }
+};
+
+TEST_F(SelectObjectRecordSplitterTest, WholeBufferTest)
+{
+    size_t batches = 0;
+    auto records = Split("a,1\nb,2\nc,3\n", "\n", true, {}, &batches);
+    EXPECT_EQ(records.size(), 3U);
+    //all the records of one piece are delivered with one call
+    EXPECT_EQ(batches, 1U);
+}
+
+TEST_F(SelectObjectRecordSplitterTest, QuotedDelimiterTest)
+{
+    std::string data = "name,company\n\"Eleanor\nLittle\",\"Conectiv, \"\"Inc\"\"\"\nRosie,\"\"\n";
+    auto records = Split(data, "\n", true, {});
+    ASSERT_EQ(records.size(), 3U);
+    EXPECT_EQ(records[1], "\"Eleanor\nLittle\",\"Conectiv, \"\"Inc\"\"\"\n");
+
+    //json output is not quoted at the level of records
+    records = Split("{\"a\":\"x\"}\n{\"a\":\"\\\"\"}\n", "\n", false, {});
+    EXPECT_EQ(records.size(), 2U);
+}
+
+TEST_F(SelectObjectRecordSplitterTest, EveryCutTest)
+{
+    std::string data = "r1,\"a\r\nb\"\r\nrecord-2,x\r\n\r\n\"q\"\"\",last";
+    for (size_t cut = 0; cut <= data.size(); cut++) {
+        auto records = Split(data, "\r\n", true, { cut });
+        EXPECT_EQ(records.size(), 4U) << "cut at " << cut;
+    }
+    for (size_t a = 0; a <= data.size(); a += 3) {
+        for (size_t b = a; b <= data.size(); b += 2) {
+            Split(data, "\r\n", true, { a, b });
+        }
+    }
+}
+
+TEST_F(SelectObjectRecordSplitterTest, LongRecordsTest)
+{
+    std::string data;
+    for (int i = 0; i < 200; i++) {
+        data.append(static_cast<size_t>(i * 7 % 53), 'x').append(i % 5 == 0 ? ",\"y\ny\"" : ",z").append("\n");
+    }
+    auto records = Split(data, "\n", true, { 1, 17, 1000, 1001, 4096 });
+    EXPECT_EQ(records.size(), 200U);
+}
+
+TEST_F(SelectObjectRecordSplitterTest, SkippedRecordsTest)
+{
+    //the retried attempt delivers the same output, the records of the first attempt are skipped
+    std::string data = "r1,\"a\r\nb\"\r\nrecord-2,x\r\n\r\n\"q\"\"\",last";
+    const size_t ends[] = { 0, 11, 23, 25 };
+    for (size_t cut = 0; cut <= data.size(); cut++) {
+        SelectObjectRecordSplitter first("\r\n", true, nullptr);
+        first.feed(data.data(), cut);
+        uint64_t done = first.RecordCount();
+
+        std::string delivered;
+        size_t count = 0;
+        SelectObjectRecordSplitter retry("\r\n", true, [&](const char* p, size_t size, size_t records) {
+            delivered.append(p, size);
+            count += records;
+        });
+        retry.setSkippedRecords(done);
+        retry.feed(data.data(), cut / 2);
+        retry.feed(data.data() + cut / 2, data.size() - cut / 2);
+        retry.finish();
+        EXPECT_EQ(retry.RecordCount(), 4U);
+        EXPECT_EQ(count, 4U - done) << "cut at " << cut;
+        EXPECT_EQ(delivered, data.substr(ends[done])) << "cut at " << cut;
+    }
+}
+
+}
+}
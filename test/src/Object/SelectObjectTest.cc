@@ -135,6 +135,106 @@ TEST_F(SelectObjectTest, NormalSelectObjectWithCsvDataTest)
     EXPECT_EQ(metaOutcome.isSuccess(), true);
 }
 
+TEST_F(SelectObjectTest, SelectObjectWithRecordHandlerTest)
+{
+    std::string key = TestUtils::GetObjectKey("SqlObjectWithRecordHandler");
+    std::shared_ptr<std::iostream> content = std::make_shared<std::stringstream>();
+    *content << sqlMessage;
+    auto putOutcome = Client->PutObject(PutObjectRequest(BucketName, key, content));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    SelectObjectRequest selectRequest(BucketName, key);
+    selectRequest.setExpression("select * from ossobject");
+    CSVInputFormat inputCsv(CSVHeader::Use, "\r\n", ",", "\"", "#");
+    selectRequest.setInputFormat(inputCsv);
+    CSVOutputFormat outputCsv;
+    selectRequest.setOutputFormat(outputCsv);
+
+    std::vector<std::string> records;
+    selectRequest.setRecordHandler([&records](const char* data, size_t size, size_t count) {
+        std::string batch(data, size);
+        size_t pos = 0;
+        for (size_t i = 0; i < count; i++) {
+            //the quoted field of the second record holds the field delimiter only
+            size_t end = batch.find('\n', pos);
+            end = (end == std::string::npos) ? batch.size() : end + 1;
+            records.push_back(batch.substr(pos, end - pos));
+            pos = end;
+        }
+        EXPECT_EQ(pos, batch.size());
+    });
+
+    auto outcome = Client->SelectObject(selectRequest);
+    EXPECT_EQ(outcome.isSuccess(), true);
+    ASSERT_EQ(records.size(), 4U);
+    EXPECT_EQ(selectRequest.RecordCount(), 4U);
+    EXPECT_EQ(records[0], "Lora Francis,School A,Staples Inc,27\n");
+    EXPECT_EQ(records[3].compare(0, 13, "Lawrence Ross"), 0);
+    EXPECT_NE(records[1].find("Conectiv, Inc"), std::string::npos);
+
+    //the records are not written to the response stream
+    std::istreambuf_iterator<char> isb(*outcome.result().Content()), end;
+    EXPECT_EQ(std::string(isb, end), "");
+
+    EXPECT_EQ(selectRequest.EndFrame().Received(), true);
+    EXPECT_EQ(selectRequest.EndFrame().ScannedBytes(), sqlMessage.size());
+    EXPECT_EQ(selectRequest.EndFrame().Status() / 100, 2);
+}
+
+TEST_F(SelectObjectTest, SelectObjectWithColumnDecoderTest)
+{
+    std::string key = TestUtils::GetObjectKey("SqlObjectWithColumnDecoder");
+    std::shared_ptr<std::iostream> content = std::make_shared<std::stringstream>();
+    *content << sqlMessage;
+    auto putOutcome = Client->PutObject(PutObjectRequest(BucketName, key, content));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    SelectObjectRequest selectRequest(BucketName, key);
+    selectRequest.setExpression("select * from ossobject");
+    CSVInputFormat inputCsv(CSVHeader::Use, "\r\n", ",", "\"", "#");
+    selectRequest.setInputFormat(inputCsv);
+    CSVOutputFormat outputCsv;
+    selectRequest.setOutputFormat(outputCsv);
+
+    std::vector<std::string> names;
+    std::vector<std::string> companies;
+    std::vector<int64_t> ages;
+    auto decoder = std::make_shared<SelectObjectColumnDecoder>(std::vector<SelectColumnType>({
+        SelectColumnType::String, SelectColumnType::String, SelectColumnType::String, SelectColumnType::Int64 }),
+        [&](const SelectColumnBatch& batch) {
+        auto value = [](const SelectColumn& column, size_t row) {
+            return column.StringData().substr(column.StringOffsets()[row],
+                column.StringOffsets()[row + 1] - column.StringOffsets()[row]);
+        };
+        for (size_t i = 0; i < batch.RowCount(); i++) {
+            names.push_back(value(batch.Column(0), i));
+            companies.push_back(value(batch.Column(2), i));
+            ages.push_back(batch.Column(3).Int64Values()[i]);
+        }
+    });
+    selectRequest.setColumnDecoder(decoder);
+
+    auto outcome = Client->SelectObject(selectRequest);
+    EXPECT_EQ(outcome.isSuccess(), true);
+    EXPECT_EQ(decoder->RowCount(), 4U);
+    EXPECT_EQ(decoder->InvalidValues(), 0U);
+    EXPECT_EQ(names, std::vector<std::string>({ "Lora Francis", "Eleanor Little", "Rosie Hughes", "Lawrence Ross" }));
+    EXPECT_EQ(companies[1], "Conectiv, Inc");
+    EXPECT_EQ(ages, std::vector<int64_t>({ 27, 43, 44, 24 }));
+
+    //json output cannot be decoded into columns
+    SelectObjectRequest jsonRequest(BucketName, key);
+    jsonRequest.setExpression("select * from ossobject");
+    JSONInputFormat inputJson(JsonType::LINES);
+    JSONOutputFormat outputJson;
+    jsonRequest.setInputFormat(inputJson);
+    jsonRequest.setOutputFormat(outputJson);
+    jsonRequest.setColumnDecoder(decoder);
+    outcome = Client->SelectObject(jsonRequest);
+    EXPECT_EQ(outcome.isSuccess(), false);
+    EXPECT_EQ(outcome.error().Code(), "ValidateError");
+}
+
 TEST_F(SelectObjectTest, NormalSelectObjectWithOutputRawTest)
 {
     // put object
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/VectoredObjectReader.h>
+#include <alibabacloud/oss/client/Metrics.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <sstream>
+
+namespace AlibabaCloud
+{
+namespace OSS
+{
+class VectoredObjectReaderTest : public ::testing::Test
+{
+protected:
+    VectoredObjectReaderTest()
+    {
+    }
+    ~VectoredObjectReaderTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-vectoredreadertest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+        Key = TestUtils::GetObjectKey("VectoredObjectReaderTest");
+        Content = TestUtils::GetRandomString(1024 * 1024);
+        Client->PutObject(BucketName, Key, std::make_shared<std::stringstream>(Content));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+    static std::string Key;
+    static std::string Content;
+};
+
+std::shared_ptr<OssClient> VectoredObjectReaderTest::Client = nullptr;
+std::string VectoredObjectReaderTest::BucketName = "";
+std::string VectoredObjectReaderTest::Key = "";
+std::string VectoredObjectReaderTest::Content = "";
+
+TEST_F(VectoredObjectReaderTest, MergeAndScatterTest)
+{
+    ClientConfiguration conf;
+    conf.metrics = std::make_shared<MetricsRegistry>();
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+
+    // offset, length: a footer, nearby column chunks, an overlap, a far chunk and a tail past the end
+    const int64_t layout[][2] = {
+        { 1000 * 1024, 8 * 1024 }, { 0, 100 }, { 200, 300 }, { 400, 1000 },
+        { 300 * 1024, 4096 }, { 300 * 1024 + 10 * 1024, 4096 }, { 1020 * 1024, 10 * 1024 }
+    };
+    const size_t count = sizeof(layout) / sizeof(layout[0]);
+    std::vector<std::string> buffers(count);
+    ReadRangeList ranges;
+    for (size_t i = 0; i < count; i++) {
+        buffers[i].assign(static_cast<size_t>(layout[i][1]), '\0');
+        ranges.push_back(ReadRange(layout[i][0], layout[i][1], &buffers[i][0]));
+    }
+
+    VectoredObjectReader reader(client, BucketName, Key);
+    reader.setMaxMergeGap(16 * 1024);
+    EXPECT_EQ(reader.read(ranges), true);
+    // [0, 1400), [300K, 314K), [1000K, 1M)
+    EXPECT_EQ(reader.RequestCount(), 3U);
+    EXPECT_EQ(conf.metrics->Snapshot().Operations().at("GetObject").Requests(), 3ULL);
+    for (size_t i = 0; i < count; i++) {
+        int64_t expected = (std::min)(layout[i][1], static_cast<int64_t>(Content.size()) - layout[i][0]);
+        EXPECT_EQ(ranges[i].BytesRead(), expected);
+        EXPECT_EQ(buffers[i].substr(0, static_cast<size_t>(expected)),
+            Content.substr(static_cast<size_t>(layout[i][0]), static_cast<size_t>(expected)));
+    }
+
+    // no merging, one request per range
+    reader.setMaxMergeGap(-1);
+    EXPECT_EQ(reader.read(ranges), true);
+    EXPECT_EQ(reader.RequestCount(), count);
+    EXPECT_EQ(ranges[0].BytesRead(), 8 * 1024);
+}
+
+TEST_F(VectoredObjectReaderTest, MaxRequestSizeTest)
+{
+    std::string large(600 * 1024, '\0');
+    std::string small(100, '\0');
+    ReadRangeList ranges;
+    ranges.push_back(ReadRange(100, 600 * 1024, &large[0]));
+    ranges.push_back(ReadRange(1000, 100, &small[0]));
+
+    VectoredObjectReader reader(*Client, BucketName, Key);
+    reader.setMaxRequestSize(256 * 1024);
+    reader.setConcurrency(2);
+    EXPECT_EQ(reader.read(ranges), true);
+    // the large range is split into three requests, the small one lies within the first
+    EXPECT_EQ(reader.RequestCount(), 3U);
+    EXPECT_EQ(reader.RequestedBytes(), 600 * 1024);
+    EXPECT_EQ(ranges[0].BytesRead(), 600 * 1024);
+    EXPECT_EQ(large, Content.substr(100, 600 * 1024));
+    EXPECT_EQ(small, Content.substr(1000, 100));
+}
+
+TEST_F(VectoredObjectReaderTest, InvalidRangeTest)
+{
+    std::string buffer(100, '\0');
+    ReadRangeList ranges;
+    ranges.push_back(ReadRange(0, 100, nullptr));
+    VectoredObjectReader reader(*Client, BucketName, Key);
+    EXPECT_EQ(reader.read(ranges), false);
+    EXPECT_EQ(reader.Error().Code(), "ValidateError");
+
+    ranges.clear();
+    ranges.push_back(ReadRange(0, 100, &buffer[0]));
+    VectoredObjectReader missing(*Client, BucketName, Key + "-not-exist");
+    EXPECT_EQ(missing.read(ranges), false);
+    EXPECT_EQ(missing.Error().Code().empty(), false);
+
+    // nothing to read
+    ranges.clear();
+    EXPECT_EQ(reader.read(ranges), true);
+    EXPECT_EQ(reader.RequestCount(), 0U);
+}
+
+}
+}
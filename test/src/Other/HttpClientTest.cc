@@ -491,11 +491,11 @@ public:
         hasResponseError(nullptr);
     }
 protected:
-    std::shared_ptr<HttpRequest> buildHttpRequest(const std::string& endpoint, const ServiceRequest& msg, Http::Method method) const
+    void buildHttpRequest(const std::string& endpoint, const ServiceRequest& msg, const std::shared_ptr<HttpRequest>& httpRequest) const
     {
         UNUSED_PARAM(endpoint);
         UNUSED_PARAM(msg);
-        return std::make_shared<HttpRequest>(method);
+        UNUSED_PARAM(httpRequest);
     }
 };
 
@@ -20,6 +20,10 @@
 #include "../Utils.h"
 #include <alibabacloud/oss/OssClient.h>
 #include "src/utils/LogUtils.h"
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 
 namespace AlibabaCloud {
 namespace OSS {
@@ -196,5 +200,88 @@ TEST_F(LogTest, EndofLineTest)
     SetLogLevel(LogLevel::LogOff);
 }
 
+static std::mutex AsyncLogLock;
+static std::vector<std::string> AsyncLogLines;
+static std::set<std::thread::id> AsyncLogThreads;
+static void AsyncLogCallbackFunc(LogLevel, const std::string &stream)
+{
+    std::lock_guard<std::mutex> lck(AsyncLogLock);
+    AsyncLogLines.push_back(stream);
+    AsyncLogThreads.insert(std::this_thread::get_id());
+}
+
+TEST_F(LogTest, AsyncLogTest)
+{
+    SetLogLevel(LogLevel::LogAll);
+    SetLogCallback(AsyncLogCallbackFunc);
+    AsyncLogLines.clear();
+    AsyncLogThreads.clear();
+    EnableAsyncLog();
+    auto dropped = GetDroppedLogCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 1000; i++) {
+                OSS_LOG(LogLevel::LogDebug, "LogTest", "AsyncLogTest thread:%d line:%d\n", t, i);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    FlushLog();
+
+    {
+        std::lock_guard<std::mutex> lck(AsyncLogLock);
+        EXPECT_EQ(AsyncLogLines.size(), 4000U);
+        EXPECT_EQ(AsyncLogThreads.count(std::this_thread::get_id()), 1U);
+        EXPECT_TRUE(AsyncLogThreads.size() <= 2U);
+        for (const auto& line : AsyncLogLines) {
+            EXPECT_TRUE(strstr(line.c_str(), "[DEBUG][LogTest][") != nullptr);
+            EXPECT_EQ(line[line.size() - 1], '\n');
+            EXPECT_NE(line[line.size() - 2], '\n');
+        }
+        EXPECT_EQ(AsyncLogLines[0].compare(0, 1, "["), 0);
+        EXPECT_EQ(AsyncLogLines[0][24], ']');
+    }
+    EXPECT_EQ(GetDroppedLogCount(), dropped);
+
+    DisableAsyncLog();
+    LogString = "";
+    SetLogCallback(LogCallbackFunc);
+    OSS_LOG(LogLevel::LogDebug, "LogTest", "AsyncLogTest%s", "Sync");
+    EXPECT_TRUE(strstr(LogString.c_str(), "AsyncLogTestSync") != nullptr);
+    SetLogLevel(LogLevel::LogOff);
+}
+
+TEST_F(LogTest, AsyncLogDropTest)
+{
+    SetLogLevel(LogLevel::LogAll);
+    SetLogCallback(AsyncLogCallbackFunc);
+    AsyncLogLines.clear();
+    EnableAsyncLog(4096);
+    auto dropped = GetDroppedLogCount();
+
+    std::string text(200, 'x');
+    std::thread worker([&text]() {
+        for (int i = 0; i < 1000; i++) {
+            OSS_LOG(LogLevel::LogDebug, "LogTest", "AsyncLogDropTest %s", text.c_str());
+        }
+    });
+    worker.join();
+    DisableAsyncLog();
+
+    size_t delivered = 0;
+    {
+        std::lock_guard<std::mutex> lck(AsyncLogLock);
+        delivered = AsyncLogLines.size();
+    }
+    EXPECT_GT(delivered, 0U);
+    EXPECT_GT(GetDroppedLogCount(), dropped);
+    EXPECT_EQ(delivered + (GetDroppedLogCount() - dropped), 1000U);
+    SetLogLevel(LogLevel::LogOff);
+}
+
 }
 }
@@ -0,0 +1,294 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/Metrics.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <future>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class MetricsTest : public ::testing::Test {
+protected:
+    MetricsTest()
+    {
+    }
+
+    ~MetricsTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-metricstest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> MetricsTest::Client = nullptr;
+std::string MetricsTest::BucketName = "";
+
+TEST_F(MetricsTest, LatencyHistogramTest)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0ULL);
+
+    for (uint64_t i = 1; i <= 1000; i++) {
+        histogram.record(i * 100);
+    }
+    EXPECT_EQ(histogram.Count(), 1000ULL);
+    EXPECT_EQ(histogram.Sum(), 50050000ULL);
+    EXPECT_EQ(histogram.Min(), 100ULL);
+
+    // values are kept with a relative error of about 3%
+    auto p50 = histogram.ValueAtPercentile(50);
+    auto p99 = histogram.ValueAtPercentile(99);
+    EXPECT_GE(p50, 50000ULL);
+    EXPECT_LE(p50, 51600ULL);
+    EXPECT_GE(p99, 99000ULL);
+    EXPECT_LE(p99, 102200ULL);
+    EXPECT_GE(histogram.Max(), 100000ULL);
+    EXPECT_LE(histogram.Max(), 103200ULL);
+    // 10000 shares the bucket [9984, 10239] with 10100 and 10200
+    EXPECT_EQ(histogram.CountAtOrBelow(10239), 102ULL);
+    EXPECT_EQ(histogram.CountAtOrBelow(10000), 99ULL);
+
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+        auto low = LatencyHistogram::BucketLowerBound(i);
+        EXPECT_EQ(LatencyHistogram::BucketIndex(low), i);
+        EXPECT_EQ(LatencyHistogram::BucketIndex(LatencyHistogram::BucketUpperBound(i)), i);
+    }
+    EXPECT_EQ(LatencyHistogram::BucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+
+    LatencyHistogram other;
+    other.record(7, 3);
+    histogram.merge(other);
+    EXPECT_EQ(histogram.Count(), 1003ULL);
+    EXPECT_EQ(histogram.Min(), 7ULL);
+}
+
+TEST_F(MetricsTest, OperationNameTest)
+{
+    EXPECT_STREQ(PutObjectRequest("bucket", "key", std::make_shared<std::stringstream>()).OperationName(), "PutObject");
+    EXPECT_STREQ(ListObjectsV2Request("bucket").OperationName(), "ListObjectsV2");
+    EXPECT_STREQ(GetObjectRequest("bucket", "key").OperationName(), "GetObject");
+    EXPECT_STREQ(HeadObjectRequest("bucket", "key").OperationName(), "HeadObject");
+}
+
+TEST_F(MetricsTest, RegistryThreadsAndResetTest)
+{
+    MetricsRegistry registry;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&registry]() {
+            for (int i = 0; i < 1000; i++) {
+                registry.recordRequest("PutObject", i % 10 != 0, i % 100 == 0 ? 1 : 0, 1000);
+                registry.recordTransfer(10, 20);
+            }
+            registry.recordRetry("ServerError:503");
+            registry.recordCrcFailure();
+            registry.recordCurlAcquireWait(5);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    registry.adjustCurlPoolSize(8);
+    registry.adjustExecutorQueueDepth(2);
+
+    auto snapshot = registry.Snapshot();
+    ASSERT_EQ(snapshot.Operations().size(), 1U);
+    const auto& op = snapshot.Operations().at("PutObject");
+    EXPECT_EQ(op.Requests(), 4000ULL);
+    EXPECT_EQ(op.Errors(), 400ULL);
+    EXPECT_EQ(op.Retries(), 40ULL);
+    EXPECT_EQ(op.Latency().Count(), 4000ULL);
+    EXPECT_EQ(snapshot.BytesSent(), 40000ULL);
+    EXPECT_EQ(snapshot.BytesReceived(), 80000ULL);
+    EXPECT_EQ(snapshot.RetriesByErrorCode().at("ServerError:503"), 4ULL);
+    EXPECT_EQ(snapshot.CrcFailures(), 4ULL);
+    EXPECT_EQ(snapshot.CurlAcquireWait().Count(), 4ULL);
+    EXPECT_EQ(snapshot.CurlPoolSize(), 8);
+    EXPECT_EQ(snapshot.ExecutorQueueDepth(), 2);
+
+    auto text = registry.PrometheusText();
+    EXPECT_NE(text.find("oss_sdk_requests_total{operation=\"PutObject\"} 4000\n"), std::string::npos);
+    EXPECT_NE(text.find("oss_sdk_request_duration_seconds_bucket{operation=\"PutObject\",le=\"0.001\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("oss_sdk_request_duration_seconds_bucket{operation=\"PutObject\",le=\"0.0025\"} 4000\n"), std::string::npos);
+    EXPECT_NE(text.find("oss_sdk_retries_total{code=\"ServerError:503\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("oss_sdk_curl_pool_size 8\n"), std::string::npos);
+
+    registry.Reset();
+    registry.recordRequest("PutObject", true, 0, 10);
+    snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot.Operations().at("PutObject").Requests(), 1ULL);
+    EXPECT_EQ(snapshot.Operations().at("PutObject").Latency().Count(), 1ULL);
+    EXPECT_EQ(snapshot.Operations().at("PutObject").Latency().Sum(), 10ULL);
+    EXPECT_EQ(snapshot.BytesSent(), 0ULL);
+    EXPECT_EQ(snapshot.RetriesByErrorCode().at("ServerError:503"), 0ULL);
+    EXPECT_EQ(snapshot.CurlPoolSize(), 8);
+}
+
+TEST_F(MetricsTest, ThreadExitTest)
+{
+    // the counters of the exited threads are kept in the retired total
+    MetricsRegistry registry;
+    for (int t = 0; t < 200; t++) {
+        std::thread([&registry]() { registry.recordRequest("GetObject", true, 0, 100); }).join();
+    }
+    registry.recordRequest("GetObject", true, 0, 100);
+    auto snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot.Operations().at("GetObject").Requests(), 201ULL);
+    EXPECT_EQ(snapshot.Operations().at("GetObject").Latency().Count(), 201ULL);
+
+    // a thread which exits after its registry is gone
+    std::promise<void> recorded;
+    std::promise<void> released;
+    std::thread worker;
+    {
+        MetricsRegistry shortLived;
+        worker = std::thread([&shortLived, &recorded, &released]() {
+            shortLived.recordRequest("GetObject", true, 0, 100);
+            recorded.set_value();
+            released.get_future().wait();
+        });
+        recorded.get_future().wait();
+    }
+    released.set_value();
+    worker.join();
+}
+
+TEST_F(MetricsTest, ClientMetricsTest)
+{
+    ClientConfiguration conf;
+    conf.metrics = std::make_shared<MetricsRegistry>();
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ClientMetricsTest");
+
+    auto putOutcome = client.PutObject(BucketName, key, TestUtils::GetRandomStream(1024));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    auto getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    auto headOutcome = client.HeadObject(BucketName, key + "-not-exist");
+    EXPECT_EQ(headOutcome.isSuccess(), false);
+    auto asyncOutcome = client.GetObjectCallable(GetObjectRequest(BucketName, key)).get();
+    EXPECT_EQ(asyncOutcome.isSuccess(), true);
+
+    auto snapshot = conf.metrics->Snapshot();
+    EXPECT_EQ(snapshot.Operations().at("PutObject").Requests(), 1ULL);
+    EXPECT_EQ(snapshot.Operations().at("GetObject").Requests(), 2ULL);
+    EXPECT_EQ(snapshot.Operations().at("GetObject").Errors(), 0ULL);
+    EXPECT_EQ(snapshot.Operations().at("HeadObject").Errors(), 1ULL);
+    EXPECT_GT(snapshot.Operations().at("GetObject").Latency().Max(), 0ULL);
+    EXPECT_GE(snapshot.BytesSent(), 1024ULL);
+    EXPECT_GE(snapshot.BytesReceived(), 2048ULL);
+    EXPECT_GT(snapshot.CurlPoolSize(), 0);
+    EXPECT_GE(snapshot.CurlAcquireWait().Count(), 4ULL);
+    EXPECT_EQ(snapshot.ExecutorQueueDepth(), 0);
+    EXPECT_EQ(snapshot.Operations().at("PutObject").CpuNanos(), 0ULL);
+}
+
+TEST_F(MetricsTest, RecordCpuTest)
+{
+    MetricsRegistry registry;
+    uint64_t stages[static_cast<int>(CpuStage::Count)] = { 0 };
+    stages[static_cast<int>(CpuStage::Sign)] = 2000;
+    stages[static_cast<int>(CpuStage::Parse)] = 3000;
+    registry.recordRequest("ListObjects", true, 0, 100);
+    registry.recordCpu("ListObjects", 10000, stages);
+    registry.recordCpu("ListObjects", 10000, stages);
+
+    auto snapshot = registry.Snapshot();
+    const auto& op = snapshot.Operations().at("ListObjects");
+    EXPECT_EQ(op.CpuNanos(), 20000ULL);
+    EXPECT_EQ(op.StageCpuNanos(CpuStage::Sign), 4000ULL);
+    EXPECT_EQ(op.StageCpuNanos(CpuStage::Parse), 6000ULL);
+    EXPECT_EQ(op.StageCpuNanos(CpuStage::Build), 0ULL);
+    EXPECT_STREQ(MetricsRegistry::StageName(CpuStage::Checksum), "checksum");
+
+    auto text = registry.PrometheusText();
+    EXPECT_NE(text.find("oss_sdk_operation_cpu_seconds_total{operation=\"ListObjects\",stage=\"sign\"} 4e-06\n"), std::string::npos);
+    EXPECT_NE(text.find("oss_sdk_operation_cpu_seconds_total{operation=\"ListObjects\",stage=\"other\"} 1e-05\n"), std::string::npos);
+
+    registry.Reset();
+    registry.recordCpu("ListObjects", 500, stages);
+    snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot.Operations().at("ListObjects").CpuNanos(), 500ULL);
+    EXPECT_EQ(snapshot.Operations().at("ListObjects").StageCpuNanos(CpuStage::Parse), 3000ULL);
+}
+
+TEST_F(MetricsTest, ClientStageCpuTest)
+{
+    ClientConfiguration conf;
+    conf.metrics = std::make_shared<MetricsRegistry>();
+    conf.metrics->EnableStageCpu(true);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ClientStageCpuTest");
+
+    auto putOutcome = client.PutObject(BucketName, key, TestUtils::GetRandomStream(4 * 1024 * 1024));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    auto getOutcome = client.GetObject(BucketName, key + "-not-exist");
+    EXPECT_EQ(getOutcome.isSuccess(), false);
+
+    auto snapshot = conf.metrics->Snapshot();
+    const auto& put = snapshot.Operations().at("PutObject");
+    EXPECT_GT(put.CpuNanos(), 0ULL);
+    EXPECT_GT(put.StageCpuNanos(CpuStage::Build), 0ULL);
+    EXPECT_GT(put.StageCpuNanos(CpuStage::Sign), 0ULL);
+    EXPECT_GT(put.StageCpuNanos(CpuStage::Checksum), 0ULL);
+    uint64_t stages = 0;
+    for (int i = 0; i < static_cast<int>(CpuStage::Count); i++) {
+        stages += put.StageCpuNanos(static_cast<CpuStage>(i));
+    }
+    EXPECT_LE(stages, put.CpuNanos());
+    EXPECT_GT(snapshot.Operations().at("GetObject").StageCpuNanos(CpuStage::Parse), 0ULL);
+
+    conf.metrics->EnableStageCpu(false);
+    conf.metrics->Reset();
+    putOutcome = client.PutObject(BucketName, key, TestUtils::GetRandomStream(1024));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    EXPECT_EQ(conf.metrics->Snapshot().Operations().at("PutObject").CpuNanos(), 0ULL);
+}
+
+}
+}
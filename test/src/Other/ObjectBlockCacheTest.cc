@@ -0,0 +1,214 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ObjectBlockCache.h>
+#include <src/utils/FileSystemUtils.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <fstream>
+#include <sstream>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ObjectBlockCacheTest : public ::testing::Test {
+protected:
+    ObjectBlockCacheTest()
+    {
+    }
+
+    ~ObjectBlockCacheTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-blockcachetest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+        Directory = TestUtils::GetTargetFileName("ObjectBlockCacheTest");
+    }
+
+    void TearDown() override
+    {
+        RemoveFile(Directory + "/blocks.idx");
+        RemoveFile(Directory + "/blocks.dat");
+        RemoveDirectory(Directory);
+    }
+
+    static std::string ReadAll(const GetObjectOutcome& outcome)
+    {
+        std::stringstream ss;
+        ss << outcome.result().Content()->rdbuf();
+        return ss.str();
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+    std::string Directory;
+};
+
+std::shared_ptr<OssClient> ObjectBlockCacheTest::Client = nullptr;
+std::string ObjectBlockCacheTest::BucketName = "";
+
+TEST_F(ObjectBlockCacheTest, BlocksTest)
+{
+    std::string data;
+    {
+        ObjectBlockCache cache(Directory, 2 * 16, 16);
+        EXPECT_EQ(cache.IsOpen(), true);
+        ObjectBlockCache other(Directory, 2 * 16, 16);
+        EXPECT_EQ(other.IsOpen(), false);
+
+        EXPECT_EQ(cache.readBlock("bucket", "key", "etag", 0, data), false);
+        cache.writeBlock("bucket", "key", "etag", 0, "0123456789abcdef", 16);
+        cache.writeBlock("bucket", "key", "etag", 1, "tail", 4);
+        EXPECT_EQ(cache.readBlock("bucket", "key", "etag", 0, data), true);
+        EXPECT_EQ(data, "0123456789abcdef");
+        EXPECT_EQ(cache.readBlock("bucket", "key", "other-etag", 0, data), false);
+
+        // block 1 is the least recently used one
+        cache.writeBlock("bucket", "key2", "etag", 0, "key2", 4);
+        EXPECT_EQ(cache.Evictions(), 1ULL);
+        EXPECT_EQ(cache.readBlock("bucket", "key", "etag", 1, data), false);
+        EXPECT_EQ(cache.Blocks(), 2U);
+        EXPECT_EQ(cache.Hits(), 1ULL);
+        EXPECT_EQ(cache.BytesFromCache(), 16ULL);
+    }
+
+    // the blocks are kept across instances, a damaged one is not served
+    {
+        std::fstream file(Directory + "/blocks.dat", std::ios::in | std::ios::out | std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        auto pos = ss.str().find("0123456789abcdef");
+        EXPECT_NE(pos, std::string::npos);
+        file.seekp(pos);
+        file.put('X');
+    }
+    auto cache = std::make_shared<ObjectBlockCache>(Directory, 2 * 16, 16);
+    EXPECT_EQ(cache->IsOpen(), true);
+    EXPECT_EQ(cache->Blocks(), 2U);
+    EXPECT_EQ(cache->readBlock("bucket", "key2", "etag", 0, data), true);
+    EXPECT_EQ(data, "key2");
+    EXPECT_EQ(cache->readBlock("bucket", "key", "etag", 0, data), false);
+    EXPECT_EQ(cache->CorruptBlocks(), 1ULL);
+    EXPECT_EQ(cache->Blocks(), 1U);
+
+    // another geometry starts empty
+    cache = nullptr;
+    cache = std::make_shared<ObjectBlockCache>(Directory, 4 * 32, 32);
+    EXPECT_EQ(cache->IsOpen(), true);
+    EXPECT_EQ(cache->Blocks(), 0U);
+}
+
+TEST_F(ObjectBlockCacheTest, ClientRangeReadTest)
+{
+    auto key = TestUtils::GetObjectKey("ClientRangeReadTest");
+    auto source = TestUtils::GetRandomString(10000);
+    EXPECT_EQ(Client->PutObject(BucketName, key, std::make_shared<std::stringstream>(source)).isSuccess(), true);
+
+    {
+        ClientConfiguration conf;
+        conf.blockCache = std::make_shared<ObjectBlockCache>(Directory, 64 * 1024, 1024, 2);
+        OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+
+        GetObjectRequest request(BucketName, key);
+        request.setRange(100, 2999);
+        auto outcome = client.GetObject(request);
+        EXPECT_EQ(outcome.isSuccess(), true);
+        EXPECT_EQ(ReadAll(outcome), source.substr(100, 2900));
+        EXPECT_EQ(outcome.result().Metadata().ContentLength(), 2900);
+        // blocks 0 to 2 and 2 blocks of readahead
+        EXPECT_EQ(conf.blockCache->Blocks(), 5U);
+
+        outcome = client.GetObject(request);
+        EXPECT_EQ(ReadAll(outcome), source.substr(100, 2900));
+        EXPECT_EQ(conf.blockCache->Hits(), 3ULL);
+
+        // the tail, partly cached
+        request.setRange(4000, -1);
+        outcome = client.GetObject(request);
+        EXPECT_EQ(ReadAll(outcome), source.substr(4000));
+        EXPECT_EQ(conf.blockCache->Blocks(), 10U);
+
+        // a write of the same client is seen at once
+        auto update = TestUtils::GetRandomString(10000);
+        EXPECT_EQ(client.PutObject(BucketName, key, std::make_shared<std::stringstream>(update)).isSuccess(), true);
+        request.setRange(100, 2999);
+        outcome = client.GetObject(request);
+        EXPECT_EQ(ReadAll(outcome), update.substr(100, 2900));
+        source = update;
+    }
+
+    // a new process reuses the blocks on the disk
+    ClientConfiguration conf;
+    conf.blockCache = std::make_shared<ObjectBlockCache>(Directory, 64 * 1024, 1024);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    GetObjectRequest request(BucketName, key);
+    request.setRange(1024, 2047);
+    auto outcome = client.GetObject(request);
+    EXPECT_EQ(ReadAll(outcome), source.substr(1024, 1024));
+    EXPECT_EQ(conf.blockCache->Hits(), 1ULL);
+    EXPECT_EQ(conf.blockCache->Misses(), 0ULL);
+}
+
+TEST_F(ObjectBlockCacheTest, ClientRangeOutOfObjectTest)
+{
+    auto key = TestUtils::GetObjectKey("ClientRangeOutOfObjectTest");
+    auto source = TestUtils::GetRandomString(10000);
+    EXPECT_EQ(Client->PutObject(BucketName, key, std::make_shared<std::stringstream>(source)).isSuccess(), true);
+
+    ClientConfiguration conf;
+    conf.blockCache = std::make_shared<ObjectBlockCache>(Directory, 64 * 1024, 1024);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+
+    GetObjectRequest request(BucketName, key);
+    request.setRange(3000, 100);
+    auto outcome = client.GetObject(request);
+    EXPECT_EQ(outcome.isSuccess(), false);
+    EXPECT_EQ(outcome.error().Code(), "ValidateError");
+
+    // a legacy mode range past the end gets the whole object
+    request.setRange(9000, 20000);
+    outcome = client.GetObject(request);
+    EXPECT_EQ(outcome.isSuccess(), true);
+    EXPECT_EQ(ReadAll(outcome), source);
+
+    // a standard mode one ends at the end of the object
+    request.setRange(9000, 20000, true);
+    outcome = client.GetObject(request);
+    EXPECT_EQ(outcome.isSuccess(), true);
+    EXPECT_EQ(ReadAll(outcome), source.substr(9000));
+}
+
+}
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ObjectContentCache.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <sstream>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ObjectContentCacheTest : public ::testing::Test {
+protected:
+    ObjectContentCacheTest()
+    {
+    }
+
+    ~ObjectContentCacheTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-contentcachetest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static std::string ReadAll(const GetObjectOutcome& outcome)
+    {
+        std::stringstream ss;
+        ss << outcome.result().Content()->rdbuf();
+        return ss.str();
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> ObjectContentCacheTest::Client = nullptr;
+std::string ObjectContentCacheTest::BucketName = "";
+
+TEST_F(ObjectContentCacheTest, LruAndInvalidateTest)
+{
+    ObjectContentCache cache(900, 60, 400, 1);
+    HeaderCollection headers;
+    headers[Http::ETAG] = "\"etag\"";
+    ObjectContentCache::Entry entry;
+
+    EXPECT_EQ(cache.find("bucket", "a", "", entry), false);
+    cache.put("bucket", "a", "", std::make_shared<const std::string>(300, 'a'), headers, entry.epoch);
+    cache.put("bucket", "b", "", std::make_shared<const std::string>(300, 'b'), headers, entry.epoch);
+    cache.put("bucket", "big", "", std::make_shared<const std::string>(500, 'c'), headers, entry.epoch);
+    EXPECT_EQ(cache.Size(), 2U);
+
+    EXPECT_EQ(cache.find("bucket", "a", "", entry), true);
+    EXPECT_EQ(entry.fresh, true);
+    EXPECT_EQ(entry.eTag, "\"etag\"");
+    EXPECT_EQ(*entry.content, std::string(300, 'a'));
+
+    // b is the least recently used one
+    cache.put("bucket", "c", "", std::make_shared<const std::string>(300, 'c'), headers, entry.epoch);
+    EXPECT_EQ(cache.Evictions(), 1ULL);
+    EXPECT_EQ(cache.find("bucket", "b", "", entry), false);
+    EXPECT_LE(cache.Bytes(), 900ULL);
+
+    cache.put("bucket", "a", "bytes=0-9", std::make_shared<const std::string>(10, 'r'), headers, entry.epoch);
+    EXPECT_EQ(cache.Size(), 3U);
+
+    cache.invalidate("bucket", "a");
+    EXPECT_EQ(cache.Invalidations(), 2ULL);
+    EXPECT_EQ(cache.find("bucket", "a", "", entry), false);
+    EXPECT_EQ(cache.find("bucket", "a", "bytes=0-9", entry), false);
+    EXPECT_EQ(cache.find("bucket", "c", "", entry), true);
+
+    // a read which started before the invalidation is not kept
+    ObjectContentCache::Entry stale;
+    cache.find("bucket", "d", "", stale);
+    cache.invalidate("bucket", "d");
+    cache.put("bucket", "d", "", std::make_shared<const std::string>(10, 'd'), headers, stale.epoch);
+    EXPECT_EQ(cache.find("bucket", "d", "", entry), false);
+
+    EXPECT_EQ(cache.Hits(), 2ULL);
+    EXPECT_EQ(cache.HitBytes(), 600ULL);
+    cache.clear();
+    EXPECT_EQ(cache.Size(), 0U);
+    EXPECT_EQ(cache.Bytes(), 0ULL);
+}
+
+TEST_F(ObjectContentCacheTest, StaleEntryTest)
+{
+    ObjectContentCache cache(1000, 0);
+    HeaderCollection headers;
+    ObjectContentCache::Entry entry;
+    cache.find("bucket", "a", "", entry);
+
+    // an entry without an etag can not be revalidated
+    cache.put("bucket", "a", "", std::make_shared<const std::string>("data"), headers, entry.epoch);
+    EXPECT_EQ(cache.find("bucket", "a", "", entry), false);
+
+    headers[Http::ETAG] = "\"etag\"";
+    cache.put("bucket", "a", "", std::make_shared<const std::string>("data"), headers, entry.epoch);
+    EXPECT_EQ(cache.find("bucket", "a", "", entry), true);
+    EXPECT_EQ(entry.fresh, false);
+    cache.revalidated("bucket", "a", "", true);
+    cache.revalidated("bucket", "a", "", false);
+    EXPECT_EQ(cache.Hits(), 1ULL);
+    EXPECT_EQ(cache.Revalidations(), 1ULL);
+    EXPECT_EQ(cache.Misses(), 3ULL);
+}
+
+TEST_F(ObjectContentCacheTest, ClientGetObjectTest)
+{
+    ClientConfiguration conf;
+    conf.contentCache = std::make_shared<ObjectContentCache>(1024 * 1024);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ClientGetObjectTest");
+
+    auto putOutcome = client.PutObject(BucketName, key, std::make_shared<std::stringstream>("version one"));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    auto getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    EXPECT_EQ(ReadAll(getOutcome), "version one");
+    EXPECT_EQ(getOutcome.result().Metadata().ContentLength(), 11);
+    EXPECT_EQ(conf.contentCache->Hits(), 1ULL);
+    EXPECT_EQ(conf.contentCache->Misses(), 1ULL);
+
+    GetObjectRequest rangeRequest(BucketName, key);
+    rangeRequest.setRange(0, 6);
+    getOutcome = client.GetObject(rangeRequest);
+    EXPECT_EQ(ReadAll(getOutcome), "version");
+    getOutcome = client.GetObject(rangeRequest);
+    EXPECT_EQ(ReadAll(getOutcome), "version");
+    EXPECT_EQ(conf.contentCache->Hits(), 2ULL);
+
+    // conditional reads bypass the cache
+    GetObjectRequest conditional(BucketName, key);
+    conditional.setModifiedSinceConstraint("Thu, 01 Jan 1970 00:00:00 GMT");
+    getOutcome = client.GetObject(conditional);
+    EXPECT_EQ(conf.contentCache->Hits(), 2ULL);
+
+    putOutcome = client.PutObject(BucketName, key, std::make_shared<std::stringstream>("version two"));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    EXPECT_EQ(conf.contentCache->Size(), 0U);
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(ReadAll(getOutcome), "version two");
+
+    // a body read into the stream of the caller is kept as well
+    putOutcome = client.PutObject(BucketName, key, std::make_shared<std::stringstream>("version three"));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    auto stream = std::make_shared<std::stringstream>();
+    GetObjectRequest streamRequest(BucketName, key);
+    streamRequest.setResponseStreamFactory([stream]() { return stream; });
+    getOutcome = client.GetObject(streamRequest);
+    EXPECT_EQ(getOutcome.result().Content(), stream);
+    EXPECT_EQ(stream->str(), "version three");
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(ReadAll(getOutcome), "version three");
+    EXPECT_EQ(conf.contentCache->Hits(), 3ULL);
+
+    client.DeleteObject(BucketName, key);
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), false);
+    EXPECT_EQ(conf.contentCache->Size(), 0U);
+}
+
+TEST_F(ObjectContentCacheTest, ClientRevalidateTest)
+{
+    ClientConfiguration conf;
+    conf.contentCache = std::make_shared<ObjectContentCache>(1024 * 1024, 0);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ClientRevalidateTest");
+
+    auto putOutcome = client.PutObject(BucketName, key, std::make_shared<std::stringstream>("version one"));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    auto getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    EXPECT_EQ(ReadAll(getOutcome), "version one");
+    EXPECT_EQ(conf.contentCache->Revalidations(), 1ULL);
+
+    // changed by another client, the revalidation brings the new content
+    putOutcome = Client->PutObject(BucketName, key, std::make_shared<std::stringstream>("version two"));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    EXPECT_EQ(ReadAll(getOutcome), "version two");
+    EXPECT_EQ(conf.contentCache->Revalidations(), 1ULL);
+    EXPECT_EQ(conf.contentCache->Misses(), 2ULL);
+
+    getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(ReadAll(getOutcome), "version two");
+    EXPECT_EQ(conf.contentCache->Revalidations(), 2ULL);
+}
+
+}
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/ObjectMetaCache.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <sstream>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ObjectMetaCacheTest : public ::testing::Test {
+protected:
+    ObjectMetaCacheTest()
+    {
+    }
+
+    ~ObjectMetaCacheTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-metacachetest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> ObjectMetaCacheTest::Client = nullptr;
+std::string ObjectMetaCacheTest::BucketName = "";
+
+TEST_F(ObjectMetaCacheTest, EntriesTest)
+{
+    ObjectMetaCache cache(2, 60, 60, 1);
+    HeaderCollection headers;
+    headers[Http::CONTENT_LENGTH] = "10";
+    headers[Http::ETAG] = "\"etag\"";
+    headers["x-oss-meta-name"] = "value";
+    HeaderCollection listed;
+    listed[Http::CONTENT_LENGTH] = "10";
+    listed[Http::ETAG] = "etag";
+    ObjectMetaCache::Entry entry;
+
+    // a listing serves GetObjectMeta only
+    cache.put("bucket", "a", "", listed, false, cache.Epoch("bucket", "a"));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), false);
+    EXPECT_EQ(cache.find("bucket", "a", "", false, entry), true);
+
+    cache.put("bucket", "a", "", headers, true, cache.Epoch("bucket", "a"));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), true);
+    EXPECT_EQ(entry.exists, true);
+    EXPECT_EQ(entry.headers["x-oss-meta-name"], "value");
+
+    // the same content listed again keeps the complete headers
+    cache.put("bucket", "a", "", listed, false, cache.Epoch("bucket", "a"));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), true);
+
+    cache.putMissing("bucket", "b", "", "NoSuchKey", "missing", cache.Epoch("bucket", "b"));
+    EXPECT_EQ(cache.find("bucket", "b", "", true, entry), true);
+    EXPECT_EQ(entry.exists, false);
+    EXPECT_EQ(entry.errorCode, "NoSuchKey");
+    EXPECT_EQ(cache.NegativeHits(), 1ULL);
+
+    // b is the most recently used one
+    cache.put("bucket", "c", "v1", headers, true, cache.Epoch("bucket", "c"));
+    EXPECT_EQ(cache.Evictions(), 1ULL);
+    EXPECT_EQ(cache.find("bucket", "a", "", false, entry), false);
+    EXPECT_EQ(cache.Size(), 2U);
+
+    // a lookup which started before the invalidation is not kept
+    auto epoch = cache.Epoch("bucket", "c");
+    cache.invalidate("bucket", "c");
+    EXPECT_EQ(cache.Invalidations(), 1ULL);
+    EXPECT_EQ(cache.find("bucket", "c", "v1", false, entry), false);
+    cache.put("bucket", "c", "v1", headers, true, epoch);
+    EXPECT_EQ(cache.find("bucket", "c", "v1", false, entry), false);
+
+    cache.clear();
+    EXPECT_EQ(cache.Size(), 0U);
+}
+
+TEST_F(ObjectMetaCacheTest, ShardEpochTest)
+{
+    ObjectMetaCache cache(100, 60, 60, 4);
+    HeaderCollection headers;
+    headers[Http::ETAG] = "\"etag\"";
+    ObjectMetaCache::Entry entry;
+
+    // find an object in another shard than a
+    std::string other;
+    for (int i = 0; other.empty() && i < 100; i++) {
+        auto key = "other" + std::to_string(i);
+        auto epoch = cache.Epoch("bucket", "a");
+        cache.invalidate("bucket", key);
+        if (cache.Epoch("bucket", "a") == epoch) {
+            other = key;
+        }
+    }
+    ASSERT_EQ(other.empty(), false);
+
+    // the invalidation of another shard does not drop the fill
+    auto epoch = cache.Epoch("bucket", "a");
+    auto epochs = cache.Epochs();
+    cache.invalidate("bucket", other);
+    cache.put("bucket", "a", "", headers, true, epoch);
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), true);
+    EXPECT_EQ(cache.Epoch("bucket", "a", epochs), epoch);
+
+    // the invalidation of the same shard does
+    cache.invalidate("bucket", "a");
+    cache.put("bucket", "a", "", headers, true, cache.Epoch("bucket", "a", epochs));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), false);
+}
+
+TEST_F(ObjectMetaCacheTest, ExpiredEntriesTest)
+{
+    ObjectMetaCache cache(100, 60, 0);
+    HeaderCollection headers;
+    headers[Http::ETAG] = "\"etag\"";
+    ObjectMetaCache::Entry entry;
+
+    cache.putMissing("bucket", "a", "", "NoSuchKey", "missing", cache.Epoch("bucket", "a"));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), false);
+    EXPECT_EQ(cache.Size(), 0U);
+    cache.put("bucket", "a", "", headers, true, cache.Epoch("bucket", "a"));
+    EXPECT_EQ(cache.find("bucket", "a", "", true, entry), true);
+    EXPECT_EQ(cache.Hits(), 1ULL);
+    EXPECT_EQ(cache.Misses(), 1ULL);
+}
+
+TEST_F(ObjectMetaCacheTest, ClientHeadObjectTest)
+{
+    ClientConfiguration conf;
+    conf.metaCache = std::make_shared<ObjectMetaCache>();
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ClientHeadObjectTest");
+
+    auto headOutcome = client.HeadObject(BucketName, key);
+    EXPECT_EQ(headOutcome.isSuccess(), false);
+    headOutcome = client.HeadObject(BucketName, key);
+    EXPECT_EQ(headOutcome.isSuccess(), false);
+    EXPECT_EQ(conf.metaCache->NegativeHits(), 1ULL);
+
+    ObjectMetaData meta;
+    meta.UserMetaData()["name"] = "value";
+    auto putOutcome = client.PutObject(BucketName, key, std::make_shared<std::stringstream>("0123456789"), meta);
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+    headOutcome = client.HeadObject(BucketName, key);
+    EXPECT_EQ(headOutcome.isSuccess(), true);
+    headOutcome = client.HeadObject(BucketName, key);
+    EXPECT_EQ(headOutcome.isSuccess(), true);
+    EXPECT_EQ(headOutcome.result().ContentLength(), 10);
+    EXPECT_EQ(headOutcome.result().UserMetaData().at("name"), "value");
+    EXPECT_EQ(conf.metaCache->Hits(), 2ULL);
+
+    auto metaOutcome = client.GetObjectMeta(BucketName, key);
+    EXPECT_EQ(metaOutcome.isSuccess(), true);
+    EXPECT_EQ(metaOutcome.result().ContentLength(), 10);
+    EXPECT_EQ(conf.metaCache->Hits(), 3ULL);
+
+    client.DeleteObject(BucketName, key);
+    headOutcome = client.HeadObject(BucketName, key);
+    EXPECT_EQ(headOutcome.isSuccess(), false);
+    EXPECT_EQ(conf.metaCache->Hits(), 3ULL);
+}
+
+TEST_F(ObjectMetaCacheTest, ClientPopulateTest)
+{
+    ClientConfiguration conf;
+    conf.metaCache = std::make_shared<ObjectMetaCache>();
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto prefix = TestUtils::GetObjectKey("ClientPopulateTest");
+    auto key1 = prefix + "/1";
+    auto key2 = prefix + "/2";
+    EXPECT_EQ(Client->PutObject(BucketName, key1, std::make_shared<std::stringstream>("1234")).isSuccess(), true);
+    EXPECT_EQ(Client->PutObject(BucketName, key2, std::make_shared<std::stringstream>("5678")).isSuccess(), true);
+
+    ListObjectsV2Request listRequest(BucketName);
+    listRequest.setPrefix(prefix + "/");
+    auto listOutcome = client.ListObjectsV2(listRequest);
+    EXPECT_EQ(listOutcome.isSuccess(), true);
+    EXPECT_EQ(conf.metaCache->Size(), 2U);
+
+    auto metaOutcome = client.GetObjectMeta(BucketName, key1);
+    EXPECT_EQ(metaOutcome.isSuccess(), true);
+    EXPECT_EQ(metaOutcome.result().ContentLength(), 4);
+    EXPECT_EQ(conf.metaCache->Hits(), 1ULL);
+
+    // a listing does not hold the user meta of HeadObject
+    auto headOutcome = client.HeadObject(BucketName, key1);
+    EXPECT_EQ(headOutcome.isSuccess(), true);
+    EXPECT_EQ(conf.metaCache->Hits(), 1ULL);
+
+    auto getOutcome = client.GetObject(BucketName, key2);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    headOutcome = client.HeadObject(BucketName, key2);
+    EXPECT_EQ(headOutcome.isSuccess(), true);
+    EXPECT_EQ(headOutcome.result().ContentLength(), 4);
+    EXPECT_EQ(conf.metaCache->Hits(), 2ULL);
+}
+
+}
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/Metrics.h>
+#include <alibabacloud/oss/client/RateLimiter.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <sstream>
+#include <thread>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class ReadCoalescingTest : public ::testing::Test {
+protected:
+    ReadCoalescingTest()
+    {
+    }
+
+    ~ReadCoalescingTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-readcoalescingtest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> ReadCoalescingTest::Client = nullptr;
+std::string ReadCoalescingTest::BucketName = "";
+
+class CoalescingRateLimiter : public RateLimiter
+{
+public:
+    explicit CoalescingRateLimiter(int rate) : rate_(rate) {}
+    virtual void setRate(int rate) { rate_ = rate; }
+    virtual int Rate() const { return rate_; }
+private:
+    int rate_;
+};
+
+TEST_F(ReadCoalescingTest, ConcurrentGetObjectTest)
+{
+    ClientConfiguration conf;
+    conf.enableReadCoalescing = true;
+    conf.metrics = std::make_shared<MetricsRegistry>();
+    conf.recvRateLimiter = std::make_shared<CoalescingRateLimiter>(400);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ConcurrentGetObjectTest");
+    auto content = TestUtils::GetRandomString(200 * 1024);
+    auto putOutcome = Client->PutObject(BucketName, key, std::make_shared<std::stringstream>(content));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    const int count = 8;
+    std::vector<std::string> bodies(count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; i++) {
+        threads.emplace_back([&, i]() {
+            GetObjectRequest request(BucketName, key);
+            if (i % 2 == 1) {
+                // a stream which is already written gets a copy of the shared body
+                request.setResponseStreamFactory([]() {
+                    auto stream = std::make_shared<std::stringstream>();
+                    *stream << "#";
+                    return stream; });
+            }
+            auto outcome = client.GetObject(request);
+            if (outcome.isSuccess()) {
+                std::ostringstream body;
+                body << outcome.result().Content()->rdbuf();
+                bodies[i] = body.str();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(bodies[i], i % 2 == 1 ? "#" + content : content);
+    }
+    auto snapshot = conf.metrics->Snapshot();
+    EXPECT_LT(snapshot.Operations().at("GetObject").Requests(), static_cast<uint64_t>(count));
+
+    // the calls after the shared one has completed send their own request
+    auto requests = snapshot.Operations().at("GetObject").Requests();
+    auto outcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(outcome.isSuccess(), true);
+    EXPECT_EQ(conf.metrics->Snapshot().Operations().at("GetObject").Requests(), requests + 1);
+
+    // a different range is a different read
+    std::string first, second;
+    std::thread rangeThread([&]() {
+        GetObjectRequest request(BucketName, key);
+        request.setRange(0, 9);
+        auto rangeOutcome = client.GetObject(request);
+        if (rangeOutcome.isSuccess()) {
+            std::ostringstream body;
+            body << rangeOutcome.result().Content()->rdbuf();
+            first = body.str();
+        }
+    });
+    GetObjectRequest request(BucketName, key);
+    request.setRange(10, 19);
+    auto rangeOutcome = client.GetObject(request);
+    EXPECT_EQ(rangeOutcome.isSuccess(), true);
+    std::ostringstream body;
+    body << rangeOutcome.result().Content()->rdbuf();
+    second = body.str();
+    rangeThread.join();
+    EXPECT_EQ(first, content.substr(0, 10));
+    EXPECT_EQ(second, content.substr(10, 10));
+}
+
+TEST_F(ReadCoalescingTest, CallerStreamTest)
+{
+    ClientConfiguration conf;
+    conf.enableReadCoalescing = true;
+    conf.recvRateLimiter = std::make_shared<CoalescingRateLimiter>(400);
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("CallerStreamTest");
+    auto content = TestUtils::GetRandomString(200 * 1024);
+    auto putOutcome = Client->PutObject(BucketName, key, std::make_shared<std::stringstream>(content));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    // an empty stream of the caller is written, not replaced by the shared body
+    const int count = 8;
+    std::vector<std::shared_ptr<std::stringstream>> streams(count);
+    std::vector<bool> sameStream(count, false);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; i++) {
+        streams[i] = std::make_shared<std::stringstream>();
+        threads.emplace_back([&, i]() {
+            GetObjectRequest request(BucketName, key);
+            auto stream = streams[i];
+            request.setResponseStreamFactory([stream]() { return stream; });
+            auto outcome = client.GetObject(request);
+            if (outcome.isSuccess()) {
+                sameStream[i] = outcome.result().Content() == stream;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(sameStream[i], true);
+        EXPECT_EQ(streams[i]->str(), content);
+    }
+}
+
+TEST_F(ReadCoalescingTest, ConcurrentHeadObjectTest)
+{
+    ClientConfiguration conf;
+    conf.enableReadCoalescing = true;
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("ConcurrentHeadObjectTest");
+    auto putOutcome = Client->PutObject(BucketName, key, TestUtils::GetRandomStream(1024));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    const int count = 8;
+    std::vector<int64_t> lengths(count, -1);
+    std::vector<std::string> errors(count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; i++) {
+        threads.emplace_back([&, i]() {
+            auto outcome = client.HeadObject(BucketName, key);
+            if (outcome.isSuccess()) {
+                lengths[i] = outcome.result().ContentLength();
+            }
+            auto missingOutcome = client.GetObjectMeta(BucketName, key + "-not-exist");
+            if (!missingOutcome.isSuccess()) {
+                errors[i] = missingOutcome.error().Code();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(lengths[i], 1024);
+        EXPECT_EQ(errors[i].empty(), false);
+    }
+}
+
+TEST_F(ReadCoalescingTest, DisabledTest)
+{
+    ClientConfiguration conf;
+    EXPECT_EQ(conf.enableReadCoalescing, false);
+    conf.metrics = std::make_shared<MetricsRegistry>();
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("DisabledTest");
+    auto putOutcome = Client->PutObject(BucketName, key, TestUtils::GetRandomStream(1024));
+    EXPECT_EQ(putOutcome.isSuccess(), true);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&]() {
+            auto outcome = client.GetObject(BucketName, key);
+            EXPECT_EQ(outcome.isSuccess(), true);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(conf.metrics->Snapshot().Operations().at("GetObject").Requests(), 4ULL);
+}
+
+}
+}
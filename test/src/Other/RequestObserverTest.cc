@@ -0,0 +1,182 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <alibabacloud/oss/client/RetryStrategy.h>
+#include <alibabacloud/oss/http/RequestObserver.h>
+#include "../Config.h"
+#include "../Utils.h"
+#include <mutex>
+#include <vector>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class RequestObserverTest : public ::testing::Test {
+protected:
+    RequestObserverTest()
+    {
+    }
+
+    ~RequestObserverTest() override
+    {
+    }
+
+    // Sets up the stuff shared by all tests in this test case.
+    static void SetUpTestCase()
+    {
+        Client = TestUtils::GetOssClientDefault();
+        BucketName = TestUtils::GetBucketName("cpp-sdk-requestobservertest");
+        Client->CreateBucket(CreateBucketRequest(BucketName));
+    }
+
+    // Tears down the stuff shared by all tests in this test case.
+    static void TearDownTestCase()
+    {
+        TestUtils::CleanBucket(*Client, BucketName);
+        Client = nullptr;
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+public:
+    static std::shared_ptr<OssClient> Client;
+    static std::string BucketName;
+};
+
+std::shared_ptr<OssClient> RequestObserverTest::Client = nullptr;
+std::string RequestObserverTest::BucketName = "";
+
+class RecordingObserver : public RequestObserver
+{
+public:
+    void onRequestEvent(const RequestEvent& event) override
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        events_.push_back(event);
+    }
+    std::vector<RequestEvent> Events()
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        return events_;
+    }
+    void clear()
+    {
+        std::lock_guard<std::mutex> lck(lock_);
+        events_.clear();
+    }
+private:
+    std::mutex lock_;
+    std::vector<RequestEvent> events_;
+};
+
+class FastRetryStrategy : public RetryStrategy
+{
+public:
+    bool shouldRetry(const Error&, long attemptedRetries) const override { return attemptedRetries < 2; }
+    long calcDelayTimeMs(const Error&, long) const override { return 1; }
+};
+
+TEST_F(RequestObserverTest, RequestLifecycleTest)
+{
+    auto observer = std::make_shared<RecordingObserver>();
+    ClientConfiguration conf;
+    conf.requestObserver = observer;
+    OssClient client(Config::Endpoint, Config::AccessKeyId, Config::AccessKeySecret, conf);
+    auto key = TestUtils::GetObjectKey("RequestLifecycleTest");
+
+    auto outcome = client.PutObject(BucketName, key, TestUtils::GetRandomStream(4096));
+    EXPECT_EQ(outcome.isSuccess(), true);
+
+    auto events = observer->Events();
+    std::vector<RequestEventType> expected = {
+        RequestEventType::Built, RequestEventType::Signed, RequestEventType::PoolAcquired,
+        RequestEventType::FirstByteSent, RequestEventType::HeadersReceived,
+        RequestEventType::Completed, RequestEventType::OutcomeParsed
+    };
+    ASSERT_EQ(events.size(), expected.size());
+    for (size_t i = 0; i < events.size(); i++) {
+        EXPECT_EQ(events[i].Type(), expected[i]);
+        EXPECT_EQ(events[i].RequestId(), events[0].RequestId());
+        EXPECT_EQ(events[i].Attempt(), 0);
+        if (i > 0) {
+            EXPECT_LE(events[i - 1].Timestamp(), events[i].Timestamp());
+        }
+    }
+    EXPECT_NE(events[0].RequestId(), 0ULL);
+    EXPECT_EQ(events[0].Operation(), "PutObject");
+    EXPECT_NE(events[0].Request(), nullptr);
+    EXPECT_EQ(events[4].StatusCode(), 200);
+    EXPECT_EQ(events[5].BytesSent(), 4096);
+    EXPECT_EQ(events[5].Success(), true);
+    EXPECT_EQ(events[6].Operation(), "PutObject");
+    EXPECT_EQ(events[6].Success(), true);
+    EXPECT_EQ(events[6].ServerRequestId(), outcome.result().RequestId());
+
+    observer->clear();
+    auto getOutcome = client.GetObject(BucketName, key);
+    EXPECT_EQ(getOutcome.isSuccess(), true);
+    events = observer->Events();
+    ASSERT_EQ(events.size(), expected.size());
+    EXPECT_EQ(events[5].BytesReceived(), 4096);
+}
+
+TEST_F(RequestObserverTest, RetryScheduledTest)
+{
+    auto observer = std::make_shared<RecordingObserver>();
+    ClientConfiguration conf;
+    conf.requestObserver = observer;
+    conf.retryStrategy = std::make_shared<FastRetryStrategy>();
+    conf.connectTimeoutMs = 1000;
+    OssClient client("http://127.0.0.1:1", Config::AccessKeyId, Config::AccessKeySecret, conf);
+
+    auto outcome = client.GetObject(BucketName, "RetryScheduledTest");
+    EXPECT_EQ(outcome.isSuccess(), false);
+
+    auto events = observer->Events();
+    std::vector<RequestEvent> retries;
+    std::vector<RequestEvent> completed;
+    for (const auto& event : events) {
+        EXPECT_EQ(event.RequestId(), events[0].RequestId());
+        if (event.Type() == RequestEventType::RetryScheduled) {
+            retries.push_back(event);
+        }
+        if (event.Type() == RequestEventType::Completed) {
+            completed.push_back(event);
+            EXPECT_EQ(event.Success(), false);
+            EXPECT_FALSE(event.ErrorCode().empty());
+        }
+    }
+    ASSERT_EQ(retries.size(), 2U);
+    EXPECT_EQ(retries[0].Attempt(), 0);
+    EXPECT_EQ(retries[1].Attempt(), 1);
+    EXPECT_EQ(retries[0].DelayMs(), 1);
+    EXPECT_FALSE(retries[0].ErrorCode().empty());
+    EXPECT_EQ(completed.size(), 3U);
+    EXPECT_EQ(completed[2].Attempt(), 2);
+    EXPECT_EQ(events.back().Type(), RequestEventType::OutcomeParsed);
+    EXPECT_EQ(events.back().Success(), false);
+}
+
+}
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <alibabacloud/oss/OssClient.h>
+#include <src/utils/XmlDocument.h>
+#include <sstream>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class XmlDocumentTest : public ::testing::Test {
+protected:
+    /* a stream which can not tell its size, as a user supplied response stream may be */
+    class UnseekableBuf : public std::streambuf
+    {
+    public:
+        explicit UnseekableBuf(const std::string& data) : data_(data)
+        {
+            char* p = const_cast<char*>(data_.data());
+            setg(p, p, p + data_.size());
+        }
+    private:
+        std::string data_;
+    };
+
+    static std::string ListPartsXml(int count)
+    {
+        std::stringstream ss;
+        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListPartsResult>"
+           << "<Bucket>bucket</Bucket><Key>multipart.data</Key><UploadId>0004B999EF5A239BB9138C6227D69F95</UploadId>"
+           << "<NextPartNumberMarker>" << count << "</NextPartNumberMarker><MaxParts>1000</MaxParts><IsTruncated>false</IsTruncated>";
+        for (int i = 1; i <= count; i++) {
+            ss << "<Part><PartNumber>" << i << "</PartNumber><LastModified>2012-02-23T07:01:34.000Z</LastModified>"
+               << "<ETag>&quot;3349DC700140D7F86A0784842780****&quot;</ETag><HashCrc64ecma>" << 1000 + i
+               << "</HashCrc64ecma><Size>6291456</Size></Part>";
+        }
+        ss << "</ListPartsResult>";
+        return ss.str();
+    }
+
+    static std::string DeleteObjectsXml(int count)
+    {
+        std::stringstream ss;
+        ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<DeleteResult>";
+        for (int i = 0; i < count; i++) {
+            ss << "<Deleted><Key>dir/sub/object-" << i << ".jpg</Key></Deleted>";
+        }
+        ss << "</DeleteResult>";
+        return ss.str();
+    }
+
+    static std::string GetBucketInfoXml()
+    {
+        return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<BucketInfo><Bucket>"
+            "<CreationDate>2013-07-31T10:56:21.000Z</CreationDate><ExtranetEndpoint>oss-cn-hangzhou.aliyuncs.com</ExtranetEndpoint>"
+            "<IntranetEndpoint>oss-cn-hangzhou-internal.aliyuncs.com</IntranetEndpoint><Location>oss-cn-hangzhou</Location>"
+            "<Name>oss-example</Name><StorageClass>Standard</StorageClass>"
+            "<Owner><DisplayName>username</DisplayName><ID>27183473914****</ID></Owner>"
+            "<AccessControlList><Grant>private</Grant></AccessControlList><Comment>test</Comment>"
+            "</Bucket></BucketInfo>";
+    }
+};
+
+TEST_F(XmlDocumentTest, LoadSeekableStreamTest)
+{
+    std::stringstream ss;
+    ss << "ignored<Root><Item>1</Item></Root>";
+    ss.seekg(7);
+
+    XmlDocument doc;
+    EXPECT_EQ(doc.Load(ss), tinyxml2::XML_SUCCESS);
+    EXPECT_EQ(doc.Empty(), false);
+    ASSERT_NE(doc.RootElement(), nullptr);
+    EXPECT_STREQ(doc.RootElement()->Name(), "Root");
+    EXPECT_STREQ(doc.RootElement()->FirstChildElement("Item")->GetText(), "1");
+}
+
+TEST_F(XmlDocumentTest, LoadUnseekableStreamTest)
+{
+    //larger than one read chunk, so the buffer has to grow
+    auto xml = ListPartsXml(300);
+    ASSERT_GT(xml.size(), 16U * 1024U);
+    UnseekableBuf buf(xml);
+    std::istream stream(&buf);
+
+    XmlDocument doc;
+    EXPECT_EQ(doc.Load(stream), tinyxml2::XML_SUCCESS);
+    ASSERT_NE(doc.RootElement(), nullptr);
+    int count = 0;
+    for (auto node = doc.RootElement()->FirstChildElement("Part"); node; node = node->NextSiblingElement("Part")) {
+        count++;
+    }
+    EXPECT_EQ(count, 300);
+}
+
+TEST_F(XmlDocumentTest, LoadEmptyAndInvalidTest)
+{
+    std::stringstream empty;
+    XmlDocument doc;
+    EXPECT_EQ(doc.Load(empty), tinyxml2::XML_ERROR_EMPTY_DOCUMENT);
+    EXPECT_EQ(doc.Empty(), true);
+
+    std::stringstream invalid("<Root><Item></Root>");
+    EXPECT_NE(doc.Load(invalid), tinyxml2::XML_SUCCESS);
+    EXPECT_EQ(doc.Empty(), false);
+    EXPECT_EQ(doc.RootElement(), nullptr);
+
+    EXPECT_EQ(doc.Load(std::string("<Root/>")), tinyxml2::XML_SUCCESS);
+    EXPECT_STREQ(doc.RootElement()->Name(), "Root");
+}
+
+TEST_F(XmlDocumentTest, ResultFromStreamTest)
+{
+    auto xml = ListPartsXml(3);
+    ListPartsResult fromStream(std::make_shared<std::stringstream>(xml));
+    ListPartsResult fromString(xml);
+    ASSERT_EQ(fromStream.PartList().size(), 3U);
+    ASSERT_EQ(fromString.PartList().size(), 3U);
+    EXPECT_EQ(fromStream.UploadId(), "0004B999EF5A239BB9138C6227D69F95");
+    EXPECT_EQ(fromStream.UploadId(), fromString.UploadId());
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(fromStream.PartList()[i].PartNumber(), static_cast<int32_t>(i + 1));
+        EXPECT_EQ(fromStream.PartList()[i].ETag(), fromString.PartList()[i].ETag());
+        EXPECT_EQ(fromStream.PartList()[i].CRC64(), 1001U + i);
+    }
+
+    DeleteObjectsResult quiet(std::make_shared<std::stringstream>());
+    EXPECT_EQ(quiet.Quiet(), true);
+
+    DeleteObjectsResult deleted(std::make_shared<std::stringstream>(DeleteObjectsXml(2)));
+    EXPECT_EQ(deleted.Quiet(), false);
+    EXPECT_EQ(deleted.keyList().size(), 2U);
+    EXPECT_EQ(deleted.keyList().front(), "dir/sub/object-0.jpg");
+
+    GetBucketInfoResult info(std::make_shared<std::stringstream>(GetBucketInfoXml()));
+    EXPECT_EQ(info.Name(), "oss-example");
+    EXPECT_EQ(info.Comment(), "test");
+}
+
+}
+}
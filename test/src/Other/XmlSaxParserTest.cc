@@ -0,0 +1,237 @@
+/*
+ * Copyright 2009-2017 Alibaba Cloud All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <src/utils/XmlSaxParser.h>
+#include <src/model/ListObjectsXmlParser.h>
+
+namespace AlibabaCloud {
+namespace OSS {
+
+class XmlSaxParserTest : public ::testing::Test {
+protected:
+    class Recorder : public XmlSaxParser::Handler
+    {
+    public:
+        void onStartElement(const std::string &name, size_t depth) override
+        {
+            events.push_back("+" + name + std::to_string(depth));
+        }
+        void onEndElement(const std::string &name, size_t depth, std::string &text) override
+        {
+            events.push_back("-" + name + std::to_string(depth) + ":" + text);
+        }
+        std::vector<std::string> events;
+    };
+
+    static const char *ListXml;
+};
+
+const char *XmlSaxParserTest::ListXml = R"(<?xml version="1.0" encoding="UTF-8"?>
+<ListBucketResult xmlns="http://doc.oss-cn-hangzhou.aliyuncs.com">
+  <Name>oss-example</Name>
+  <Prefix>fun%2F</Prefix>
+  <MaxKeys>100</MaxKeys>
+  <IsTruncated>true</IsTruncated>
+  <NextContinuationToken>CgJiYw--</NextContinuationToken>
+  <Contents>
+    <Key>fun%2Fa%26b</Key>
+    <ETag>"5B3C1A2E053D763E1B002CC607C5A0FE"</ETag>
+    <Size>5368709120</Size>
+    <Owner><ID>00220120222</ID><DisplayName>user-example</DisplayName></Owner>
+  </Contents>
+  <Contents>
+    <Key>fun%2Fb</Key>
+    <Size>1</Size>
+  </Contents>
+  <CommonPrefixes><Prefix>fun%2Fdir%2F</Prefix></CommonPrefixes>
+  <EncodingType>url</EncodingType>
+</ListBucketResult>)";
+
+TEST_F(XmlSaxParserTest, ParseInChunksTest)
+{
+    std::string xml = "<?xml version=\"1.0\"?><!-- head --><A x=\"1>2\"><B>a &amp; b &#x41;&#66;</B>"
+        "<C/><D><![CDATA[<raw> ]]]]></D></A>";
+
+    Recorder whole;
+    XmlSaxParser parser(&whole);
+    EXPECT_TRUE(parser.feed(xml.c_str(), xml.size()));
+    EXPECT_TRUE(parser.finish());
+
+    Recorder bytes;
+    XmlSaxParser parser1(&bytes);
+    for (auto c : xml) {
+        EXPECT_TRUE(parser1.feed(&c, 1));
+    }
+    EXPECT_TRUE(parser1.finish());
+
+    std::vector<std::string> expected = { "+A1", "+B2", "-B2:a & b AB", "+C2", "-C2:",
+        "+D2", "-D2:<raw> ]]", "-A1:" };
+    EXPECT_EQ(whole.events, expected);
+    EXPECT_EQ(bytes.events, expected);
+}
+
+TEST_F(XmlSaxParserTest, MalformedXmlTest)
+{
+    Recorder recorder;
+    XmlSaxParser parser(&recorder);
+    EXPECT_FALSE(parser.feed("<A><B></A>", 10));
+    EXPECT_TRUE(parser.hasError());
+    EXPECT_FALSE(parser.finish());
+
+    parser.reset();
+    EXPECT_TRUE(parser.feed("<A>&unknown", 11));
+    EXPECT_FALSE(parser.feed(";</A>", 5));
+
+    parser.reset();
+    EXPECT_TRUE(parser.feed("<A><B>", 6));
+    EXPECT_FALSE(parser.finish());
+
+    parser.reset();
+    EXPECT_TRUE(parser.feed("<A/>", 4));
+    EXPECT_TRUE(parser.finish());
+
+    parser.reset();
+    EXPECT_FALSE(parser.finish());
+}
+
+TEST_F(XmlSaxParserTest, ListObjectsV2StreamTest)
+{
+    ListObjectsV2Result result;
+    ListObjectsV2XmlParser parser(&result);
+    parser.reset();
+    auto stream = parser.createStream();
+    std::string xml(ListXml);
+    for (size_t i = 0; i < xml.size(); i += 7) {
+        stream->write(xml.c_str() + i, std::min<size_t>(7, xml.size() - i));
+    }
+    EXPECT_TRUE(parser.finish());
+
+    EXPECT_EQ(result.Name(), "oss-example");
+    EXPECT_EQ(result.Prefix(), "fun/");
+    EXPECT_EQ(result.MaxKeys(), 100);
+    EXPECT_EQ(result.IsTruncated(), true);
+    EXPECT_EQ(result.NextContinuationToken(), "CgJiYw--");
+    EXPECT_EQ(result.EncodingType(), "url");
+    ASSERT_EQ(result.ObjectSummarys().size(), 2UL);
+    EXPECT_EQ(result.ObjectSummarys()[0].Key(), "fun/a&b");
+    EXPECT_EQ(result.ObjectSummarys()[0].ETag(), "5B3C1A2E053D763E1B002CC607C5A0FE");
+    EXPECT_EQ(result.ObjectSummarys()[0].Size(), 5368709120LL);
+    EXPECT_EQ(result.ObjectSummarys()[0].Owner().Id(), "00220120222");
+    EXPECT_EQ(result.ObjectSummarys()[0].Owner().DisplayName(), "user-example");
+    EXPECT_EQ(result.ObjectSummarys()[1].Key(), "fun/b");
+    EXPECT_EQ(result.ObjectSummarys()[1].Owner().Id(), "");
+    ASSERT_EQ(result.CommonPrefixes().size(), 1UL);
+    EXPECT_EQ(result.CommonPrefixes()[0], "fun/dir/");
+}
+
+TEST_F(XmlSaxParserTest, ListObjectsV2HandlerTest)
+{
+    std::vector<std::string> keys;
+    ListObjectsV2Result result;
+    ListObjectsV2XmlParser parser(&result, [&keys](const ObjectSummary &summary) {
+        keys.push_back(summary.Key());
+    });
+
+    //the first attempt is broken after the first summary
+    std::string xml(ListXml);
+    parser.reset();
+    auto stream = parser.createStream();
+    stream->write(xml.c_str(), xml.find("</Contents>") + 11);
+    EXPECT_EQ(keys.size(), 1UL);
+
+    //the retried attempt does not deliver the first summary again
+    parser.reset();
+    stream = parser.createStream();
+    stream->write(xml.c_str(), xml.size());
+    EXPECT_TRUE(parser.finish());
+
+    ASSERT_EQ(keys.size(), 2UL);
+    EXPECT_EQ(keys[1], "fun%2Fb");
+    EXPECT_TRUE(result.ObjectSummarys().empty());
+    EXPECT_EQ(result.NextContinuationToken(), "CgJiYw--");
+}
+
+TEST_F(XmlSaxParserTest, ListObjectsHandlerEncodingTypeTest)
+{
+    //<EncodingType> comes after the summaries, the request's encoding type decodes them
+    std::vector<std::string> keys;
+    ListObjectsV2Result result;
+    ListObjectsV2XmlParser parser(&result, [&keys](const ObjectSummary &summary) {
+        keys.push_back(summary.Key());
+    }, "url");
+    parser.reset();
+    EXPECT_TRUE(parser.parse(std::string(ListXml)));
+
+    ASSERT_EQ(keys.size(), 2UL);
+    EXPECT_EQ(keys[0], "fun/a&b");
+    EXPECT_EQ(keys[1], "fun/b");
+    EXPECT_EQ(result.Prefix(), "fun/");
+    ASSERT_EQ(result.CommonPrefixes().size(), 1UL);
+    EXPECT_EQ(result.CommonPrefixes()[0], "fun/dir/");
+
+    std::vector<std::string> v1Keys;
+    ListObjectsResult v1Result;
+    ListObjectsXmlParser v1Parser(&v1Result, [&v1Keys](const ObjectSummary &summary) {
+        v1Keys.push_back(summary.Key());
+    }, "url");
+    v1Parser.reset();
+    EXPECT_TRUE(v1Parser.parse(std::string(ListXml)));
+    ASSERT_EQ(v1Keys.size(), 2UL);
+    EXPECT_EQ(v1Keys[0], "fun/a&b");
+    EXPECT_EQ(v1Keys[1], "fun/b");
+
+    //the keys kept in the result are not decoded twice
+    ListObjectsV2Result keptResult;
+    ListObjectsV2XmlParser keptParser(&keptResult, nullptr, "url");
+    keptParser.reset();
+    EXPECT_TRUE(keptParser.parse(std::string(ListXml).replace(std::string(ListXml).find("fun%2Fb"), 7, "fun%252Fb")));
+    ASSERT_EQ(keptResult.ObjectSummarys().size(), 2UL);
+    EXPECT_EQ(keptResult.ObjectSummarys()[1].Key(), "fun%2Fb");
+}
+
+TEST_F(XmlSaxParserTest, ListObjectVersionsStreamTest)
+{
+    std::string xml = R"(<?xml version="1.0" encoding="UTF-8"?>
+<ListVersionsResult>
+  <Name>oss-example</Name>
+  <KeyMarker>example</KeyMarker>
+  <MaxKeys>100</MaxKeys>
+  <IsTruncated>false</IsTruncated>
+  <DeleteMarker>
+    <Key>example</Key>
+    <VersionId>CAEQMxiBgICAof2D0BYiIDJhMGE3N2M1YTI1NDQzOGY5NTkyNTI3MGYyMzJm****</VersionId>
+    <IsLatest>true</IsLatest>
+  </DeleteMarker>
+  <Version>
+    <Key>example</Key>
+    <VersionId>CAEQMxiBgMDNoP2D0BYiIDE3MWUxNzgxZDQxNTRiODI5OGYwZGMwNGY3MzZjNDVm****</VersionId>
+    <IsLatest>false</IsLatest>
+    <Size>93731</Size>
+  </Version>
+</ListVersionsResult>)";
+
+    ListObjectVersionsResult result(xml);
+    EXPECT_EQ(result.KeyMarker(), "example");
+    ASSERT_EQ(result.DeleteMarkerSummarys().size(), 1UL);
+    EXPECT_EQ(result.DeleteMarkerSummarys()[0].IsLatest(), true);
+    ASSERT_EQ(result.ObjectVersionSummarys().size(), 1UL);
+    EXPECT_EQ(result.ObjectVersionSummarys()[0].IsLatest(), false);
+    EXPECT_EQ(result.ObjectVersionSummarys()[0].Size(), 93731LL);
+}
+
+}
+}